@@ -0,0 +1,158 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull-bind.h"
+
+#include "bench.h"
+
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Location
+{
+    double lat;
+    double lon;
+    std::string label;
+
+    Location() : lat( 0.0 ), lon( 0.0 ) {}
+};
+
+struct Record
+{
+    uint64_t id;
+    std::string name;
+    bool active;
+    double score;
+    double ratio;
+    std::vector< std::string > tags;
+    Location location;
+    std::string description;
+
+    Record() : id( 0 ), active( false ), score( 0.0 ), ratio( 0.0 ) {}
+};
+
+}   // End of anonymous namespace
+
+CLJP_BIND_BEGIN( Location )
+    CLJP_BIND_MEMBER( lat )
+    CLJP_BIND_MEMBER( lon )
+    CLJP_BIND_MEMBER( label )
+CLJP_BIND_END()
+
+CLJP_BIND_BEGIN( Record )
+    CLJP_BIND_MEMBER( id )
+    CLJP_BIND_MEMBER( name )
+    CLJP_BIND_MEMBER( active )
+    CLJP_BIND_MEMBER( score )
+    CLJP_BIND_MEMBER( ratio )
+    CLJP_BIND_MEMBER( tags )
+    CLJP_BIND_MEMBER( location )
+    CLJP_BIND_MEMBER( description )
+CLJP_BIND_END()
+
+namespace {
+
+size_t read_by_hand( const std::string & r_json )
+{
+    // The loop a service would write around Parser::get()
+    cljp::ReaderString reader( r_json );
+    cljp::Parser parser( reader );
+    cljp::Event event;
+    std::vector< Record > records;
+
+    parser.get( &event );
+    while( parser.get( &event ) == cljp::Parser::PS_OK && event.is_object_start() )
+    {
+        records.push_back( Record() );
+        Record & r_record = records.back();
+        while( parser.get( &event ) == cljp::Parser::PS_OK && ! event.is_object_end() )
+        {
+            if( event.is( "id" ) )
+                r_record.id = event.to_uint64();
+            else if( event.is( "name" ) )
+                r_record.name = event.value;
+            else if( event.is( "active" ) )
+                r_record.active = event.is_true();
+            else if( event.is( "score" ) )
+                r_record.score = event.to_float();
+            else if( event.is( "ratio" ) )
+                r_record.ratio = event.to_float();
+            else if( event.is( "tags" ) )
+            {
+                while( parser.get( &event ) == cljp::Parser::PS_OK && ! event.is_array_end() )
+                    r_record.tags.push_back( event.value );
+            }
+            else if( event.is( "location" ) )
+            {
+                while( parser.get( &event ) == cljp::Parser::PS_OK && ! event.is_object_end() )
+                {
+                    if( event.is( "lat" ) )
+                        r_record.location.lat = event.to_float();
+                    else if( event.is( "lon" ) )
+                        r_record.location.lon = event.to_float();
+                    else if( event.is( "label" ) && event.is_string() )
+                        r_record.location.label = event.value;
+                }
+            }
+            else if( event.is( "description" ) )
+                r_record.description = event.value;
+            else if( event.is_object_start() || event.is_array_start() )
+                parser.skip();
+        }
+    }
+    return records.size();
+}
+
+size_t read_bound( const std::string & r_json )
+{
+    cljp::ReaderString reader( r_json );
+    cljp::Parser parser( reader );
+    std::vector< Record > records;
+    cljp::bind::read( parser, &records );
+    return records.size();
+}
+
+}   // End of anonymous namespace
+
+BENCHMARK( "Bind - Records" )
+{
+    std::string json = bench::records_document( 50000 );
+
+    BTHROUGHPUT( "Hand-written loop of Parser::get()", json.size(),
+            bench::keep( read_by_hand( json ) ) );
+
+    BTHROUGHPUT( "bind::read()", json.size(),
+            bench::keep( read_bound( json ) ) );
+}
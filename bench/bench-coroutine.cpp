@@ -0,0 +1,161 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull-coroutine.h"
+
+#include "bench.h"
+
+#include <algorithm>
+#include <coroutine>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace {
+
+class Source    // Completes each read at once, as a socket with data waiting would
+{
+private:
+    const std::string & r_in;
+    size_t pos;
+
+public:
+    struct Read
+    {
+        Source * p_source;
+        char * p_buffer;
+        size_t size;
+
+        bool await_ready() const { return true; }
+        void await_suspend( std::coroutine_handle<> ) {}
+        size_t await_resume()
+        {
+            size_t n_bytes = std::min( size, p_source->r_in.size() - p_source->pos );
+            memcpy( p_buffer, p_source->r_in.data() + p_source->pos, n_bytes );
+            p_source->pos += n_bytes;
+            return n_bytes;
+        }
+    };
+
+    Source( const std::string & r_in_in ) : r_in( r_in_in ), pos( 0 ) {}
+    Read read_some( char * p_buffer, size_t size ) { Read read = { this, p_buffer, size }; return read; }
+};
+
+class Task      // Runs straight away, and to completion as the source never suspends
+{
+public:
+    struct promise_type
+    {
+        Task get_return_object() { return Task(); }
+        std::suspend_never initial_suspend() noexcept { return std::suspend_never(); }
+        std::suspend_never final_suspend() noexcept { return std::suspend_never(); }
+        void return_void() {}
+        void unhandled_exception() {}
+    };
+};
+
+size_t count_get( const std::string & r_json )
+{
+    cljp::ReaderString reader( r_json );
+    cljp::Parser parser( reader );
+    cljp::Event event;
+    size_t n_events = 0;
+    while( parser.get( &event ) == cljp::Parser::PS_OK )
+        ++n_events;
+    return n_events;
+}
+
+size_t count_generated( const std::string & r_json )
+{
+    cljp::ReaderString reader( r_json );
+    cljp::Parser parser( reader );
+    size_t n_events = 0;
+    for( const cljp::Event & r_event : cljp::events( parser ) )
+        n_events += (r_event.type != cljp::Event::T_UNKNOWN);
+    return n_events;
+}
+
+size_t count_fed( const std::string & r_json )
+{
+    cljp::ReaderFeed reader;
+    cljp::Parser parser( reader );
+    cljp::Event event;
+    std::vector< char > block( cljp::ReaderFeed::default_block_size );
+    Source source( r_json );
+    size_t n_events = 0;
+    for(;;)
+    {
+        cljp::Parser::Status status = parser.get( &event );
+        if( status == cljp::Parser::PS_OK )
+            ++n_events;
+        else if( status != cljp::Parser::PS_NEED_MORE_INPUT )
+            return n_events;
+        else if( size_t n_bytes = source.read_some( block.data(), block.size() ).await_resume() )
+            reader.feed( block.data(), n_bytes );
+        else
+            reader.finish();
+    }
+}
+
+Task count_async( const std::string & r_json, size_t * p_n_events_out )
+{
+    cljp::ReaderFeed reader;
+    cljp::Parser parser( reader );
+    Source source( r_json );
+    cljp::AsyncEventGenerator generator = cljp::events_async( parser, reader, source );
+    while( co_await generator.next() )
+        ++*p_n_events_out;
+}
+
+size_t count_async( const std::string & r_json )
+{
+    size_t n_events = 0;
+    count_async( r_json, &n_events );
+    return n_events;
+}
+
+}   // End of anonymous namespace
+
+BENCHMARK( "Parser - Coroutine generators" )
+{
+    std::string json = bench::records_document( 50000 );
+
+    BTHROUGHPUT( "Parser::get() loop, ReaderString", json.size(),
+            bench::keep( count_get( json ) ) );
+    BTHROUGHPUT( "events(), ReaderString", json.size(),
+            bench::keep( count_generated( json ) ) );
+    BTHROUGHPUT( "Parser::get() loop, ReaderFeed", json.size(),
+            bench::keep( count_fed( json ) ) );
+    BTHROUGHPUT( "events_async(), ReaderFeed", json.size(),
+            bench::keep( count_async( json ) ) );
+}
@@ -0,0 +1,101 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull.h"
+
+#include "bench.h"
+
+#include <string>
+
+namespace {
+
+template< typename Tparser >
+size_t count_events( Tparser & parser )
+{
+    cljp::Event event;
+    size_t n_events = 0;
+    while( parser.get( &event ) == cljp::Parser::PS_OK )
+        ++n_events;
+    return n_events;
+}
+
+std::string long_strings_document( size_t n_strings )
+{
+    std::string text;
+    while( text.size() < 2000 )
+        text += "Free text of the sort found in descriptions and comments. ";
+
+    std::string json( "[\n" );
+    for( size_t i = 0; i < n_strings; ++i )
+        json += "        \"" + text + "\",\n";
+    json += "        \"\"\n]\n";
+    return json;
+}
+
+template< typename Tparser >
+void bench_parsers( const char * p_label_no_index, const char * p_label_with_index, const std::string & json )
+{
+    const char * p_begin = json.data();
+    const char * p_end = json.data() + json.size();
+
+    BTHROUGHPUT( p_label_no_index, json.size(),
+            cljp::ReaderMemory reader( p_begin, p_end );
+            Tparser parser( reader );
+            bench::keep( count_events( parser ) ) );
+
+    BTHROUGHPUT( p_label_with_index, json.size(),
+            cljp::ReaderMemory reader( p_begin, p_end );
+            cljp::StructuralIndex index( reader );
+            Tparser parser( reader, index );
+            bench::keep( count_events( parser ) ) );
+}
+
+}   // End of anonymous namespace
+
+BENCHMARK( "StructuralIndex" )
+{
+    std::string json = bench::records_document( 50000 );
+    const char * p_begin = json.data();
+    const char * p_end = json.data() + json.size();
+
+    BTHROUGHPUT( "Build index", json.size(),
+            cljp::StructuralIndex index( p_begin, p_end );
+            bench::keep( index.size() ) );
+
+    bench_parsers< cljp::BasicParser< cljp::ReaderMemory > >(
+            "Records, no index", "Records, with index (inc. build)", json );
+
+    bench_parsers< cljp::BasicParser< cljp::ReaderMemory > >(
+            "Long strings, no index", "Long strings, with index (inc. build)",
+            long_strings_document( 8000 ) );
+}
@@ -0,0 +1,204 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull.h"
+
+#include "bench.h"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+namespace {
+
+std::string telemetry_document( size_t n_samples )
+{
+    // Mostly floating-point numbers, as produced by sensors and metrics feeds
+    std::string json( "[\n" );
+    char buffer[256];
+    for( size_t i = 0; i < n_samples; ++i )
+    {
+        sprintf( buffer,
+                "  { \"t\": %lu, \"temp\": %lu.%03lu, \"humidity\": 0.%04lu, \"pressure\": 1.0%05lue5, "
+                "\"lat\": 51.%06lu, \"lon\": -0.%06lu, \"count\": %lu }%s\n",
+                static_cast< unsigned long >( 1700000000 + i ),
+                static_cast< unsigned long >( i % 40 ), static_cast< unsigned long >( i * 7 % 1000 ),
+                static_cast< unsigned long >( i * 13 % 10000 ), static_cast< unsigned long >( i * 29 % 100000 ),
+                static_cast< unsigned long >( i * 31 % 1000000 ), static_cast< unsigned long >( i * 17 % 1000000 ),
+                static_cast< unsigned long >( i % 100 ),
+                i + 1 < n_samples ? "," : "" );
+        json += buffer;
+    }
+    json += "]\n";
+    return json;
+}
+
+double sum_with_to_float( const std::string & r_json )
+{
+    cljp::ReaderString reader( r_json );
+    cljp::Parser parser( reader );
+    cljp::Event event;
+    double sum = 0.0;
+    while( parser.get( &event ) == cljp::Parser::PS_OK )
+        if( event.is_number() )
+            sum += event.to_float();
+    return sum;
+}
+
+double sum_with_atof( const std::string & r_json )
+{
+    cljp::ReaderString reader( r_json );
+    cljp::Parser parser( reader );
+    cljp::Event event;
+    double sum = 0.0;
+    while( parser.get( &event ) == cljp::Parser::PS_OK )
+        if( event.is_number() )
+            sum += atof( event.value.c_str() );
+    return sum;
+}
+
+size_t classify( const std::string & r_json, bool is_using_flags )
+{
+    // Like a mapper that checks each event against several fields, each
+    // wanting a particular kind of value
+    cljp::ReaderString reader( r_json );
+    cljp::Parser parser( reader );
+    cljp::Event event;
+    size_t n_matches = 0;
+    while( parser.get( &event ) == cljp::Parser::PS_OK )
+    {
+        if( ! is_using_flags )
+            event.flags = 0;    // Makes the methods examine value, as they did before flags were recorded
+        for( int field = 0; field < 4; ++field )
+        {
+            n_matches += event.is_int();
+            n_matches += event.is_true();
+            n_matches += event.is_false();
+        }
+    }
+    return n_matches;
+}
+
+size_t dispatch_by_name( const std::string & r_json )
+{
+    // Like a mapper with a branch for each field of a record
+    cljp::ReaderString reader( r_json );
+    cljp::Parser parser( reader );
+    cljp::Event event;
+    size_t counts[12] = { 0 };
+    while( parser.get( &event ) == cljp::Parser::PS_OK )
+    {
+        if( event.is( "id" ) ) ++counts[1];
+        else if( event.is( "name" ) ) ++counts[2];
+        else if( event.is( "active" ) ) ++counts[3];
+        else if( event.is( "score" ) ) ++counts[4];
+        else if( event.is( "ratio" ) ) ++counts[5];
+        else if( event.is( "tags" ) ) ++counts[6];
+        else if( event.is( "location" ) ) ++counts[7];
+        else if( event.is( "lat" ) ) ++counts[8];
+        else if( event.is( "lon" ) ) ++counts[9];
+        else if( event.is( "label" ) ) ++counts[10];
+        else if( event.is( "description" ) ) ++counts[11];
+        else ++counts[0];
+    }
+    return counts[0] + counts[4] + counts[11];
+}
+
+size_t dispatch_by_key( const std::string & r_json )
+{
+    enum { K_ID = 1, K_NAME, K_ACTIVE, K_SCORE, K_RATIO, K_TAGS, K_LOCATION, K_LAT, K_LON, K_LABEL, K_DESCRIPTION };
+    cljp::KeySet keys;
+    keys.add( "id" ); keys.add( "name" ); keys.add( "active" ); keys.add( "score" ); keys.add( "ratio" );
+    keys.add( "tags" ); keys.add( "location" ); keys.add( "lat" ); keys.add( "lon" ); keys.add( "label" );
+    keys.add( "description" );
+
+    cljp::ReaderString reader( r_json );
+    cljp::Parser parser( reader );
+    parser.use_keys( &keys );
+    cljp::Event event;
+    size_t counts[12] = { 0 };
+    while( parser.get( &event ) == cljp::Parser::PS_OK )
+    {
+        switch( event.key )
+        {
+        case K_ID: ++counts[1]; break;
+        case K_NAME: ++counts[2]; break;
+        case K_ACTIVE: ++counts[3]; break;
+        case K_SCORE: ++counts[4]; break;
+        case K_RATIO: ++counts[5]; break;
+        case K_TAGS: ++counts[6]; break;
+        case K_LOCATION: ++counts[7]; break;
+        case K_LAT: ++counts[8]; break;
+        case K_LON: ++counts[9]; break;
+        case K_LABEL: ++counts[10]; break;
+        case K_DESCRIPTION: ++counts[11]; break;
+        default: ++counts[0]; break;
+        }
+    }
+    return counts[0] + counts[4] + counts[11];
+}
+
+}   // End of anonymous namespace
+
+BENCHMARK( "Event - Number conversion" )
+{
+    std::string json = telemetry_document( 200000 );
+
+    BTHROUGHPUT( "Parser, atof() of each number", json.size(),
+            bench::keep( static_cast< size_t >( sum_with_atof( json ) ) ) );
+
+    BTHROUGHPUT( "Parser, to_float() of each number", json.size(),
+            bench::keep( static_cast< size_t >( sum_with_to_float( json ) ) ) );
+}
+
+BENCHMARK( "Event - Classification" )
+{
+    std::string json = bench::records_document( 50000 );
+
+    BTHROUGHPUT( "Parser, classification from value", json.size(),
+            bench::keep( classify( json, false ) ) );
+
+    BTHROUGHPUT( "Parser, classification from flags", json.size(),
+            bench::keep( classify( json, true ) ) );
+}
+
+BENCHMARK( "Event - Key dispatch" )
+{
+    std::string json = bench::records_document( 50000 );
+
+    BTHROUGHPUT( "Parser, chain of is()", json.size(),
+            bench::keep( dispatch_by_name( json ) ) );
+
+    BTHROUGHPUT( "Parser, switch on key", json.size(),
+            bench::keep( dispatch_by_key( json ) ) );
+}
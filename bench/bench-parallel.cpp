@@ -0,0 +1,166 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull-parallel.h"
+
+#include "bench.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <string>
+#include <thread>
+
+namespace {
+
+std::string records_ndjson( size_t n_records )
+{
+    // The records of bench::records_document(), one per line
+    std::string ndjson;
+    char buffer[512];
+    for( size_t i = 0; i < n_records; ++i )
+    {
+        sprintf( buffer,
+                "{\"id\":%lu,\"name\":\"record %lu\",\"active\":%s,\"score\":%lu.%02lu,"
+                "\"tags\":[\"one\",\"two\",\"three\"],\"location\":{\"lat\":51.%05lu,\"lon\":-0.%05lu,\"label\":null},"
+                "\"description\":\"A longer string value that is typical of free text fields\"}\n",
+                static_cast< unsigned long >( i ), static_cast< unsigned long >( i ), i % 3 ? "true" : "false",
+                static_cast< unsigned long >( i % 1000 ), static_cast< unsigned long >( i % 100 ),
+                static_cast< unsigned long >( i * 31 % 100000 ), static_cast< unsigned long >( i * 17 % 100000 ) );
+        ndjson += buffer;
+    }
+    return ndjson;
+}
+
+std::string records_array( size_t n_records )
+{
+    // The same records as elements of one array
+    std::string array = "[" + records_ndjson( n_records );
+    std::replace( array.begin(), array.end(), '\n', ',' );
+    array[array.size() - 1] = ']';
+    return array;
+}
+
+size_t count_events( cljp::RecordParser & r_parser )
+{
+    cljp::EventView event;
+    size_t n_events = 0;
+    while( r_parser.get( &event ) == cljp::Parser::PS_OK )
+        ++n_events;
+    return n_events;
+}
+
+size_t count_sequentially( const std::string & r_ndjson )
+{
+    // A single parser reading the records as back-to-back messages
+    cljp::ReaderString reader( r_ndjson );
+    cljp::RecordParser parser( reader );
+    size_t n_events = 0;
+    for( size_t n = 1; n; parser.new_message() )
+        n_events += n = count_events( parser );
+    return n_events;
+}
+
+size_t count_unordered( const std::string & r_ndjson, size_t n_threads )
+{
+    cljp::ParallelOptions options;
+    options.n_threads = n_threads;
+    std::atomic< size_t > n_events( 0 );
+    cljp::parse_records_unordered( r_ndjson.data(), r_ndjson.data() + r_ndjson.size(),
+            [&]( cljp::RecordParser & r_parser, size_t ) { n_events += count_events( r_parser ); },
+            options );
+    return n_events;
+}
+
+size_t count_ordered( const std::string & r_ndjson, size_t n_threads )
+{
+    cljp::ParallelOptions options;
+    options.n_threads = n_threads;
+    size_t n_events = 0;
+    cljp::parse_records_ordered< size_t >( r_ndjson.data(), r_ndjson.data() + r_ndjson.size(),
+            []( cljp::RecordParser & r_parser, size_t ) { return count_events( r_parser ); },
+            [&]( size_t n, size_t ) { n_events += n; },
+            options );
+    return n_events;
+}
+
+size_t count_elements( const std::string & r_array, size_t n_threads )
+{
+    cljp::ParallelOptions options;
+    options.n_threads = n_threads;
+    std::atomic< size_t > n_events( 0 );
+    cljp::parse_elements_unordered( r_array.data(), r_array.data() + r_array.size(),
+            [&]( cljp::RecordParser & r_parser, size_t ) { n_events += count_events( r_parser ); },
+            options );
+    return n_events;
+}
+
+}   // End of anonymous namespace
+
+BENCHMARK( "Parallel - NDJSON records" )
+{
+    std::string ndjson = records_ndjson( 200000 );
+    printf( "    (%u hardware threads)\n", std::thread::hardware_concurrency() );
+
+    BTHROUGHPUT( "One parser, back-to-back messages", ndjson.size(),
+            bench::keep( count_sequentially( ndjson ) ) );
+
+    const size_t thread_counts[] = { 1, 2, 4, 8 };
+    for( size_t i = 0; i < sizeof( thread_counts ) / sizeof( thread_counts[0] ); ++i )
+    {
+        char c_label[64];
+        sprintf( c_label, "Unordered, %u threads", static_cast< unsigned int >( thread_counts[i] ) );
+        BTHROUGHPUT( c_label, ndjson.size(),
+                bench::keep( count_unordered( ndjson, thread_counts[i] ) ) );
+        sprintf( c_label, "Ordered, %u threads", static_cast< unsigned int >( thread_counts[i] ) );
+        BTHROUGHPUT( c_label, ndjson.size(),
+                bench::keep( count_ordered( ndjson, thread_counts[i] ) ) );
+    }
+}
+
+BENCHMARK( "Parallel - Elements of an array" )
+{
+    std::string array = records_array( 200000 );
+
+    BTHROUGHPUT( "One parser", array.size(),
+            bench::keep( count_sequentially( array ) ) );
+
+    const size_t thread_counts[] = { 1, 2, 4, 8 };
+    for( size_t i = 0; i < sizeof( thread_counts ) / sizeof( thread_counts[0] ); ++i )
+    {
+        char c_label[64];
+        sprintf( c_label, "Unordered, %u threads", static_cast< unsigned int >( thread_counts[i] ) );
+        BTHROUGHPUT( c_label, array.size(),
+                bench::keep( count_elements( array, thread_counts[i] ) ) );
+    }
+}
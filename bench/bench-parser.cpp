@@ -0,0 +1,292 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull.h"
+
+#include "bench.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+namespace {
+
+class ReaderGetOnly : public cljp::Reader   // A Reader that only implements the per-byte interface
+{
+private:
+    const std::string & r_in;
+    size_t pos;
+
+public:
+    ReaderGetOnly( const std::string & r_in_in ) : r_in( r_in_in ), pos( 0 ) {}
+
+private:
+    virtual int do_get()
+    {
+        if( pos < r_in.size() )
+            return static_cast< unsigned char >( r_in[pos++] );
+        return EOM;
+    }
+    virtual void do_rewind() { pos = 0; }
+};
+
+template< typename Tparser, typename Treader >
+size_t count_events( Treader & reader )
+{
+    Tparser parser( reader );
+    cljp::Event event;
+    size_t n_events = 0;
+    while( parser.get( &event ) == cljp::Parser::PS_OK )
+        ++n_events;
+    return n_events;
+}
+
+size_t parse_short_messages( const std::string & r_message, size_t n_messages )
+{
+    // A parser is created for each message, as when handling a stream of
+    // requests
+    size_t n_events = 0;
+    for( size_t i = 0; i < n_messages; ++i )
+    {
+        cljp::ReaderString reader( r_message );
+        n_events += count_events< cljp::BasicParser< cljp::ReaderMemory > >( reader );
+    }
+    return n_events;
+}
+
+template< typename Tparser >
+size_t skip_by_events( Tparser & parser )
+{
+    // How skip() used to work
+    cljp::Event event;
+    size_t depth = 1;
+    size_t n_events = 0;
+    while( depth > 0 && parser.get( &event ) == cljp::Parser::PS_OK )
+    {
+        ++n_events;
+        if( event.is_object_start() || event.is_array_start() )
+            ++depth;
+        else if( event.is_object_end() || event.is_array_end() )
+            --depth;
+    }
+    return n_events;
+}
+
+template< typename Tparser >
+size_t get_wanted( Tparser & parser, bool is_skip_used )
+{
+    // Reads a document with a large unwanted member followed by the wanted one
+    cljp::Event event;
+    parser.get( &event );
+    parser.get( &event );
+    if( is_skip_used )
+        parser.skip();
+    else
+        skip_by_events( parser );
+    parser.get( &event );
+    return event.value.size();
+}
+
+template< typename Tparser >
+size_t sum_ids_and_lats( Tparser & parser )
+{
+    // Stands in for extracting two of the fields of each record
+    cljp::EventView event;
+    size_t n_found = 0;
+    while( parser.get( &event ) == cljp::Parser::PS_OK )
+        if( event.is( "id" ) || event.is( "lat" ) )
+            ++n_found;
+    return n_found;
+}
+
+void bench_skip( const char * p_label, const std::string & json, cljp::ReadUTF8Base::UTF8Validators validator )
+{
+    // The validator selected also selects how skip() scans the input
+    cljp::ReadUTF8Base::UTF8Validators original = cljp::ReadUTF8Base::utf8_validator();
+    if( ! cljp::ReadUTF8Base::use_utf8_validator( validator ) )
+        return;
+    BTHROUGHPUT( p_label, json.size(),
+            cljp::ReaderString reader( json );
+            cljp::BasicParser< cljp::ReaderMemory > parser( reader );
+            bench::keep( get_wanted( parser, true ) ) );
+    cljp::ReadUTF8Base::use_utf8_validator( original );
+}
+
+size_t count_fed_events( const std::string & r_json, size_t feed_size )
+{
+    // The input is fed as it might arrive from a socket
+    cljp::ReaderFeed reader;
+    cljp::Parser parser( reader );
+    cljp::Event event;
+    size_t n_events = 0;
+    size_t n_fed = 0;
+    for( ;; )
+    {
+        cljp::Parser::Status status = parser.get( &event );
+        if( status == cljp::Parser::PS_OK )
+            ++n_events;
+        else if( status != cljp::Parser::PS_NEED_MORE_INPUT )
+            return n_events;
+        else if( n_fed < r_json.size() )
+        {
+            size_t n_bytes = std::min( feed_size, r_json.size() - n_fed );
+            reader.feed( r_json.data() + n_fed, n_bytes );
+            n_fed += n_bytes;
+        }
+        else
+            reader.finish();
+    }
+}
+
+}   // End of anonymous namespace
+
+BENCHMARK( "Parser - Virtual vs. template reader dispatch" )
+{
+    std::string json = bench::records_document( 50000 );
+
+    BTHROUGHPUT( "Parser, get() only Reader", json.size(),
+            ReaderGetOnly reader( json );
+            bench::keep( count_events< cljp::Parser >( reader ) ) );
+
+    BTHROUGHPUT( "Parser, ReaderString", json.size(),
+            cljp::ReaderString reader( json );
+            bench::keep( count_events< cljp::Parser >( reader ) ) );
+
+    BTHROUGHPUT( "BasicParser< ReaderMemory >, ReaderString", json.size(),
+            cljp::ReaderString reader( json );
+            bench::keep( count_events< cljp::BasicParser< cljp::ReaderMemory > >( reader ) ) );
+}
+
+BENCHMARK( "Parser - Parser per short message" )
+{
+    std::string message( "{\"id\":42,\"op\":\"get\",\"keys\":[1,2]}" );
+    const size_t n_messages = 1000000;
+
+    BRATE( "BasicParser< ReaderMemory >, messages", n_messages,
+            bench::keep( parse_short_messages( message, n_messages ) ) );
+}
+
+BENCHMARK( "Parser - skip()" )
+{
+    std::string json = "{\"unwanted\":" + bench::records_document( 50000 ) + ",\"wanted\":1}";
+
+    BTHROUGHPUT( "Skip by getting events", json.size(),
+            cljp::ReaderString reader( json );
+            cljp::BasicParser< cljp::ReaderMemory > parser( reader );
+            bench::keep( get_wanted( parser, false ) ) );
+
+    bench_skip( "skip(), scalar", json, cljp::ReadUTF8Base::UV_SCALAR );
+    bench_skip( "skip(), SSE4.2", json, cljp::ReadUTF8Base::UV_SSE42 );
+}
+
+BENCHMARK( "Parser - Projection" )
+{
+    std::string json = bench::records_document( 50000 );
+
+    BTHROUGHPUT( "All events", json.size(),
+            cljp::ReaderString reader( json );
+            cljp::BasicParser< cljp::ReaderMemory > parser( reader );
+            bench::keep( sum_ids_and_lats( parser ) ) );
+
+    cljp::Projection projection;
+    projection.add( "/*/id" );
+
+    BTHROUGHPUT( "Projection of id", json.size(),
+            cljp::ReaderString reader( json );
+            cljp::BasicParser< cljp::ReaderMemory > parser( reader );
+            parser.use_projection( &projection );
+            bench::keep( sum_ids_and_lats( parser ) ) );
+
+    projection.add( "/*/location/lat" );
+
+    BTHROUGHPUT( "Projection of id and location/lat", json.size(),
+            cljp::ReaderString reader( json );
+            cljp::BasicParser< cljp::ReaderMemory > parser( reader );
+            parser.use_projection( &projection );
+            bench::keep( sum_ids_and_lats( parser ) ) );
+
+    cljp::Projection first_record;
+    first_record.add( "/0" );
+
+    BTHROUGHPUT( "Projection of first record", json.size(),
+            cljp::ReaderString reader( json );
+            cljp::BasicParser< cljp::ReaderMemory > parser( reader );
+            parser.use_projection( &first_record );
+            bench::keep( sum_ids_and_lats( parser ) ) );
+}
+
+BENCHMARK( "Parser - Projection with many paths" )
+{
+    // Each projection selects the id of each record, along with paths that
+    // match nothing, as when extracting many fields of which few are present
+    std::string json = bench::records_document( 50000 );
+    const size_t path_counts[] = { 1, 10, 100, 1000 };
+
+    for( size_t i = 0; i < sizeof( path_counts ) / sizeof( path_counts[0] ); ++i )
+    {
+        cljp::Projection projection;
+        projection.add( "/*/id" );
+        for( size_t n = 1; n < path_counts[i]; ++n )
+        {
+            char c_path[32];
+            sprintf( c_path, "/*/unused_%u", static_cast< unsigned int >( n ) );
+            projection.add( c_path );
+        }
+
+        char c_label[32];
+        sprintf( c_label, "%u paths", static_cast< unsigned int >( path_counts[i] ) );
+        BTHROUGHPUT( c_label, json.size(),
+                cljp::ReaderString reader( json );
+                cljp::BasicParser< cljp::ReaderMemory > parser( reader );
+                parser.use_projection( &projection );
+                bench::keep( sum_ids_and_lats( parser ) ) );
+    }
+}
+
+BENCHMARK( "Parser - Fed input" )
+{
+    std::string json = bench::records_document( 50000 );
+
+    BTHROUGHPUT( "Parser, ReaderString", json.size(),
+            cljp::ReaderString reader( json );
+            bench::keep( count_events< cljp::Parser >( reader ) ) );
+
+    const size_t feed_sizes[] = { 16, 1460, 64 * 1024 };
+    for( size_t i = 0; i < sizeof( feed_sizes ) / sizeof( feed_sizes[0] ); ++i )
+    {
+        char c_label[64];
+        sprintf( c_label, "ReaderFeed, fed %u bytes at a time", static_cast< unsigned int >( feed_sizes[i] ) );
+        BTHROUGHPUT( c_label, json.size(),
+                bench::keep( count_fed_events( json, feed_sizes[i] ) ) );
+    }
+}
@@ -0,0 +1,122 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull-prefetch.h"
+
+#include "bench.h"
+
+#include <algorithm>
+#include <chrono>
+#include <string>
+#include <thread>
+
+namespace {
+
+class ReaderDevice : public cljp::Reader    // Emulates a file or pipe that takes time to deliver each block
+{
+public:
+    enum { block_size = 64 * 1024 };
+
+private:
+    const std::string & r_in;
+    size_t pos;
+    size_t n_peeked;    // Bytes of the current block, once its delay has passed
+    std::chrono::microseconds delay;
+
+public:
+    ReaderDevice( const std::string & r_in_in, long delay_us )
+        : r_in( r_in_in ), pos( 0 ), n_peeked( 0 ), delay( delay_us )
+    {}
+
+private:
+    virtual int do_get()
+    {
+        const char * p_block = 0;
+        if( do_peek( &p_block ) == 0 )
+            return EOM;
+        do_consume( 1 );
+        return static_cast< unsigned char >( *p_block );
+    }
+    virtual size_t do_peek( const char * * pp_block_out )
+    {
+        if( n_peeked == 0 && pos < r_in.size() )
+        {
+            if( delay.count() )
+                std::this_thread::sleep_for( delay );
+            n_peeked = std::min( r_in.size() - pos, size_t( block_size ) );
+        }
+        *pp_block_out = r_in.data() + pos;
+        return n_peeked;
+    }
+    virtual void do_consume( size_t n_bytes ) { pos += n_bytes; n_peeked -= n_bytes; }
+    virtual void do_rewind() { pos = n_peeked = 0; }
+};
+
+size_t count_events( cljp::Reader & r_reader )
+{
+    cljp::Parser parser( r_reader );
+    cljp::EventView event;
+    size_t n_events = 0;
+    while( parser.get( &event ) == cljp::Parser::PS_OK )
+        ++n_events;
+    return n_events;
+}
+
+size_t count_direct( const std::string & r_json, long delay_us )
+{
+    ReaderDevice device( r_json, delay_us );
+    return count_events( device );
+}
+
+size_t count_prefetched( const std::string & r_json, long delay_us )
+{
+    ReaderDevice device( r_json, delay_us );
+    cljp::ReaderPrefetch reader( device );
+    return count_events( reader );
+}
+
+}   // End of anonymous namespace
+
+BENCHMARK( "Reader - Prefetching on a background thread" )
+{
+    std::string json = bench::records_document( 50000 );
+
+    BTHROUGHPUT( "No delay, read directly", json.size(),
+            bench::keep( count_direct( json, 0 ) ) );
+    BTHROUGHPUT( "No delay, ReaderPrefetch", json.size(),
+            bench::keep( count_prefetched( json, 0 ) ) );
+    BTHROUGHPUT( "300us per 64 KiB block, read directly", json.size(),
+            bench::keep( count_direct( json, 300 ) ) );
+    BTHROUGHPUT( "300us per 64 KiB block, ReaderPrefetch", json.size(),
+            bench::keep( count_prefetched( json, 300 ) ) );
+}
@@ -0,0 +1,93 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull.h"
+
+#include "bench.h"
+
+#include <string>
+
+namespace {
+
+size_t count_events( const std::string & r_json )
+{
+    cljp::ReaderString reader( r_json );
+    cljp::BasicParser< cljp::ReaderMemory > parser( reader );
+    cljp::EventView event;
+    size_t n_events = 0;
+    while( parser.get( &event ) == cljp::Parser::PS_OK )
+        ++n_events;
+    return n_events;
+}
+
+size_t build_tape( const std::string & r_json, cljp::Tape * p_tape )
+{
+    cljp::ReaderString reader( r_json );
+    cljp::BasicParser< cljp::ReaderMemory > parser( reader );
+    p_tape->build( parser );
+    return p_tape->size();
+}
+
+size_t sum_lats( const cljp::Tape & r_tape )
+{
+    // Visits each record, skipping over its other members
+    size_t sum = 0;
+    for( cljp::Tape::Value record = r_tape.root().first(); record.is_valid(); record = record.next() )
+    {
+        cljp::EventView event;
+        record.find( "location" ).find( "lat" ).to_event( &event );
+        sum += static_cast< size_t >( event.to_float() );
+    }
+    return sum;
+}
+
+}   // End of anonymous namespace
+
+BENCHMARK( "Tape" )
+{
+    std::string json = bench::records_document( 50000 );
+
+    BTHROUGHPUT( "Parser, events only", json.size(),
+            bench::keep( count_events( json ) ) );
+
+    BTHROUGHPUT( "Build, new tape each time", json.size(),
+            cljp::Tape tape;
+            bench::keep( build_tape( json, &tape ) ) );
+
+    cljp::Tape reused_tape;
+    BTHROUGHPUT( "Build, reused tape", json.size(),
+            bench::keep( build_tape( json, &reused_tape ) ) );
+
+    BRATE( "Find location/lat of each record", 50000,
+            bench::keep( sum_lats( reused_tape ) ) );
+}
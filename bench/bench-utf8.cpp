@@ -0,0 +1,127 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull.h"
+
+#include "bench.h"
+
+#include <string>
+
+namespace {
+
+std::string non_latin_text( size_t n_bytes )
+{
+    // Mixture of 2, 3 and 4 byte sequences with a little ASCII.  ReadUTF8
+    // expects input to start with an ASCII character.
+    std::string text( "\"" );
+    while( text.size() < n_bytes )
+        text += "\xd0\x9f\xd1\x80\xd0\xb8\xd0\xb2\xd0\xb5\xd1\x82 \xe6\x97\xa5\xe6\x9c\xac\xe8\xaa\x9e "
+                "\xce\xb1\xce\xb2\xce\xb3 \xf0\x9f\x98\x80 \xe0\xa4\xb9\xe0\xa4\xbf\xe0\xa4\xa8\xe0\xa5\x8d\xe0\xa4\xa6\xe0\xa5\x80 ";
+    return text;
+}
+
+size_t read_all( const std::string & text )
+{
+    cljp::ReaderString reader( text );
+    cljp::ReadUTF8 utf8_reader( reader );
+    size_t n_bytes = 0;
+    for(;;)
+    {
+        // Take validated spans whole so that validation dominates the timing
+        const char * p_span_end = utf8_reader.span_end();
+        if( p_span_end != utf8_reader.span_begin() )
+        {
+            n_bytes += p_span_end - utf8_reader.span_begin();
+            utf8_reader.span_advance_to( p_span_end );
+        }
+        else if( utf8_reader.get() != cljp::Reader::EOM )
+            ++n_bytes;
+        else
+            break;
+    }
+    return n_bytes;
+}
+
+void bench_validator( const char * p_label, const std::string & text, cljp::ReadUTF8Base::UTF8Validators validator )
+{
+    cljp::ReadUTF8Base::UTF8Validators original = cljp::ReadUTF8Base::utf8_validator();
+    if( ! cljp::ReadUTF8Base::use_utf8_validator( validator ) )
+        return;
+    BTHROUGHPUT( p_label, text.size(), bench::keep( read_all( text ) ) );
+    cljp::ReadUTF8Base::use_utf8_validator( original );
+}
+
+std::string to_utf16le( const std::string & ascii )
+{
+    std::string utf16le;
+    utf16le.reserve( ascii.size() * 2 );
+    for( size_t i = 0; i < ascii.size(); ++i )
+    {
+        utf16le += ascii[i];
+        utf16le += '\0';
+    }
+    return utf16le;
+}
+
+size_t count_events( const std::string & json )
+{
+    cljp::ReaderString reader( json );
+    cljp::Parser parser( reader );
+    cljp::Event event;
+    size_t n_events = 0;
+    while( parser.get( &event ) == cljp::Parser::PS_OK )
+        ++n_events;
+    return n_events;
+}
+
+}   // End of anonymous namespace
+
+BENCHMARK( "ReadUTF8 - UTF-8 validators" )
+{
+    std::string text = non_latin_text( 16 * 1024 * 1024 );
+
+    bench_validator( "Non-Latin text, scalar", text, cljp::ReadUTF8Base::UV_SCALAR );
+    bench_validator( "Non-Latin text, SSE4.2", text, cljp::ReadUTF8Base::UV_SSE42 );
+    bench_validator( "Non-Latin text, AVX2", text, cljp::ReadUTF8Base::UV_AVX2 );
+}
+
+BENCHMARK( "ReadUTF8 - UTF-16LE transcoding" )
+{
+    std::string utf16le = to_utf16le( bench::records_document( 50000 ) );
+
+    bench_validator( "UTF-16LE records, scalar", utf16le, cljp::ReadUTF8Base::UV_SCALAR );
+    bench_validator( "UTF-16LE records, SSE4.2", utf16le, cljp::ReadUTF8Base::UV_SSE42 );
+
+    BTHROUGHPUT( "UTF-16LE records, Parser", utf16le.size(),
+            bench::keep( count_events( utf16le ) ) );
+}
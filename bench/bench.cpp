@@ -0,0 +1,85 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull.h"
+
+#include "bench.h"
+
+#include <cstdio>
+#include <string>
+
+namespace bench {
+
+std::string records_document( size_t n_records )
+{
+    static const char * p_names[] = { "alpha", "bravo", "charlie", "delta", "echo \\\"quoted\\\"" };
+
+    std::string json( "[\n" );
+    char buffer[512];
+    for( size_t i = 0; i < n_records; ++i )
+    {
+        sprintf( buffer,
+                "  {\n"
+                "    \"id\": %llu,\n"
+                "    \"name\": \"%s\",\n"
+                "    \"active\": %s,\n"
+                "    \"score\": %lu.%02lu,\n"
+                "    \"ratio\": -%lu.%lue-3,\n"
+                "    \"tags\": [ \"one\", \"two\", \"three\" ],\n"
+                "    \"location\": { \"lat\": 51.%05lu, \"lon\": -0.%05lu, \"label\": null },\n"
+                "    \"description\": \"A longer string value that is typical of free text fields\"\n"
+                "  }%s\n",
+                9007199254740993ull + i * 7919,
+                p_names[i % 5],
+                i % 3 ? "true" : "false",
+                static_cast< unsigned long >( i % 1000 ), static_cast< unsigned long >( i % 100 ),
+                static_cast< unsigned long >( i % 7 ), static_cast< unsigned long >( i % 997 ),
+                static_cast< unsigned long >( i * 31 % 100000 ), static_cast< unsigned long >( i * 17 % 100000 ),
+                i + 1 < n_records ? "," : "" );
+        json += buffer;
+    }
+    json += "]\n";
+    return json;
+}
+
+}   // End of namespace bench
+
+int main( int argc, char * argv[] )
+{
+    if( argc > 1 )
+        bench::n_runs() = atoi( argv[1] );
+
+    bench::run_all();
+
+    return 0;
+}
@@ -0,0 +1,148 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------
+// A minimal benchmark framework for cl-json-pull.  Benchmarks are registered
+// in the same way as clunit tests:
+//
+//    BENCHMARK( "Descriptive name" )
+//    {
+//        std::string json = bench::records_document( 10000 );
+//        BTHROUGHPUT( "Parser", json.size(), parse_all( json ) );
+//    }
+//
+// BTHROUGHPUT() times the expression a number of times and reports the best
+// time as MB/s.  BRATE() does the same but reports operations per second.
+//----------------------------------------------------------------------------
+
+#ifndef CLJP_BENCH_H
+#define CLJP_BENCH_H
+
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace bench {
+
+typedef void (*bench_func_t)();
+
+struct Registration
+{
+    bench_func_t func;
+    const char * p_description;
+};
+
+inline std::vector< Registration > & registry()
+{
+    static std::vector< Registration > benchmarks;
+    return benchmarks;
+}
+
+struct Registrar
+{
+    Registrar( bench_func_t func, const char * p_description )
+    {
+        Registration registration = { func, p_description };
+        registry().push_back( registration );
+    }
+};
+
+inline int & n_runs()
+{
+    static int runs = 5;
+    return runs;
+}
+
+template< typename Tfunc >
+double best_seconds( Tfunc func )
+{
+    double best = 1e300;
+    for( int i = 0; i < n_runs(); ++i )
+    {
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        func();
+        std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - start;
+        if( elapsed.count() < best )
+            best = elapsed.count();
+    }
+    return best;
+}
+
+inline void report_throughput( const char * p_label, size_t n_bytes, double seconds )
+{
+    printf( "    %-48s %10.1f MB/s\n", p_label, n_bytes / seconds / 1e6 );
+}
+
+inline void report_rate( const char * p_label, size_t n_operations, double seconds )
+{
+    printf( "    %-48s %10.2f M/s\n", p_label, n_operations / seconds / 1e6 );
+}
+
+inline void run_all()
+{
+    for( size_t i = 0; i < registry().size(); ++i )
+    {
+        printf( "%s\n", registry()[i].p_description );
+        registry()[i].func();
+        printf( "\n" );
+    }
+}
+
+// Prevents the optimiser discarding results
+inline void keep( size_t value )
+{
+    static volatile size_t sink;
+    sink = value;
+    (void)sink;     // Stops -Wunused-but-set-variable
+}
+
+// A document consisting of an array of n_records moderately sized records,
+// similar to a log or API dump
+std::string records_document( size_t n_records );
+
+}   // End of namespace bench
+
+#define BCAT( x, y ) BCAT2( x, y )
+#define BCAT2( x, y ) x ## y
+
+#define BENCHMARK( d ) BENCHMARK_IMPL( d, BCAT( bench_func_, __LINE__ ) )
+#define BENCHMARK_IMPL( d, f ) static void f(); \
+            static bench::Registrar BCAT( f, _registrar )( f, d ); static void f()
+
+#define BTHROUGHPUT( label, n_bytes, x ) \
+            bench::report_throughput( label, n_bytes, bench::best_seconds( [&]() { x; } ) )
+#define BRATE( label, n_operations, x ) \
+            bench::report_rate( label, n_operations, bench::best_seconds( [&]() { x; } ) )
+
+#endif  // CLJP_BENCH_H
@@ -0,0 +1,411 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------
+// Description: Reads JSON objects directly into C++ structs.  The members of
+//              a struct are described once, using the CLJP_BIND_... macros,
+//              and cljp::bind::read() then pulls events from a parser and
+//              assigns each value to its member, without building a DOM or
+//              copying names and strings that aren't kept.
+//
+//              struct Point { double x; double y; std::string label; };
+//
+//              CLJP_BIND_BEGIN( Point )
+//                  CLJP_BIND_MEMBER( x )
+//                  CLJP_BIND_MEMBER( y )
+//                  CLJP_BIND_MEMBER_NAMED( label, "name" )
+//              CLJP_BIND_END()
+//
+//              Point point;
+//              cljp::Parser::Status status = cljp::bind::read( parser, &point );
+//
+//              The macros must be used outside any namespace.  Members may
+//              be bool, arithmetic types, std::string, std::vector of a
+//              supported type (other than bool), or structs that are
+//              themselves bound.
+//              Members that aren't bound are skipped, and a null value
+//              leaves its member unchanged.  A value of the wrong JSON type
+//              gives PS_UNEXPECTED_VALUE_TYPE.  Integers are converted as by
+//              Event::to_int64() and clamped to the range of the member.
+//              read() reads the whole value in one call, so with a
+//              ReaderFeed the value must have been fed before it is called.
+//----------------------------------------------------------------------------
+
+#ifndef CL_JSON_PULL_BIND_H
+#define CL_JSON_PULL_BIND_H
+
+#include "cl-json-pull.h"
+
+#include <string>
+#include <vector>
+#include <limits>
+
+namespace cljp {    // Codalogic JSON Pull (Parser)
+
+template< typename T >
+struct Binding;     // Specialised by CLJP_BIND_BEGIN() for each bound struct
+
+#define CLJP_BIND_BEGIN( T ) \
+    namespace cljp { \
+    template<> struct Binding< T > \
+    { \
+        typedef T Type; \
+        template< typename Tvisitor > \
+        static void visit( Tvisitor & r_visitor ) \
+        {
+
+#define CLJP_BIND_MEMBER( member ) \
+            r_visitor.visit_member( #member, &Type::member );
+
+#define CLJP_BIND_MEMBER_NAMED( member, p_name ) \
+            r_visitor.visit_member( p_name, &Type::member );
+
+#define CLJP_BIND_END() \
+        } \
+    }; \
+    }
+
+namespace bind {
+
+typedef ParserBase::Status Status;
+
+// Each read_value() reads the value whose first event is *p_event into
+// *p_out, using p_event for any further events of the value
+
+template< typename Tparser >
+Status read_value( Tparser & r_parser, EventView * p_event, bool * p_out );
+template< typename Tparser >
+Status read_value( Tparser & r_parser, EventView * p_event, std::string * p_out );
+template< typename Tparser, typename T >
+Status read_value( Tparser & r_parser, EventView * p_event, std::vector< T > * p_out );
+template< typename Tparser, typename T >
+Status read_value( Tparser & r_parser, EventView * p_event, T * p_out );
+
+template< typename Tparser, typename T >
+Status read( Tparser & r_parser, T * p_out )
+{
+    // Reads one value, e.g. a whole message, into *p_out
+
+    EventView event;
+    Status status = r_parser.get( &event );
+    if( status != ParserBase::PS_OK )
+        return status;
+    return read_value( r_parser, &event, p_out );
+}
+
+inline Status type_error()
+{
+    #if CLJP_THROW_ERRORS == 1
+        throw ParserException( ParserBase::PS_UNEXPECTED_VALUE_TYPE );
+    #endif
+
+    return ParserBase::PS_UNEXPECTED_VALUE_TYPE;
+}
+
+template< typename Tparser >
+Status skip_value( Tparser & r_parser, const EventView & r_event )
+{
+    if( r_event.is_object_start() || r_event.is_array_start() )
+        return r_parser.skip();
+    return ParserBase::PS_OK;
+}
+
+//----------------------------------------------------------------------------
+//                                 Scalars
+//----------------------------------------------------------------------------
+
+template< typename Tparser >
+Status read_value( Tparser &, EventView * p_event, bool * p_out )
+{
+    if( p_event->is_boolean() )
+        *p_out = p_event->is_true();
+    else if( ! p_event->is_null() )
+        return type_error();
+    return ParserBase::PS_OK;
+}
+
+template< typename Tparser >
+Status read_value( Tparser &, EventView * p_event, std::string * p_out )
+{
+    if( p_event->is_string() )
+        p_out->assign( p_event->value.data(), p_event->value.size() );
+    else if( ! p_event->is_null() )
+        return type_error();
+    return ParserBase::PS_OK;
+}
+
+template< typename T, bool is_signed >
+struct Number
+{
+    static T from( const EventView & r_event )
+    {
+        int64_t value = r_event.to_int64();
+        if( value > static_cast< int64_t >( std::numeric_limits< T >::max() ) )
+            return std::numeric_limits< T >::max();
+        if( value < static_cast< int64_t >( std::numeric_limits< T >::min() ) )
+            return std::numeric_limits< T >::min();
+        return static_cast< T >( value );
+    }
+};
+
+template< typename T >
+struct Number< T, false >
+{
+    static T from( const EventView & r_event )
+    {
+        uint64_t value = r_event.to_uint64();
+        if( value > static_cast< uint64_t >( std::numeric_limits< T >::max() ) )
+            return std::numeric_limits< T >::max();
+        return static_cast< T >( value );
+    }
+};
+
+template< typename T, bool is_integer >
+struct Arithmetic
+{
+    static Status read( EventView * p_event, T * p_out )
+    {
+        if( p_event->is_number() )
+            *p_out = Number< T, std::numeric_limits< T >::is_signed >::from( *p_event );
+        else if( ! p_event->is_null() )
+            return type_error();
+        return ParserBase::PS_OK;
+    }
+};
+
+template< typename T >
+struct Arithmetic< T, false >   // Floating-point
+{
+    static Status read( EventView * p_event, T * p_out )
+    {
+        if( p_event->is_number() )
+            *p_out = static_cast< T >( p_event->to_float() );
+        else if( ! p_event->is_null() )
+            return type_error();
+        return ParserBase::PS_OK;
+    }
+};
+
+//----------------------------------------------------------------------------
+//                                 Arrays
+//----------------------------------------------------------------------------
+
+template< typename Tparser, typename T >
+Status read_value( Tparser & r_parser, EventView * p_event, std::vector< T > * p_out )
+{
+    if( p_event->is_null() )
+        return ParserBase::PS_OK;
+    if( ! p_event->is_array_start() )
+        return type_error();
+
+    p_out->clear();
+    for( ; ; )
+    {
+        Status status = r_parser.get( p_event );
+        if( status != ParserBase::PS_OK )
+            return status;
+        if( p_event->is_array_end() )
+            return ParserBase::PS_OK;
+        p_out->push_back( T() );
+        status = read_value( r_parser, p_event, &p_out->back() );
+        if( status != ParserBase::PS_OK )
+            return status;
+    }
+}
+
+//----------------------------------------------------------------------------
+//                                 Structs
+//----------------------------------------------------------------------------
+
+template< typename T >
+class BoundKeys
+{
+    // The KeySet of the member names of a bound struct.  Key n is the nth
+    // member described by the CLJP_BIND_... macros.
+
+private:
+    struct Adder
+    {
+        KeySet & r_keys;
+
+        Adder( KeySet & r_keys_in ) : r_keys( r_keys_in ) {}
+        template< typename Tmember, typename Tclass >
+        void visit_member( const char * p_name, Tmember Tclass::* )
+        {
+            int key = r_keys.add( p_name );
+            assert( key == static_cast< int >( r_keys.size() ) );   // Member names must be distinct
+            (void)key;
+        }
+    };
+
+    static KeySet make()
+    {
+        KeySet keys;
+        Adder adder( keys );
+        Binding< T >::visit( adder );
+        keys.compile();
+        return keys;
+    }
+
+public:
+    static const KeySet & get()
+    {
+        // Made on the first read of the type, which compilers before C++11
+        // may not make thread-safe
+        static const KeySet keys( make() );
+        return keys;
+    }
+};
+
+template< typename Tparser, typename T >
+class MemberReader
+{
+    // Reads the value of the member whose key is given.  As the members are
+    // known at compile time, the visit is expanded to a sequence of
+    // integer comparisons, each followed by the reader for its type.
+
+private:
+    struct Members {
+        Tparser & r_parser;
+        EventView * p_event;
+        T * p_out;
+        int key;
+        int n_members;
+        Status status;
+
+        Members( Tparser & r_parser_in, EventView * p_event_in, T * p_out_in, int key_in )
+            : r_parser( r_parser_in ), p_event( p_event_in ), p_out( p_out_in ), key( key_in ),
+                n_members( 0 ), status( ParserBase::PS_OK )
+        {}
+    } m;
+
+public:
+    MemberReader( Tparser & r_parser_in, EventView * p_event_in, T * p_out_in, int key_in )
+        : m( r_parser_in, p_event_in, p_out_in, key_in )
+    {}
+
+    template< typename Tmember, typename Tclass >
+    void visit_member( const char *, Tmember Tclass::* p_member )
+    {
+        if( ++m.n_members == m.key )
+            m.status = read_value( m.r_parser, m.p_event, &(m.p_out->*p_member) );
+    }
+
+    Status status() const { return m.status; }
+};
+
+template< typename Tparser >
+class KeysInUse
+{
+    // Ensures the parser's keys are restored even if an exception is thrown
+
+private:
+    Tparser & r_parser;
+    const KeySet * p_previous_keys;
+
+public:
+    KeysInUse( Tparser & r_parser_in, const KeySet * p_keys )
+        : r_parser( r_parser_in ), p_previous_keys( r_parser_in.keys() )
+    {
+        r_parser.use_keys( p_keys );
+    }
+    ~KeysInUse() { r_parser.use_keys( p_previous_keys ); }
+};
+
+template< typename Tparser, typename T >
+Status read_struct( Tparser & r_parser, EventView * p_event, T * p_out )
+{
+    if( ! p_event->is_object_start() )
+        return type_error();
+
+    KeysInUse< Tparser > keys_in_use( r_parser, &BoundKeys< T >::get() );
+
+    for( ; ; )
+    {
+        Status status = r_parser.get( p_event );
+        if( status != ParserBase::PS_OK )
+            return status;
+        if( p_event->is_object_end() )
+            return ParserBase::PS_OK;
+
+        if( p_event->key == KeySet::K_UNKNOWN )
+        {
+            status = skip_value( r_parser, *p_event );
+        }
+        else
+        {
+            MemberReader< Tparser, T > reader( r_parser, p_event, p_out, p_event->key );
+            Binding< T >::visit( reader );
+            status = reader.status();
+        }
+        if( status != ParserBase::PS_OK )
+            return status;
+    }
+}
+
+template< typename T, bool is_arithmetic >
+struct ValueReader      // Bound structs
+{
+    template< typename Tparser >
+    static Status read( Tparser & r_parser, EventView * p_event, T * p_out )
+    {
+        if( p_event->is_null() )
+            return ParserBase::PS_OK;
+        return read_struct( r_parser, p_event, p_out );
+    }
+};
+
+template< typename T >
+struct ValueReader< T, true >
+{
+    template< typename Tparser >
+    static Status read( Tparser &, EventView * p_event, T * p_out )
+    {
+        return Arithmetic< T, std::numeric_limits< T >::is_integer >::read( p_event, p_out );
+    }
+};
+
+template< typename Tparser, typename T >
+Status read_value( Tparser & r_parser, EventView * p_event, T * p_out )
+{
+    // Arithmetic types and bound structs.  (bool, std::string and
+    // std::vector have their own overloads.)
+
+    return ValueReader< T, std::numeric_limits< T >::is_specialized >::read( r_parser, p_event, p_out );
+}
+
+}   // End of namespace bind
+
+}   // End of namespace cljp
+
+#endif  // CL_JSON_PULL_BIND_H
@@ -50,4 +50,24 @@
 #define CLJP_THROW_ERRORS 0
 #endif
 
+//----------------------------------------------------------------------------
+// Config:  SIMD - Set CLJP_USE_SIMD to 0 to disable the use of vector
+//          instructions (selected at run-time according to the CPU) when
+//          validating UTF-8 input.
+//----------------------------------------------------------------------------
+
+#ifndef CLJP_USE_SIMD
+#define CLJP_USE_SIMD 1
+#endif
+
+//----------------------------------------------------------------------------
+// Config:  Nesting - CLJP_INLINE_NESTING_DEPTH is the depth of nested objects
+//          and arrays that the parser can track without allocating memory.
+//          Deeper nesting is still allowed, but uses the heap.
+//----------------------------------------------------------------------------
+
+#ifndef CLJP_INLINE_NESTING_DEPTH
+#define CLJP_INLINE_NESTING_DEPTH 64
+#endif
+
 #endif  // CL_JSON_PULL_H
@@ -0,0 +1,284 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------
+// Description: Coroutine interfaces to the parser.  events() is a generator
+//              that yields the events of a message, so they can be read with
+//              a range-based for loop.  events_async() does the same for
+//              input that arrives in pieces, such as from a socket, from
+//              within a coroutine.  When the parser has read all the input
+//              fed to its ReaderFeed, the generator co_awaits a block of
+//              input from an asynchronous source, so it only suspends when
+//              the block is used up, not for each event or byte.
+//
+//              This header requires C++20.
+//----------------------------------------------------------------------------
+
+#ifndef CL_JSON_PULL_COROUTINE_H
+#define CL_JSON_PULL_COROUTINE_H
+
+#include "cl-json-pull.h"
+
+#include <coroutine>
+#include <cstddef>
+#include <exception>
+#include <iterator>
+#include <utility>
+#include <vector>
+
+namespace cljp {    // Codalogic JSON Pull (Parser)
+
+//----------------------------------------------------------------------------
+//                            class EventGenerator
+//----------------------------------------------------------------------------
+
+class EventGenerator
+{
+    // Returned by events().  The events are those that Parser::get() would
+    // return, up to the first status other than PS_OK, which is then
+    // returned by status().  Each event is only valid until the next one is
+    // read.
+
+public:
+    struct promise_type
+    {
+        const Event * p_event;
+        ParserBase::Status status;
+        std::exception_ptr p_exception;
+
+        promise_type() : p_event( 0 ), status( ParserBase::PS_OK ) {}
+        EventGenerator get_return_object() { return EventGenerator( handle::from_promise( *this ) ); }
+        std::suspend_always initial_suspend() noexcept { return std::suspend_always(); }
+        std::suspend_always final_suspend() noexcept { return std::suspend_always(); }
+        std::suspend_always yield_value( const Event & r_event ) noexcept
+        {
+            p_event = &r_event;
+            return std::suspend_always();
+        }
+        void return_value( ParserBase::Status status_in ) { p_event = 0; status = status_in; }
+        void unhandled_exception() { p_event = 0; p_exception = std::current_exception(); }
+    };
+
+    typedef std::coroutine_handle< promise_type > handle;
+
+    class iterator
+    {
+    private:
+        EventGenerator * p_generator;
+
+    public:
+        typedef std::input_iterator_tag iterator_category;
+        typedef Event value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const Event * pointer;
+        typedef const Event & reference;
+
+        iterator( EventGenerator * p_generator_in = 0 ) : p_generator( p_generator_in ) {}
+        const Event & operator * () const { return *p_generator->m.coroutine.promise().p_event; }
+        const Event * operator -> () const { return p_generator->m.coroutine.promise().p_event; }
+        iterator & operator ++ () { p_generator->next(); return *this; }
+        void operator ++ ( int ) { p_generator->next(); }
+        bool operator == ( std::default_sentinel_t ) const { return p_generator->is_done(); }
+    };
+
+private:
+    struct Members {
+        handle coroutine;
+
+        Members( handle coroutine_in ) : coroutine( coroutine_in ) {}
+    } m;
+
+public:
+    EventGenerator( EventGenerator && r_rhs ) : m( std::exchange( r_rhs.m.coroutine, nullptr ) ) {}
+    ~EventGenerator() { if( m.coroutine ) m.coroutine.destroy(); }
+
+    // NULL once there are no more events
+    const Event * next()
+    {
+        if( ! m.coroutine.done() )
+            m.coroutine.resume();
+        if( m.coroutine.promise().p_exception )
+            std::rethrow_exception( std::exchange( m.coroutine.promise().p_exception, nullptr ) );
+        return m.coroutine.promise().p_event;
+    }
+
+    iterator begin() { next(); return iterator( this ); }
+    std::default_sentinel_t end() const { return std::default_sentinel; }
+
+    bool is_done() const { return m.coroutine.done(); }
+    ParserBase::Status status() const { return m.coroutine.promise().status; }
+
+private:
+    explicit EventGenerator( handle coroutine_in ) : m( coroutine_in ) {}
+    EventGenerator( const EventGenerator & );               // Not implemented
+    EventGenerator & operator = ( const EventGenerator & ); // Not implemented
+};
+
+// The parser must outlive the generator.  Call Parser::new_message(), and
+// then events() again, to read the next message.
+template< typename Treader >
+EventGenerator events( BasicParser< Treader > & r_parser )
+{
+    Event event;
+    ParserBase::Status status;
+    while( (status = r_parser.get( &event )) == ParserBase::PS_OK )
+        co_yield event;
+    co_return status;
+}
+
+//----------------------------------------------------------------------------
+//                          class AsyncEventGenerator
+//----------------------------------------------------------------------------
+
+class AsyncEventGenerator
+{
+    // Returned by events_async().  Read with:
+    //
+    //     while( const cljp::Event * p_event = co_await generator.next() )
+    //
+    // from within a coroutine.  next() gives NULL once there are no more
+    // events, and status() is then the status that ended them.  Each event
+    // is only valid until next() is awaited again.
+    //
+    // The generator runs on whichever thread resumes it.  Between events it
+    // transfers control straight to and from the coroutine awaiting next(),
+    // and when it waits for input, it is the source that resumes it, and so
+    // the awaiting coroutine, once the input has arrived.
+
+public:
+    struct promise_type
+    {
+        const Event * p_event;
+        ParserBase::Status status;
+        std::exception_ptr p_exception;
+        std::coroutine_handle<> awaiting;       // The coroutine awaiting next()
+
+        struct ToAwaiting       // Suspends the generator and resumes the coroutine awaiting it
+        {
+            bool await_ready() const noexcept { return false; }
+            template< typename Tpromise >
+            std::coroutine_handle<> await_suspend( std::coroutine_handle< Tpromise > generator ) const noexcept
+            {
+                return generator.promise().awaiting;
+            }
+            void await_resume() const noexcept {}
+        };
+
+        promise_type() : p_event( 0 ), status( ParserBase::PS_OK ) {}
+        AsyncEventGenerator get_return_object() { return AsyncEventGenerator( handle::from_promise( *this ) ); }
+        std::suspend_always initial_suspend() noexcept { return std::suspend_always(); }
+        ToAwaiting final_suspend() noexcept { return ToAwaiting(); }
+        ToAwaiting yield_value( const Event & r_event ) noexcept
+        {
+            p_event = &r_event;
+            return ToAwaiting();
+        }
+        void return_value( ParserBase::Status status_in ) { p_event = 0; status = status_in; }
+        void unhandled_exception() { p_event = 0; p_exception = std::current_exception(); }
+    };
+
+    typedef std::coroutine_handle< promise_type > handle;
+
+    class NextAwaiter
+    {
+    private:
+        handle coroutine;
+
+    public:
+        NextAwaiter( handle coroutine_in ) : coroutine( coroutine_in ) {}
+        bool await_ready() const noexcept { return coroutine.done(); }
+        std::coroutine_handle<> await_suspend( std::coroutine_handle<> awaiting ) noexcept
+        {
+            coroutine.promise().awaiting = awaiting;
+            return coroutine;
+        }
+        const Event * await_resume()
+        {
+            if( coroutine.promise().p_exception )
+                std::rethrow_exception( std::exchange( coroutine.promise().p_exception, nullptr ) );
+            return coroutine.done() ? 0 : coroutine.promise().p_event;
+        }
+    };
+
+private:
+    struct Members {
+        handle coroutine;
+
+        Members( handle coroutine_in ) : coroutine( coroutine_in ) {}
+    } m;
+
+public:
+    AsyncEventGenerator( AsyncEventGenerator && r_rhs ) : m( std::exchange( r_rhs.m.coroutine, nullptr ) ) {}
+    ~AsyncEventGenerator() { if( m.coroutine ) m.coroutine.destroy(); }
+
+    NextAwaiter next() { return NextAwaiter( m.coroutine ); }
+
+    bool is_done() const { return m.coroutine.done(); }
+    ParserBase::Status status() const { return m.coroutine.promise().status; }
+
+private:
+    explicit AsyncEventGenerator( handle coroutine_in ) : m( coroutine_in ) {}
+    AsyncEventGenerator( const AsyncEventGenerator & );               // Not implemented
+    AsyncEventGenerator & operator = ( const AsyncEventGenerator & ); // Not implemented
+};
+
+// The parser must read from r_reader.  r_source.read_some( p_buffer, size )
+// must return an awaitable that reads up to size bytes into p_buffer and
+// gives the number read, or 0 at the end of the input.  Input left over
+// when a message ends stays in r_reader for the next message, which is read
+// by calling Parser::new_message(), and then events_async() again.  The
+// parser, reader and source must outlive the generator.
+template< typename Treader, typename Tsource >
+AsyncEventGenerator events_async( BasicParser< Treader > & r_parser, ReaderFeed & r_reader,
+                                    Tsource & r_source,
+                                    size_t block_size = ReaderFeed::default_block_size )
+{
+    std::vector< char > block( block_size > 0 ? block_size : 1 );
+    Event event;
+    for(;;)
+    {
+        ParserBase::Status status = r_parser.get( &event );
+        if( status == ParserBase::PS_OK )
+            co_yield event;
+        else if( status != ParserBase::PS_NEED_MORE_INPUT )
+            co_return status;
+        else if( size_t n_bytes = co_await r_source.read_some( block.data(), block.size() ) )
+            r_reader.feed( block.data(), n_bytes );
+        else
+            r_reader.finish();
+    }
+}
+
+}   // End of namespace cljp
+
+#endif  // CL_JSON_PULL_COROUTINE_H
@@ -0,0 +1,831 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------
+// Description: Parses large inputs held in memory, e.g. by ReaderMmap, using
+//              several threads.  Each part of the input is given to a
+//              function with its own BasicParser< ReaderMemory >, bounded
+//              to that part.
+//
+//              parse_records_...() parse newline-delimited JSON (NDJSON,
+//              one message per line).  The input is divided into chunks at
+//              line boundaries, which are always safe as a line feed can't
+//              appear unescaped within a JSON message.
+//
+//              parse_elements_...() parse the elements of an input that is
+//              one large array.  The boundaries of the elements are found
+//              by scanning chunks of the array in parallel.  As a chunk may
+//              start within a string, each chunk is scanned both as if it
+//              starts outside a string and as if it starts inside one.  The
+//              chunks are then joined in order, which shows which of the
+//              two is right for each chunk, and which commas separate the
+//              elements of the array rather than the members and elements
+//              of values within it.
+//
+//              In both cases the results can be delivered unordered, from
+//              the worker threads, or in the order of the input, from the
+//              calling thread.  This header requires C++11.
+//----------------------------------------------------------------------------
+
+#ifndef CL_JSON_PULL_PARALLEL_H
+#define CL_JSON_PULL_PARALLEL_H
+
+#include "cl-json-pull.h"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace cljp {    // Codalogic JSON Pull (Parser)
+
+typedef BasicParser< ReaderMemory > RecordParser;
+
+struct ParallelOptions
+{
+    size_t n_threads;           // 0 for the number of hardware threads
+    size_t chunk_size;          // Bytes of input given to a thread at a time
+    size_t max_chunks_ahead;    // Per thread, of the chunk being delivered in order
+
+    ParallelOptions() : n_threads( 0 ), chunk_size( 1024 * 1024 ), max_chunks_ahead( 4 ) {}
+};
+
+namespace parallel {
+
+inline size_t thread_count( const ParallelOptions & r_options )
+{
+    return r_options.n_threads ? r_options.n_threads : std::max( std::thread::hardware_concurrency(), 1u );
+}
+
+inline bool is_ws( char c )
+{
+    return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+}
+
+inline bool is_blank( const char * p, const char * p_end )
+{
+    for( ; p < p_end; ++p )
+        if( ! is_ws( *p ) )
+            return false;
+    return true;
+}
+
+class Workers
+{
+    // Runs a function on several threads, and passes on the first
+    // exception thrown by any of them once all have finished
+
+private:
+    struct Members {
+        std::vector< std::thread > threads;
+        std::mutex mutex;
+        std::exception_ptr p_exception;
+        std::atomic< bool > is_stopping;
+
+        Members() : is_stopping( false ) {}
+    } m;
+
+public:
+    template< typename Tfunc >
+    void start( size_t n_threads, Tfunc func )
+    {
+        for( size_t i = 0; i < n_threads; ++i )
+            m.threads.push_back( std::thread( [this, func]() mutable {
+                    try
+                    {
+                        func();
+                    }
+                    catch( ... )
+                    {
+                        stop( std::current_exception() );
+                    }
+                } ) );
+    }
+
+    bool is_stopping() const { return m.is_stopping; }
+
+    void stop( std::exception_ptr p_exception )
+    {
+        std::lock_guard< std::mutex > lock( m.mutex );
+        if( ! m.p_exception )
+            m.p_exception = p_exception;
+        m.is_stopping = true;
+    }
+
+    void join()
+    {
+        for( size_t i = 0; i < m.threads.size(); ++i )
+            m.threads[i].join();
+        m.threads.clear();
+        if( m.p_exception )
+            std::rethrow_exception( m.p_exception );
+    }
+};
+
+class Claims
+{
+    // Hands out 0 to n - 1 to the threads in turn
+
+private:
+    std::atomic< size_t > next;
+
+public:
+    Claims() : next( 0 ) {}
+    size_t claim() { return next++; }
+};
+
+class LineChunks
+{
+    // Divides NDJSON into chunks of chunk_size bytes.  A chunk has the
+    // records that start within it, the last of which may extend into the
+    // next chunk.
+
+private:
+    struct Members {
+        const char * p_begin;
+        const char * p_end;
+        size_t chunk_size;
+        size_t n_chunks;
+
+        Members( const char * p_begin_in, const char * p_end_in, size_t chunk_size_in )
+            : p_begin( p_begin_in ), p_end( p_end_in ), chunk_size( std::max( chunk_size_in, size_t( 1 ) ) ),
+                n_chunks( (p_end_in - p_begin_in + chunk_size - 1) / chunk_size )
+        {}
+    } m;
+
+public:
+    LineChunks( const char * p_begin_in, const char * p_end_in, size_t chunk_size_in )
+        : m( p_begin_in, p_end_in, chunk_size_in )
+    {}
+
+    size_t size() const { return m.n_chunks; }
+
+    // Calls func( p_record_begin, p_record_end, offset ) for each record of
+    // the chunk that contains more than whitespace.  The line feed isn't
+    // included.
+    template< typename Tfunc >
+    void for_each_item( size_t chunk, Tfunc func ) const
+    {
+        const char * p_chunk_begin = m.p_begin + chunk * m.chunk_size;
+        const char * p_chunk_end = m.p_end - p_chunk_begin > static_cast< ptrdiff_t >( m.chunk_size ) ?
+                                        p_chunk_begin + m.chunk_size : m.p_end;
+
+        const char * p = p_chunk_begin;
+        if( p != m.p_begin && p[-1] != '\n' )
+            p = next_line( p );     // The record that spans the chunk start belongs to the previous chunk
+
+        while( p < p_chunk_end )
+        {
+            const char * p_line_end = static_cast< const char * >( memchr( p, '\n', m.p_end - p ) );
+            if( ! p_line_end )
+                p_line_end = m.p_end;
+            if( ! is_blank( p, p_line_end ) )
+                func( p, p_line_end, static_cast< size_t >( p - m.p_begin ) );
+            p = p_line_end + 1;
+        }
+    }
+
+private:
+    const char * next_line( const char * p ) const
+    {
+        const char * p_line_end = static_cast< const char * >( memchr( p, '\n', m.p_end - p ) );
+        return p_line_end ? p_line_end + 1 : m.p_end;
+    }
+};
+
+class ArrayChunks
+{
+    // Divides the inside of an array (i.e. between its brackets) into
+    // chunks of chunk_size bytes, and finds the commas that separate its
+    // elements.  A chunk has the elements that start within it, the last
+    // of which may extend into later chunks.  Depths are of nesting within
+    // the array, so the commas wanted are those at depth 0.
+
+private:
+    struct Scan     // Of a chunk, for one assumption of how it starts
+    {
+        bool is_in_string_at_end;
+        long depth_change;
+        long min_depth;             // Relative to the start of the chunk, which is 0
+        std::vector< const char * > commas;     // Outside strings at min_depth
+
+        Scan() : is_in_string_at_end( false ), depth_change( 0 ), min_depth( 0 ) {}
+    };
+
+    struct Chunk
+    {
+        Scan outside;               // If the chunk starts outside a string
+        Scan inside;                // If the chunk starts inside a string
+        std::vector< const char * > separators;
+        size_t first_element;       // Index of the element after the first separator
+        const char * p_next_separator;  // After the last of this chunk, or the end of the array
+    };
+
+    struct Members {
+        const char * p_begin;
+        const char * p_end;
+        size_t chunk_size;
+        std::vector< Chunk > chunks;
+        size_t n_separators;
+
+        Members( const char * p_begin_in, const char * p_end_in, size_t chunk_size_in )
+            : p_begin( p_begin_in ), p_end( p_end_in ), chunk_size( std::max( chunk_size_in, size_t( 1 ) ) ),
+                chunks( (p_end_in - p_begin_in + chunk_size - 1) / chunk_size ), n_separators( 0 )
+        {}
+    } m;
+
+public:
+    ArrayChunks( const char * p_begin_in, const char * p_end_in, size_t chunk_size_in )
+        : m( p_begin_in, p_end_in, chunk_size_in )
+    {}
+
+    size_t size() const { return m.chunks.size(); }
+
+    void scan( size_t chunk )
+    {
+        const char * p_chunk_begin = m.p_begin + chunk * m.chunk_size;
+        const char * p_chunk_end = chunk_end( chunk );
+
+        // If the chunk starts inside a string, the first character is
+        // escaped if it follows an odd number of backslashes
+        size_t n_backslashes = 0;
+        for( const char * p = p_chunk_begin; p > m.p_begin && p[-1] == '\\'; --p )
+            ++n_backslashes;
+
+        scan( p_chunk_begin, p_chunk_end, false, false, &m.chunks[chunk].outside );
+        scan( p_chunk_begin, p_chunk_end, true, n_backslashes % 2 != 0, &m.chunks[chunk].inside );
+    }
+
+    // Joins the scans of the chunks in order.  Returns false if the inside
+    // of the array isn't balanced.
+    bool resolve()
+    {
+        long depth = 0;
+        bool is_in_string = false;
+        for( size_t i = 0; i < m.chunks.size(); ++i )
+        {
+            Chunk & r_chunk = m.chunks[i];
+            Scan & r_scan = is_in_string ? r_chunk.inside : r_chunk.outside;
+            if( depth + r_scan.min_depth < 0 )
+                return false;
+            if( depth + r_scan.min_depth == 0 )
+                r_chunk.separators.swap( r_scan.commas );
+            r_chunk.first_element = m.n_separators + 1;
+            m.n_separators += r_chunk.separators.size();
+            depth += r_scan.depth_change;
+            is_in_string = r_scan.is_in_string_at_end;
+            std::vector< const char * >().swap( r_chunk.outside.commas );
+            std::vector< const char * >().swap( r_chunk.inside.commas );
+        }
+        if( depth != 0 || is_in_string )
+            return false;
+
+        const char * p_next_separator = m.p_end;
+        for( size_t i = m.chunks.size(); i-- > 0; )
+        {
+            m.chunks[i].p_next_separator = p_next_separator;
+            if( ! m.chunks[i].separators.empty() )
+                p_next_separator = m.chunks[i].separators.front();
+        }
+        return true;
+    }
+
+    size_t n_separators() const { return m.n_separators; }
+
+    // After resolve(), calls func( p_element_begin, p_element_end, index )
+    // for each element that starts in the chunk.  Returns false if an
+    // element is empty, other than that of an empty array.
+    template< typename Tfunc >
+    bool for_each_item( size_t chunk, Tfunc func ) const
+    {
+        const Chunk & r_chunk = m.chunks[chunk];
+        size_t index = r_chunk.first_element;
+        if( chunk == 0 && ! element( m.p_begin, separator_after( r_chunk, 0 ), 0, func ) )
+            return false;
+        for( size_t i = 0; i < r_chunk.separators.size(); ++i, ++index )
+            if( ! element( r_chunk.separators[i] + 1, separator_after( r_chunk, i + 1 ), index, func ) )
+                return false;
+        return true;
+    }
+
+private:
+    const char * chunk_end( size_t chunk ) const
+    {
+        const char * p_chunk_begin = m.p_begin + chunk * m.chunk_size;
+        return m.p_end - p_chunk_begin > static_cast< ptrdiff_t >( m.chunk_size ) ? p_chunk_begin + m.chunk_size : m.p_end;
+    }
+
+    static const char * separator_after( const Chunk & r_chunk, size_t i )
+    {
+        return i < r_chunk.separators.size() ? r_chunk.separators[i] : r_chunk.p_next_separator;
+    }
+
+    template< typename Tfunc >
+    bool element( const char * p_begin, const char * p_end, size_t index, Tfunc & r_func ) const
+    {
+        if( is_blank( p_begin, p_end ) )
+            return m.n_separators == 0;     // Only an empty array has no elements
+        r_func( p_begin, p_end, index );
+        return true;
+    }
+
+    static void scan( const char * p, const char * p_end, bool is_in_string, bool is_escaped, Scan * p_scan_out )
+    {
+        long depth = 0;
+        while( p < p_end )
+        {
+            if( is_in_string )
+            {
+                if( is_escaped )
+                {
+                    is_escaped = false;
+                    ++p;
+                }
+                while( p < p_end && *p != '"' && *p != '\\' )
+                    ++p;
+                if( p == p_end )
+                    break;
+                if( *p == '\\' )
+                    is_escaped = true;
+                else
+                    is_in_string = false;
+            }
+            else
+            {
+                switch( *p )
+                {
+                case '"':
+                    is_in_string = true;
+                break;
+                case '[':
+                case '{':
+                    ++depth;
+                break;
+                case ']':
+                case '}':
+                    if( --depth < p_scan_out->min_depth )
+                    {
+                        p_scan_out->min_depth = depth;
+                        p_scan_out->commas.clear();
+                    }
+                break;
+                case ',':
+                    if( depth == p_scan_out->min_depth )
+                        p_scan_out->commas.push_back( p );
+                break;
+                }
+            }
+            ++p;
+        }
+        p_scan_out->is_in_string_at_end = is_in_string;
+        p_scan_out->depth_change = depth;
+    }
+};
+
+template< typename Tchunks, typename Tfunc >
+void run_unordered( Tchunks & r_chunks, Tfunc func, const ParallelOptions & r_options )
+{
+    // Calls func( p_begin, p_end, id ) for each item of each chunk
+
+    Claims claims;
+    Workers workers;
+
+    workers.start( thread_count( r_options ), [&]() {
+            for( size_t chunk = claims.claim(); chunk < r_chunks.size() && ! workers.is_stopping(); chunk = claims.claim() )
+                r_chunks.for_each_item( chunk, func );
+        } );
+
+    workers.join();
+}
+
+template< typename Tresult, typename Tchunks, typename Tmap, typename Tconsume >
+void run_ordered( Tchunks & r_chunks, Tmap map, Tconsume consume, const ParallelOptions & r_options )
+{
+    // Calls map( p_begin, p_end, id ) for each item of each chunk, and then
+    // consume( result, id ) for each item in order from the calling thread
+
+    typedef std::vector< std::pair< size_t, Tresult > > ChunkResults;
+
+    struct Delivery     // Of the results of each chunk, in turn
+    {
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::vector< ChunkResults > results;    // Indexed by chunk
+        std::vector< char > is_done;
+        size_t next_chunk;
+    } delivery;
+
+    Claims claims;
+    Workers workers;
+    delivery.results.resize( r_chunks.size() );
+    delivery.is_done.resize( r_chunks.size(), 0 );
+    delivery.next_chunk = 0;
+
+    size_t n_threads = thread_count( r_options );
+    size_t max_ahead = std::max( n_threads * r_options.max_chunks_ahead, size_t( 1 ) );
+
+    workers.start( n_threads, [&]() {
+            try
+            {
+                for( size_t chunk = claims.claim(); chunk < r_chunks.size(); chunk = claims.claim() )
+                {
+                    {
+                    // Limits the results waiting to be delivered
+                    std::unique_lock< std::mutex > lock( delivery.mutex );
+                    delivery.changed.wait( lock, [&]() {
+                            return chunk < delivery.next_chunk + max_ahead || workers.is_stopping(); } );
+                    }
+
+                    ChunkResults results;
+                    if( ! workers.is_stopping() )
+                        r_chunks.for_each_item( chunk, [&]( const char * p_begin, const char * p_end, size_t id ) {
+                                results.push_back( std::make_pair( id, map( p_begin, p_end, id ) ) );
+                            } );
+
+                    std::lock_guard< std::mutex > lock( delivery.mutex );
+                    delivery.results[chunk].swap( results );
+                    delivery.is_done[chunk] = 1;
+                    delivery.changed.notify_all();
+                }
+            }
+            catch( ... )
+            {
+                // The thread waiting for this chunk must be woken
+                workers.stop( std::current_exception() );
+                std::lock_guard< std::mutex > lock( delivery.mutex );
+                delivery.changed.notify_all();
+            }
+        } );
+
+    try
+    {
+        for( size_t chunk = 0; chunk < r_chunks.size(); ++chunk )
+        {
+            ChunkResults results;
+            {
+            std::unique_lock< std::mutex > lock( delivery.mutex );
+            delivery.changed.wait( lock, [&]() { return delivery.is_done[chunk] || workers.is_stopping(); } );
+            if( ! delivery.is_done[chunk] )
+                break;
+            delivery.results[chunk].swap( results );
+            delivery.next_chunk = chunk + 1;
+            delivery.changed.notify_all();
+            }
+
+            for( size_t i = 0; i < results.size(); ++i )
+                consume( results[i].second, results[i].first );
+        }
+    }
+    catch( ... )
+    {
+        workers.stop( std::current_exception() );
+    }
+
+    {
+    std::lock_guard< std::mutex > lock( delivery.mutex );
+    delivery.changed.notify_all();
+    }
+    workers.join();
+}
+
+template< typename Tfunc >
+class ParsingFunc
+{
+    // Calls func( RecordParser & parser, size_t id ) with a parser of an item
+
+private:
+    Tfunc func;
+
+public:
+    ParsingFunc( Tfunc func_in ) : func( func_in ) {}
+
+    auto operator () ( const char * p_begin, const char * p_end, size_t id ) -> decltype( func( *(RecordParser *)0, id ) )
+    {
+        ReaderMemory reader( p_begin, p_end );
+        RecordParser parser( reader );
+        return func( parser, id );
+    }
+};
+
+template< typename Tfunc >
+ParsingFunc< Tfunc > parsing_func( Tfunc func )
+{
+    return ParsingFunc< Tfunc >( func );
+}
+
+//----------------------------------------------------------------------------
+//                           Top-level arrays
+//----------------------------------------------------------------------------
+
+class Array
+{
+    // Finds the brackets of an input that is one array, and the status of
+    // reading it if it isn't
+
+private:
+    struct Members {
+        const char * p_begin;
+        const char * p_end;
+        const char * p_inside_begin;
+        const char * p_inside_end;
+
+        Members( const char * p_begin_in, const char * p_end_in )
+            : p_begin( p_begin_in ), p_end( p_end_in ), p_inside_begin( 0 ), p_inside_end( 0 )
+        {}
+    } m;
+
+public:
+    Array( const char * p_begin_in, const char * p_end_in )
+        : m( p_begin_in, p_end_in )
+    {
+        const char * p = m.p_begin;
+        if( m.p_end - p >= 3 && memcmp( p, "\xef\xbb\xbf", 3 ) == 0 )
+            p += 3;                 // UTF-8 BOM
+        while( p < m.p_end && is_ws( *p ) )
+            ++p;
+        const char * p_last = m.p_end;
+        while( p_last > p && is_ws( p_last[-1] ) )
+            --p_last;
+        if( p < p_last && *p == '[' && p_last[-1] == ']' && p_last - p >= 2 )
+        {
+            m.p_inside_begin = p + 1;
+            m.p_inside_end = p_last - 1;
+        }
+    }
+
+    bool is_array() const { return m.p_inside_begin != 0; }
+    const char * inside_begin() const { return m.p_inside_begin; }
+    const char * inside_end() const { return m.p_inside_end; }
+
+    // Why the input couldn't be divided, found by reading it with a single
+    // parser
+    ParserBase::Status error() const
+    {
+        ReaderMemory reader( m.p_begin, m.p_end );
+        RecordParser parser( reader );
+        EventView event;
+        ParserBase::Status status = parser.get( &event );
+        bool is_array = status == ParserBase::PS_OK && event.is_array_start();
+        while( status == ParserBase::PS_OK )
+            status = parser.get( &event );
+        if( status != ParserBase::PS_END_OF_MESSAGE )
+            return status;
+
+        parser.new_message();
+        if( ! is_array || parser.get( &event ) != ParserBase::PS_END_OF_MESSAGE )
+            return ParserBase::PS_NOT_A_SINGLE_ARRAY;
+        return ParserBase::PS_UNDOCUMENTED_FAIL;
+    }
+};
+
+template< typename Trun >
+ParserBase::Status run_on_elements( const char * p_begin, const char * p_end, const ParallelOptions & r_options, Trun run )
+{
+    Array array( p_begin, p_end );
+    if( ! array.is_array() )
+        return array.error();
+
+    ArrayChunks chunks( array.inside_begin(), array.inside_end(), r_options.chunk_size );
+    {
+    Claims claims;
+    Workers workers;
+    workers.start( thread_count( r_options ), [&]() {
+            for( size_t chunk = claims.claim(); chunk < chunks.size(); chunk = claims.claim() )
+                chunks.scan( chunk );
+        } );
+    workers.join();
+    }
+
+    if( ! chunks.resolve() )
+        return array.error();
+
+    std::atomic< bool > is_element_invalid( false );
+    run( chunks, is_element_invalid );
+    if( is_element_invalid )
+        return array.error();
+    return ParserBase::PS_OK;
+}
+
+class CheckedChunks
+{
+    // Presents ArrayChunks as the other chunk types, noting empty elements as
+    // invalid
+
+private:
+    ArrayChunks & r_chunks;
+    std::atomic< bool > & r_is_element_invalid;
+
+public:
+    CheckedChunks( ArrayChunks & r_chunks_in, std::atomic< bool > & r_is_element_invalid_in )
+        : r_chunks( r_chunks_in ), r_is_element_invalid( r_is_element_invalid_in )
+    {}
+
+    size_t size() const { return r_chunks.size(); }
+
+    template< typename Titem_func >
+    void for_each_item( size_t chunk, Titem_func func ) const
+    {
+        if( ! r_chunks.for_each_item( chunk, func ) )
+            r_is_element_invalid = true;
+    }
+};
+
+template< typename Tfunc >
+class ElementParsingFunc
+{
+    // As ParsingFunc, and then notes the element as invalid if what func
+    // didn't read of it isn't the rest of one value, as in [1 2]
+
+private:
+    class Check     // Run after func returns, whatever its result type
+    {
+    private:
+        RecordParser & r_parser;
+        std::atomic< bool > & r_is_element_invalid;
+
+    public:
+        Check( RecordParser & r_parser_in, std::atomic< bool > & r_is_element_invalid_in )
+            : r_parser( r_parser_in ), r_is_element_invalid( r_is_element_invalid_in )
+        {}
+        ~Check()
+        {
+            try
+            {
+                if( ! is_one_value() )
+                    r_is_element_invalid = true;
+            }
+            catch( ... )    // E.g. the parser throwing errors
+            {
+                r_is_element_invalid = true;
+            }
+        }
+
+    private:
+        bool is_one_value()
+        {
+            EventView event;
+            ParserBase::Status status;
+            while( (status = r_parser.get( &event )) == ParserBase::PS_OK )
+                {}
+            if( status != ParserBase::PS_END_OF_MESSAGE )
+                return false;
+            r_parser.new_message();     // Only whitespace may follow
+            return r_parser.get( &event ) == ParserBase::PS_END_OF_MESSAGE;
+        }
+    };
+
+    Tfunc func;
+    std::atomic< bool > & r_is_element_invalid;
+
+public:
+    ElementParsingFunc( Tfunc func_in, std::atomic< bool > & r_is_element_invalid_in )
+        : func( func_in ), r_is_element_invalid( r_is_element_invalid_in )
+    {}
+
+    auto operator () ( const char * p_begin, const char * p_end, size_t index ) -> decltype( func( *(RecordParser *)0, index ) )
+    {
+        ReaderMemory reader( p_begin, p_end );
+        RecordParser parser( reader );
+        Check check( parser, r_is_element_invalid );
+        return func( parser, index );
+    }
+};
+
+template< typename Tfunc >
+ElementParsingFunc< Tfunc > element_parsing_func( Tfunc func, std::atomic< bool > & r_is_element_invalid )
+{
+    return ElementParsingFunc< Tfunc >( func, r_is_element_invalid );
+}
+
+}   // End of namespace parallel
+
+//----------------------------------------------------------------------------
+//                                 NDJSON
+//----------------------------------------------------------------------------
+
+// Calls func( RecordParser & parser, size_t record_offset ) for each record,
+// from several threads at once and in no particular order
+template< typename Tfunc >
+void parse_records_unordered( const char * p_begin, const char * p_end, Tfunc func,
+                                const ParallelOptions & r_options = ParallelOptions() )
+{
+    parallel::LineChunks chunks( p_begin, p_end, r_options.chunk_size );
+    parallel::run_unordered( chunks, parallel::parsing_func( func ), r_options );
+}
+
+template< typename Tfunc >
+void parse_records_unordered( ReaderMemory & r_reader, Tfunc func, const ParallelOptions & r_options = ParallelOptions() )
+{
+    parse_records_unordered( r_reader.memory_begin(), r_reader.memory_end(), func, r_options );
+}
+
+// Calls map( RecordParser & parser, size_t record_offset ), which returns a
+// Tresult, for each record from several threads at once, and then
+// consume( Tresult & result, size_t record_offset ) for each record in the
+// order of the input from the calling thread
+template< typename Tresult, typename Tmap, typename Tconsume >
+void parse_records_ordered( const char * p_begin, const char * p_end, Tmap map, Tconsume consume,
+                                const ParallelOptions & r_options = ParallelOptions() )
+{
+    parallel::LineChunks chunks( p_begin, p_end, r_options.chunk_size );
+    parallel::run_ordered< Tresult >( chunks, parallel::parsing_func( map ), consume, r_options );
+}
+
+template< typename Tresult, typename Tmap, typename Tconsume >
+void parse_records_ordered( ReaderMemory & r_reader, Tmap map, Tconsume consume,
+                                const ParallelOptions & r_options = ParallelOptions() )
+{
+    parse_records_ordered< Tresult >( r_reader.memory_begin(), r_reader.memory_end(), map, consume, r_options );
+}
+
+//----------------------------------------------------------------------------
+//                           Top-level arrays
+//----------------------------------------------------------------------------
+
+// As parse_records_...(), but for each element of an input that is a single
+// array, with the index of the element in place of the offset.  Each
+// element's parser gives the same events as a parser of the whole input
+// would for that element.  Returns PS_OK, or the status a single parser
+// would give if the input isn't valid JSON, and PS_NOT_A_SINGLE_ARRAY if
+// it isn't a single array.  Errors in the structure of the array, such as
+// unbalanced brackets, are found before any element is given to func.
+// Other errors, such as an empty element, as in [1,,2], or anything but
+// whitespace after an element's value, as in [1 2], are found as the
+// elements are parsed.  After func returns, whatever it didn't read of its
+// element is read to check it.  The input must be UTF-8.
+template< typename Tfunc >
+ParserBase::Status parse_elements_unordered( const char * p_begin, const char * p_end, Tfunc func,
+                                const ParallelOptions & r_options = ParallelOptions() )
+{
+    return parallel::run_on_elements( p_begin, p_end, r_options,
+            [&]( parallel::ArrayChunks & r_chunks, std::atomic< bool > & r_is_element_invalid ) {
+                parallel::CheckedChunks chunks( r_chunks, r_is_element_invalid );
+                parallel::run_unordered( chunks, parallel::element_parsing_func( func, r_is_element_invalid ), r_options );
+            } );
+}
+
+template< typename Tfunc >
+ParserBase::Status parse_elements_unordered( ReaderMemory & r_reader, Tfunc func,
+                                const ParallelOptions & r_options = ParallelOptions() )
+{
+    return parse_elements_unordered( r_reader.memory_begin(), r_reader.memory_end(), func, r_options );
+}
+
+template< typename Tresult, typename Tmap, typename Tconsume >
+ParserBase::Status parse_elements_ordered( const char * p_begin, const char * p_end, Tmap map, Tconsume consume,
+                                const ParallelOptions & r_options = ParallelOptions() )
+{
+    return parallel::run_on_elements( p_begin, p_end, r_options,
+            [&]( parallel::ArrayChunks & r_chunks, std::atomic< bool > & r_is_element_invalid ) {
+                parallel::CheckedChunks chunks( r_chunks, r_is_element_invalid );
+                parallel::run_ordered< Tresult >( chunks, parallel::element_parsing_func( map, r_is_element_invalid ),
+                                                    consume, r_options );
+            } );
+}
+
+template< typename Tresult, typename Tmap, typename Tconsume >
+ParserBase::Status parse_elements_ordered( ReaderMemory & r_reader, Tmap map, Tconsume consume,
+                                const ParallelOptions & r_options = ParallelOptions() )
+{
+    return parse_elements_ordered< Tresult >( r_reader.memory_begin(), r_reader.memory_end(), map, consume, r_options );
+}
+
+}   // End of namespace cljp
+
+#endif  // CL_JSON_PULL_PARALLEL_H
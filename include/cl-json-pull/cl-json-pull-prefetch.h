@@ -0,0 +1,285 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+//----------------------------------------------------------------------------
+// Description: ReaderPrefetch reads another reader, such as a ReaderFile of a
+//              file or pipe, on a background thread, so that waiting for
+//              input overlaps with parsing.  The input is copied into a ring
+//              of fixed-size blocks, which bounds the memory used to
+//              n_blocks * block_size bytes.  The ring has one writer (the
+//              background thread) and one reader (the parser's thread), and
+//              its positions are atomic, so neither thread takes a lock
+//              while there are blocks to read or room to fill.  A thread
+//              only sleeps when the ring is empty or full.
+//
+//              This header requires C++11.
+//----------------------------------------------------------------------------
+
+#ifndef CL_JSON_PULL_PREFETCH_H
+#define CL_JSON_PULL_PREFETCH_H
+
+#include "cl-json-pull.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <cstring>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace cljp {    // Codalogic JSON Pull (Parser)
+
+class ReaderPrefetch : public Reader
+{
+    // The source reader must not be used by anything else while the
+    // ReaderPrefetch exists.  Each block is filled until it is full or the
+    // source has no more input, so a block of a pipe isn't passed on until
+    // block_size bytes have arrived.
+    //
+    // Destroying the ReaderPrefetch, e.g. when the parser stops early on an
+    // error, stops the background thread once its current read of the
+    // source returns.  Exceptions thrown by the source are rethrown by
+    // get() or peek() in place of the end of the input.
+
+public:
+    enum { default_block_size = 64 * 1024, default_n_blocks = 4 };
+
+private:
+    struct Block
+    {
+        std::vector< char > data;
+        size_t size;            // 0 marks the end of the input
+
+        Block() : size( 0 ) {}
+    };
+
+    struct Members {
+        Reader & r_source;
+        std::vector< Block > blocks;
+        std::atomic< size_t > n_filled;         // Only changed by the background thread
+        std::atomic< size_t > n_released;       // Only changed by the parser's thread
+        size_t offset;                          // Of the next byte in block n_released
+        std::atomic< bool > is_stopping;
+        std::atomic< bool > is_filler_waiting;
+        std::atomic< bool > is_reader_waiting;
+        std::mutex mutex;
+        std::condition_variable changed;
+        std::exception_ptr p_exception;         // Set before the end block is filled
+        std::thread filler;
+
+        Members( Reader & r_source_in, size_t block_size_in, size_t n_blocks_in )
+            :
+            r_source( r_source_in ),
+            blocks( std::max( n_blocks_in, size_t( 2 ) ) ),
+            n_filled( 0 ),
+            n_released( 0 ),
+            offset( 0 ),
+            is_stopping( false ),
+            is_filler_waiting( false ),
+            is_reader_waiting( false )
+        {
+            for( size_t i = 0; i < blocks.size(); ++i )
+                blocks[i].data.resize( std::max( block_size_in, size_t( 1 ) ) );
+        }
+    } m;
+
+public:
+    ReaderPrefetch( Reader & r_source_in, size_t block_size_in = default_block_size,
+                    size_t n_blocks_in = default_n_blocks )
+        : m( r_source_in, block_size_in, n_blocks_in )
+    {
+        start();
+    }
+    ~ReaderPrefetch()
+    {
+        stop();
+    }
+
+    size_t block_size() const { return m.blocks[0].data.size(); }
+    size_t n_blocks() const { return m.blocks.size(); }
+
+private:
+    ReaderPrefetch( const ReaderPrefetch & );               // Not implemented
+    ReaderPrefetch & operator = ( const ReaderPrefetch & ); // Not implemented
+
+    Block & block( size_t n ) { return m.blocks[n % m.blocks.size()]; }
+
+    void start()
+    {
+        m.filler = std::thread( [this]() { fill(); } );
+    }
+
+    void stop()
+    {
+        if( ! m.filler.joinable() )
+            return;
+        m.is_stopping = true;
+        {
+        std::lock_guard< std::mutex > lock( m.mutex );
+        m.changed.notify_all();
+        }
+        m.filler.join();
+    }
+
+    // The flag and position are both sequentially consistent, so either the
+    // waiting thread sees the new position, or the other thread sees the
+    // flag and wakes it
+    template< typename Tcondition >
+    void wait( std::atomic< bool > & r_is_waiting, Tcondition condition )
+    {
+        std::unique_lock< std::mutex > lock( m.mutex );
+        r_is_waiting = true;
+        m.changed.wait( lock, condition );
+        r_is_waiting = false;
+    }
+
+    void wake( std::atomic< bool > & r_is_waiting )
+    {
+        if( r_is_waiting )
+        {
+            std::lock_guard< std::mutex > lock( m.mutex );
+            m.changed.notify_all();
+        }
+    }
+
+    void fill()     // Runs on the background thread
+    {
+        for( size_t n_filled = m.n_filled; ; ++n_filled )
+        {
+            if( n_filled - m.n_released == m.blocks.size() )
+                wait( m.is_filler_waiting, [&]() {
+                        return n_filled - m.n_released < m.blocks.size() || m.is_stopping; } );
+            if( m.is_stopping )
+                return;
+
+            // After an exception, the bytes read before it are passed on,
+            // followed by the end block
+            Block & r_block = block( n_filled );
+            r_block.size = 0;
+            if( ! m.p_exception )
+            {
+                try
+                {
+                    read_source( &r_block );
+                }
+                catch( ... )
+                {
+                    m.p_exception = std::current_exception();
+                }
+            }
+
+            m.n_filled = n_filled + 1;
+            wake( m.is_reader_waiting );
+            if( r_block.size == 0 )
+                return;
+        }
+    }
+
+    void read_source( Block * p_block_out )
+    {
+        const char * p_block = 0;
+        while( p_block_out->size < p_block_out->data.size() && ! m.is_stopping )
+        {
+            size_t n_bytes = m.r_source.peek( &p_block );
+            if( n_bytes == 0 )
+                break;
+            n_bytes = std::min( n_bytes, p_block_out->data.size() - p_block_out->size );
+            memcpy( &p_block_out->data[p_block_out->size], p_block, n_bytes );
+            m.r_source.consume( n_bytes );
+            p_block_out->size += n_bytes;
+        }
+    }
+
+    virtual int do_get()
+    {
+        const char * p_block = 0;
+        if( do_peek( &p_block ) == 0 )
+            return EOM;
+        ++m.offset;
+        return static_cast< unsigned char >( *p_block );
+    }
+
+    virtual size_t do_peek( const char * * pp_block_out )
+    {
+        for( ;; )
+        {
+            size_t n_released = m.n_released;
+            if( m.n_filled == n_released )
+                wait( m.is_reader_waiting, [&]() { return m.n_filled != n_released; } );
+
+            Block & r_block = block( n_released );
+            if( m.offset < r_block.size )
+            {
+                *pp_block_out = &r_block.data[m.offset];
+                return r_block.size - m.offset;
+            }
+            if( r_block.size == 0 )     // The end block is never released
+            {
+                if( m.p_exception )
+                    std::rethrow_exception( m.p_exception );
+                return 0;
+            }
+
+            // The previous peek's block is no longer needed
+            m.offset = 0;
+            m.n_released = n_released + 1;
+            wake( m.is_filler_waiting );
+        }
+    }
+
+    virtual void do_consume( size_t n_bytes )
+    {
+        assert( m.offset + n_bytes <= block( m.n_released ).size );
+        m.offset += n_bytes;
+    }
+
+    virtual void do_rewind()
+    {
+        stop();
+        m.r_source.rewind();
+        m.n_filled = 0;
+        m.n_released = 0;
+        m.offset = 0;
+        m.is_stopping = false;
+        m.p_exception = std::exception_ptr();
+        start();
+    }
+};
+
+}   // End of namespace cljp
+
+#endif  // CL_JSON_PULL_PREFETCH_H
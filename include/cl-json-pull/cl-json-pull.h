@@ -38,9 +38,11 @@
 
 #include <string>
 #include <vector>
+#include <deque>
+#include <map>
 #include <cstdio>
-#include <stack>
 #include <cassert>
+#include <stdint.h>
 
 namespace cljp {    // Codalogic JSON Pull (Parser)
 
@@ -50,6 +52,33 @@ namespace cljp {    // Codalogic JSON Pull (Parser)
 
 class Reader
 {
+    // Input can be read either a byte at a time using get(), or a block at a
+    // time using peek() and consume().  peek() returns the number of bytes
+    // available in the next block (0 at end of message) and sets
+    // *pp_block_out to point to them.  The block remains valid until the next
+    // call of peek(), get() or rewind().  consume() marks bytes of the block
+    // as read.
+    //
+    // Derived classes that only implement do_get() get a default peek() that
+    // offers one byte at a time.  Derived classes that have their input in
+    // memory should override do_peek() and do_consume() as well.
+    //
+    // has_stable_blocks() indicates whether blocks remain valid for as long
+    // as the reader exists (until it is rewound), rather than only until the
+    // next peek().  This allows the parser to return views of the input.
+    //
+    // is_awaiting_input() indicates whether a reader that has returned EOM
+    // may have more input later, as a ReaderFeed does until it is finished,
+    // rather than being at the end of its input.
+
+private:
+    struct Members {
+        char peeked;
+        bool is_peeked;
+
+        Members() : peeked( 0 ), is_peeked( false ) {}
+    } m;
+
 public:
     static const int EOM /*= -1*/;  // End of message
 
@@ -57,12 +86,22 @@ public:
 
     virtual void close_on_destruct( bool is_close_on_destruct_required ) {}
 
-    int get() { return do_get(); }  // Returns EOM when no more input
-    void rewind() { return do_rewind(); }
+    int get() { return m.is_peeked ? get_peeked() : do_get(); }  // Returns EOM when no more input
+    size_t peek( const char * * pp_block_out ) { return do_peek( pp_block_out ); }
+    void consume( size_t n_bytes ) { do_consume( n_bytes ); }
+    void rewind() { m.is_peeked = false; return do_rewind(); }
+    bool has_stable_blocks() const { return do_has_stable_blocks(); }
+    bool is_awaiting_input() const { return do_is_awaiting_input(); }
 
 private:
+    int get_peeked();
+
     virtual int do_get() = 0;
+    virtual size_t do_peek( const char * * pp_block_out );
+    virtual void do_consume( size_t n_bytes );
     virtual void do_rewind() = 0;
+    virtual bool do_has_stable_blocks() const { return false; }
+    virtual bool do_is_awaiting_input() const { return false; }
 };
 
 //----------------------------------------------------------------------------
@@ -85,9 +124,42 @@ private:
 public:
     ReaderMemory( const char * p_start_in, const char * p_end_in );
 
+    // Non-virtual versions of the Reader methods.  These are used when the
+    // type of the reader is known to be ReaderMemory, e.g. by
+    // BasicParser< ReaderMemory >, and allow the calls to be inlined.
+    int get()
+    {
+        if( m.p_now < m.p_end )
+            return static_cast< unsigned char >( *m.p_now++ );
+        return EOM;
+    }
+    size_t peek( const char * * pp_block_out )
+    {
+        *pp_block_out = m.p_now;
+        return m.p_end - m.p_now;
+    }
+    void consume( size_t n_bytes )
+    {
+        assert( n_bytes <= static_cast< size_t >( m.p_end - m.p_now ) );
+        m.p_now += n_bytes;
+    }
+    void rewind() { m.p_now = m.p_start; }
+    bool has_stable_blocks() const { return true; }
+    bool is_awaiting_input() const { return false; }
+
+    const char * memory_begin() const { return m.p_start; }
+    const char * memory_end() const { return m.p_end; }
+
+protected:
+    ReaderMemory() : m( 0, 0 ) {}
+    void set_memory( const char * p_start_in, const char * p_end_in );
+
 private:
     virtual int do_get();
+    virtual size_t do_peek( const char * * pp_block_out );
+    virtual void do_consume( size_t n_bytes );
     virtual void do_rewind();
+    virtual bool do_has_stable_blocks() const;
 };
 
 //----------------------------------------------------------------------------
@@ -108,68 +180,188 @@ public:
 
 class ReaderFile : public Reader
 {
+public:
+    enum { default_block_size = 64 * 1024 };
+
 private:
     struct Members {
         FILE * h_fin;
         bool is_close_on_destruct_required;
+        std::vector< char > buffer;
+        const char * p_now;
+        const char * p_end;
 
-        Members( FILE * h_fin_in )
-            : h_fin( h_fin_in ), is_close_on_destruct_required( true )
+        Members( FILE * h_fin_in, size_t block_size_in )
+            :
+            h_fin( h_fin_in ),
+            is_close_on_destruct_required( true ),
+            buffer( block_size_in > 0 ? block_size_in : 1 ),
+            p_now( 0 ),
+            p_end( 0 )
         {}
     } m;
 
 public:
-    ReaderFile( const char * p_file_name_in );
-    ReaderFile( FILE * h_fin_in );
+    ReaderFile( const char * p_file_name_in, size_t block_size_in = default_block_size );
+    ReaderFile( FILE * h_fin_in, size_t block_size_in = default_block_size );
     ~ReaderFile();
 
     bool is_open() const { return m.h_fin != 0; }
+    size_t block_size() const { return m.buffer.size(); }
 
 private:
+    bool fill_buffer();
+
     virtual int do_get();
+    virtual size_t do_peek( const char * * pp_block_out );
+    virtual void do_consume( size_t n_bytes );
     virtual void do_rewind();
     virtual void close_on_destruct( bool is_close_on_destruct_required );
 };
 
 //----------------------------------------------------------------------------
-//                               class ReadUTF8
+//                             class ReaderMmap
 //----------------------------------------------------------------------------
 
-class ReadUTF8
+class ReaderMmap : public ReaderMemory
 {
-public:
-    enum Modes { LEARNING, LEARNING_UTF8_OR_LE, UTF8, UTF16LE, UTF16BE, UTF32LE, UTF32BE, ERRORED };
-    typedef int utf8_buffer_t[6+1];
+    // Maps the whole of a file into memory and reads it as a ReaderMemory.
+    // Empty files are treated as open files of zero length.
 
 private:
     struct Members {
-        Reader & r_reader;
-        Modes mode;
-        utf8_buffer_t utf8_buffer;
-        int * p_utf8_buffer;    // NULL or pointing to \0 indicates no utf-8 chars stored
+        void * p_mapping;   // NULL if nothing is mapped (e.g. an empty file)
+        size_t mapping_size;
+        bool is_open;
 
-        Members( Reader & r_reader_in )
+        Members() : p_mapping( 0 ), mapping_size( 0 ), is_open( false ) {}
+    } m;
+
+public:
+    ReaderMmap( const char * p_file_name_in );
+    ~ReaderMmap();
+
+    bool is_open() const { return m.is_open; }
+    size_t size() const { return m.mapping_size; }
+
+private:
+    ReaderMmap( const ReaderMmap & );               // Not implemented
+    ReaderMmap & operator = ( const ReaderMmap & ); // Not implemented
+
+    bool map( const char * p_file_name_in );
+    void unmap();
+};
+
+//----------------------------------------------------------------------------
+//                             class ReaderFeed
+//----------------------------------------------------------------------------
+
+class ReaderFeed : public Reader
+{
+    // Holds input given to it by feed(), e.g. as it arrives on a
+    // non-blocking socket, until a parser reads it.  Only input up to the end
+    // of the last complete event is offered to the parser, so the parser
+    // never runs out of input part way through a name or value.  Once it
+    // has read all that is offered, Parser::get() returns PS_NEED_MORE_INPUT
+    // and can be called again after more has been fed.  finish() marks the
+    // end of the input, after which all of it is offered.
+    //
+    // A number, true, false or null may continue in the next feed, so its
+    // event is offered once the character after it has been fed.
+    //
+    // The parser doesn't find the end of a string where the scan does if it
+    // has a \u escape with a backslash among its hex digits, or a high
+    // surrogate escape followed by a quote.  Nothing more is then offered
+    // until finish(), so the error is the same as for the whole input.
+    //
+    // The input must be UTF-8.  Parser::skip() also returns
+    // PS_NEED_MORE_INPUT if the input fed so far ends part way through what
+    // it skips, and is then called again to finish the skip.  Values skipped
+    // by a projection are finished by the next get().  rewind() discards all
+    // input, so the reader can be used afresh.
+
+public:
+    enum { default_block_size = 4 * 1024 };
+
+private:
+    enum ScanState { S_BETWEEN, S_STRING, S_STRING_ESCAPE, S_STRING_UNICODE, S_STRING_SURROGATE,
+            S_SCALAR, S_NOT_FOLLOWED };
+
+    struct Members {
+        std::deque< std::vector< char > > chunks;   // Each filled to its capacity before the next is added
+        std::vector< char > spare_chunk;
+        size_t block_size;
+        size_t front_offset;    // Offsets are counted from the start of the input
+        size_t n_read;
+        size_t n_offered;
+        size_t n_fed;
+        ScanState state;
+        std::vector< char > containers;     // '{' or '[' for each object or array the scan is in
+        bool is_name_next;      // The next string is a member name
+        bool is_name;           // The string being scanned is a member name
+        int escape_code;        // Of the \u escape being scanned
+        size_t n_escape_digits;
+        size_t bom_size;        // Bytes of a UTF-8 BOM at the start of the input
+        bool is_finished;
+
+        Members( size_t block_size_in )
             :
-            r_reader( r_reader_in ),
-            mode( LEARNING ),
-            p_utf8_buffer( 0 )
+            block_size( block_size_in > 0 ? block_size_in : 1 ),
+            front_offset( 0 ),
+            n_read( 0 ),
+            n_offered( 0 ),
+            n_fed( 0 ),
+            state( S_BETWEEN ),
+            is_name_next( false ),
+            is_name( false ),
+            escape_code( 0 ),
+            n_escape_digits( 0 ),
+            bom_size( 0 ),
+            is_finished( false )
         {}
     } m;
 
 public:
-    ReadUTF8( Reader & r_reader_in )
-        : m( r_reader_in )
-    {}
+    ReaderFeed( size_t block_size_in = default_block_size );
 
-    Modes mode() const { return m.mode; }
+    void feed( const char * p_bytes, size_t n_bytes );
+    void feed( const std::string & r_bytes ) { feed( r_bytes.data(), r_bytes.size() ); }
+    void finish();
 
-    int get();
+    bool is_finished() const { return m.is_finished; }
+    size_t size() const { return m.n_fed - m.n_read; }    // Bytes fed and not yet read
+    size_t size_offered() const { return m.n_offered - m.n_read; }
 
-    void rewind();
+private:
+    void scan( const char * p_bytes, size_t n_bytes );
+    void offer_to( size_t offset ) { m.n_offered = offset; }
+    void end_string( size_t offset );
 
-    Reader & reader() const { return m.r_reader; }
+    virtual int do_get();
+    virtual size_t do_peek( const char * * pp_block_out );
+    virtual void do_consume( size_t n_bytes );
+    virtual void do_rewind();
+    virtual bool do_is_awaiting_input() const { return ! m.is_finished; }
+};
 
-private:
+//----------------------------------------------------------------------------
+//                               class ReadUTF8
+//----------------------------------------------------------------------------
+
+class ReadUTF8Base
+{
+public:
+    enum Modes { LEARNING, LEARNING_UTF8_OR_LE, UTF8, UTF16LE, UTF16BE, UTF32LE, UTF32BE, ERRORED };
+    typedef int utf8_buffer_t[6+1];
+
+    // The implementation used to validate UTF-8 input in bulk.  The best
+    // one supported by the CPU is selected at start-up.
+    enum UTF8Validators { UV_SCALAR, UV_SSE42, UV_AVX2 };
+    static UTF8Validators utf8_validator();
+    static bool is_utf8_validator_supported( UTF8Validators validator );
+    static bool use_utf8_validator( UTF8Validators validator );   // Returns false if not supported
+
+protected:
     struct CharPair
     {
         int c1; int c2;
@@ -177,7 +369,6 @@ private:
         int to_little_endian_code_point() const { return c1 + c2 * 256; }
         int to_big_endian_code_point() const { return c1 * 256 + c2; }
     };
-    CharPair get_pair();
     struct CharQuad
     {
         int c1; int c2; int c3; int c4;
@@ -189,6 +380,96 @@ private:
         int to_little_endian_code_point() const { return c1 + 256 * (c2 + 256 * (c3 + 256 * c4)); }
         int to_big_endian_code_point() const { return ((c1 * 256 + c2) * 256 + c3) * 256 + c4; }
     };
+};
+
+template< typename Treader >
+class BasicReadUTF8 : public ReadUTF8Base
+{
+private:
+    struct Members {
+        Treader & r_reader;
+        Modes mode;
+        utf8_buffer_t utf8_buffer;
+        int * p_utf8_buffer;    // NULL or pointing to \0 indicates no utf-8 chars stored
+        const char * p_now;     // Block of bytes taken from r_reader
+        const char * p_end;
+        const char * p_span_now;    // Run of valid UTF-8, either validated in the
+        const char * p_span_end;    // block or transcoded into transcode_buffer
+        std::vector< char > transcode_buffer;
+        size_t max_size;
+        size_t n_bytes_allowed;     // Still to be taken from r_reader
+        bool is_size_limit_exceeded;
+
+        Members( Treader & r_reader_in )
+            :
+            r_reader( r_reader_in ),
+            mode( LEARNING ),
+            p_utf8_buffer( 0 ),
+            p_now( 0 ),
+            p_end( 0 ),
+            p_span_now( 0 ),
+            p_span_end( 0 ),
+            max_size( ~size_t( 0 ) ),
+            n_bytes_allowed( ~size_t( 0 ) ),
+            is_size_limit_exceeded( false )
+        {}
+    } m;
+
+public:
+    enum { validation_chunk_size = 16 * 1024 };
+    enum { transcode_buffer_size = 16 * 1024 };
+
+    BasicReadUTF8( Treader & r_reader_in )
+        : m( r_reader_in )
+    {}
+
+    Modes mode() const { return m.mode; }
+
+    int get()
+    {
+        // Once the input encoding is known, bytes that have been validated or
+        // transcoded in bulk are passed straight through
+        if( m.p_span_now < m.p_span_end )
+            return static_cast< unsigned char >( *m.p_span_now++ );
+        return get_from_current_mode();
+    }
+
+    // The span is a run of valid UTF-8 that can be read directly rather
+    // than via get().  It may be empty even if there is more input.
+    const char * span_begin() const { return m.p_span_now; }
+    const char * span_end() const { return m.p_span_end; }
+    void span_advance_to( const char * p_new_now )
+    {
+        assert( p_new_now >= m.p_span_now && p_new_now <= m.p_span_end );
+        m.p_span_now = p_new_now;
+    }
+    // Whether the span points into input that remains valid after further
+    // reads, rather than into a buffer that will be reused
+    bool is_span_stable() const { return m.mode == UTF8 && m.r_reader.has_stable_blocks(); }
+
+    // Limits the number of bytes taken from the reader, counting from the
+    // first byte not yet read.  If more are needed, reading stops as if at
+    // the end of the input and is_size_limit_exceeded() becomes true.
+    void limit_size( size_t max_size );
+    bool is_size_limit_exceeded() const { return m.is_size_limit_exceeded; }
+
+    void rewind();
+
+    Treader & reader() const { return m.r_reader; }
+
+private:
+    int get_from_current_mode();
+
+    int get_byte()
+    {
+        if( m.p_now < m.p_end )
+            return static_cast< unsigned char >( *m.p_now++ );
+        return get_byte_from_next_block();
+    }
+    int get_byte_from_next_block();
+    bool take_next_block();
+
+    CharPair get_pair();
     CharQuad get_quad();
 
     int state_learning();
@@ -198,7 +479,10 @@ private:
     int state_learning_utf16be_or_utf32be();
     int state_expecting_utf16be_with_bom();
     int state_learning_utf32be_possibly_with_bom();
+    int state_utf8();
+    bool validate_utf8_ahead();
     int state_utf8_reading_non_ascii( int c );
+    bool transcode_ahead();
     int state_utf16le();
     int construct_utf8_from_utf16le( CharPair pair );
     int state_utf16be();
@@ -211,6 +495,8 @@ private:
     int in_error() { m.mode = ERRORED; return cljp::Reader::EOM; }
 };
 
+typedef BasicReadUTF8< Reader > ReadUTF8;
+
 //----------------------------------------------------------------------------
 //                           class UngetBuffer
 //----------------------------------------------------------------------------
@@ -237,24 +523,91 @@ public:
     void pop() { assert( m.size > 0 ); --m.size; }
 };
 
+//----------------------------------------------------------------------------
+//                           class StructuralIndex
+//----------------------------------------------------------------------------
+
+class StructuralIndex
+{
+    // An index of the positions in an in-memory UTF-8 JSON document at which
+    // the parser needs to stop and look at the input.  Outside of strings
+    // these are the structural characters ({}[]:,), quotes and the first
+    // character after any whitespace.  Inside strings they are the closing
+    // quote, backslashes that start an escape and control characters.
+    // Everything between two positions is therefore either whitespace or
+    // string characters that need no special handling, and can be skipped
+    // or copied without being examined.
+    //
+    // The index is built in one pass using SIMD instructions where available
+    // and can be given to a Parser reading the same memory.  Documents of
+    // 4GiB or more are not indexed.
+
+private:
+    struct Members {
+        const char * p_begin;
+        const char * p_end;
+        std::vector< uint32_t > positions;
+
+        Members() : p_begin( 0 ), p_end( 0 ) {}
+    } m;
+
+public:
+    StructuralIndex() {}
+    StructuralIndex( const char * p_begin_in, const char * p_end_in ) { build( p_begin_in, p_end_in ); }
+    StructuralIndex( const ReaderMemory & r_reader_in ) { build( r_reader_in.memory_begin(), r_reader_in.memory_end() ); }
+
+    void build( const char * p_begin_in, const char * p_end_in );
+
+    bool is_indexed( const char * p ) const { return p >= m.p_begin && p < m.p_end; }
+    size_t size() const { return m.positions.size(); }
+    const char * operator [] ( size_t index ) const { return m.p_begin + m.positions[index]; }
+
+    // Returns the first indexed position at or after p (which must be
+    // indexed), or the end of the document if there is none.  *p_cursor
+    // remembers where the previous search finished, so that searches that
+    // move forward through the document are cheap.
+    const char * next_stop( const char * p, size_t * p_cursor ) const
+    {
+        assert( is_indexed( p ) );
+
+        uint32_t offset = static_cast< uint32_t >( p - m.p_begin );
+        size_t cursor = *p_cursor;
+
+        if( cursor > m.positions.size() || (cursor > 0 && m.positions[cursor - 1] >= offset) )
+            cursor = find_cursor( offset );     // Not moving forward, e.g. after a rewind
+        else
+            while( cursor < m.positions.size() && m.positions[cursor] < offset )
+                ++cursor;
+
+        *p_cursor = cursor;
+        return cursor < m.positions.size() ? m.p_begin + m.positions[cursor] : m.p_end;
+    }
+
+private:
+    size_t find_cursor( uint32_t offset ) const;
+};
+
 //----------------------------------------------------------------------------
 //                           class ReadUTF8WithUnget
 //----------------------------------------------------------------------------
 
-class ReadUTF8WithUnget
+template< typename Treader >
+class BasicReadUTF8WithUnget
 {
 private:
     struct Members {
         UngetBuffer< char > unget_buffer;
-        ReadUTF8 read_utf8;
+        BasicReadUTF8< Treader > read_utf8;
+        const StructuralIndex * p_index;
+        size_t index_cursor;
 
-        Members( Reader & reader_in )
-            : read_utf8( reader_in )
+        Members( Treader & reader_in )
+            : read_utf8( reader_in ), p_index( 0 ), index_cursor( 0 )
         {}
     } m;
 
 public:
-    ReadUTF8WithUnget( Reader & reader_in )
+    BasicReadUTF8WithUnget( Treader & reader_in )
             : m( reader_in )
         {}
 
@@ -263,9 +616,69 @@ public:
 
     void unget( int c );
 
+    // Spans of validated UTF-8 are only available when nothing has been unget
+    const char * span_begin() const { return m.read_utf8.span_begin(); }
+    const char * span_end() const
+    {
+        return m.unget_buffer.empty() ? m.read_utf8.span_end() : m.read_utf8.span_begin();
+    }
+    void span_advance_to( const char * p_new_now ) { m.read_utf8.span_advance_to( p_new_now ); }
+    bool is_span_stable() const { return m.read_utf8.is_span_stable(); }
+
+    // When the span is in memory covered by the index, returns the next
+    // indexed position in the span (or the end of the span).  Otherwise
+    // returns NULL.
+    const char * span_next_stop();
+
+    void use_index( const StructuralIndex * p_index_in ) { m.p_index = p_index_in; m.index_cursor = 0; }
+
+    void limit_size( size_t max_size ) { m.read_utf8.limit_size( max_size ); }
+    bool is_size_limit_exceeded() const { return m.read_utf8.is_size_limit_exceeded(); }
+
     void rewind();
 
-    Reader & reader() const { return m.read_utf8.reader(); }
+    Treader & reader() const { return m.read_utf8.reader(); }
+};
+
+typedef BasicReadUTF8WithUnget< Reader > ReadUTF8WithUnget;
+
+//----------------------------------------------------------------------------
+//                             class StringView
+//----------------------------------------------------------------------------
+
+class StringView
+{
+    // A non-owning reference to a run of characters, which need not be
+    // NUL terminated
+
+private:
+    struct Members {
+        const char * p_begin;
+        size_t size;
+
+        Members( const char * p_begin_in, size_t size_in ) : p_begin( p_begin_in ), size( size_in ) {}
+    } m;
+
+public:
+    StringView() : m( "", 0 ) {}
+    StringView( const char * p_begin_in, size_t size_in ) : m( p_begin_in, size_in ) {}
+    StringView( const char * p_begin_in, const char * p_end_in ) : m( p_begin_in, p_end_in - p_begin_in ) {}
+    StringView( const std::string & r_string_in ) : m( r_string_in.data(), r_string_in.size() ) {}
+
+    const char * data() const { return m.p_begin; }
+    size_t size() const { return m.size; }
+    bool empty() const { return m.size == 0; }
+    const char * begin() const { return m.p_begin; }
+    const char * end() const { return m.p_begin + m.size; }
+    char operator [] ( size_t index ) const { assert( index < m.size ); return m.p_begin[index]; }
+
+    std::string to_string() const { return std::string( m.p_begin, m.size ); }
+
+    bool operator == ( const StringView & r_rhs ) const;
+    bool operator == ( const char * p_rhs ) const;
+    bool operator == ( const std::string & r_rhs ) const { return *this == StringView( r_rhs ); }
+    template< typename T >
+    bool operator != ( const T & r_rhs ) const { return ! (*this == r_rhs); }
 };
 
 //----------------------------------------------------------------------------
@@ -281,11 +694,32 @@ struct Event
     std::string value;
     Type type;
 
-    Event() : type( T_UNKNOWN ) {}
+    // Details of numbers and booleans recorded by the parser so that the
+    // classification and conversion methods don't need to re-read value.
+    // flags is 0 for events that were not set by the parser, in which case
+    // value is read instead.  If value of a parsed event is changed, flags
+    // should be set to 0.
+    enum Flags {
+            F_PARSED = 0x01,        // flags (and for numbers int_magnitude and float_value) describe value
+            F_MINUS = 0x02,
+            F_FRAC = 0x04,
+            F_EXP = 0x08,
+            F_INT_OVERFLOW = 0x10,  // Integer part is too big for int_magnitude
+            F_TRUE = 0x20
+            };
+    unsigned int flags;
+    uint64_t int_magnitude;         // Integer part, ignoring any minus sign
+    double float_value;             // Correctly rounded value of the number
+
+    // The ID of name in the KeySet given to the parser, or 0
+    // (KeySet::K_UNKNOWN) if there is none or name isn't in it
+    int key;
+
+    Event() : type( T_UNKNOWN ), flags( 0 ), int_magnitude( 0 ), float_value( 0.0 ), key( 0 ) {}
     // Event( const Event & ) = default;
     // Event & operator = ( const Event & ) = default;
 
-    void clear() { name.clear(); value.clear(); type = T_UNKNOWN; }
+    void clear() { name.clear(); value.clear(); type = T_UNKNOWN; flags = 0; int_magnitude = 0; float_value = 0.0; key = 0; }
 
     // Convenience methods
     bool is_unknown() const { return type == T_UNKNOWN; }   // For completeness
@@ -300,9 +734,9 @@ struct Event
     bool is_array_end() const { return type == T_ARRAY_END; }
 
     // is_true() and is_false() don't do implicit type casting. i.e. JSON type must be Boolean to yield true.
-    bool is_true() const { return type == T_BOOLEAN && value == "true"; }
-    bool is_false() const { return type == T_BOOLEAN && value == "false"; }
-    bool is_int() const;
+    bool is_true() const { return type == T_BOOLEAN && ((flags & F_PARSED) ? (flags & F_TRUE) != 0 : value == "true"); }
+    bool is_false() const { return type == T_BOOLEAN && ((flags & F_PARSED) ? (flags & F_TRUE) == 0 : value == "false"); }
+    bool is_int() const { return type == T_NUMBER && ((flags & F_PARSED) ? (flags & (F_FRAC | F_EXP)) == 0 : is_int_text()); }
     bool is_float() const { return is_number(); }           // For convenience
 
     bool is( const char * p_name_in ) { return name == p_name_in; }
@@ -312,15 +746,240 @@ struct Event
     double to_float() const;
     int to_int() const;
     long to_long() const;
+    // to_int64() and to_uint64() are exact for integers.  Other numbers are
+    // truncated.  Values out of range are clamped to the nearest limit.
+    int64_t to_int64() const;
+    uint64_t to_uint64() const;
     const std::string & to_string() const { return value; } // For completeness
     std::wstring to_wstring() const;                        // For convenience
+
+private:
+    bool is_int_text() const;
+};
+
+//----------------------------------------------------------------------------
+//                             class EventView
+//----------------------------------------------------------------------------
+
+struct EventView
+{
+    // As Event, but the name and value are views rather than copies.  For
+    // input read from memory (e.g. ReaderMemory, ReaderString and
+    // ReaderMmap) strings that contain no escapes refer directly to the
+    // input.  Other names and values refer to a buffer in the parser.  In
+    // both cases they are only valid until the next call of Parser::get().
+
+    StringView name;
+    StringView value;
+    Event::Type type;
+    unsigned int flags;             // As for Event
+    uint64_t int_magnitude;
+    double float_value;
+    int key;                        // As for Event
+
+    EventView() : type( Event::T_UNKNOWN ), flags( 0 ), int_magnitude( 0 ), float_value( 0.0 ), key( 0 ) {}
+
+    void clear() { name = value = StringView(); type = Event::T_UNKNOWN; flags = 0; int_magnitude = 0; float_value = 0.0; key = 0; }
+
+    // Convenience methods
+    bool is_unknown() const { return type == Event::T_UNKNOWN; }
+    bool is_string() const { return type == Event::T_STRING; }
+    bool is_number() const { return type == Event::T_NUMBER; }
+    bool is_boolean() const { return type == Event::T_BOOLEAN; }
+    bool is_bool() const { return is_boolean(); }
+    bool is_null() const { return type == Event::T_NULL; }
+    bool is_object_start() const { return type == Event::T_OBJECT_START; }
+    bool is_object_end() const { return type == Event::T_OBJECT_END; }
+    bool is_array_start() const { return type == Event::T_ARRAY_START; }
+    bool is_array_end() const { return type == Event::T_ARRAY_END; }
+
+    bool is_true() const { return type == Event::T_BOOLEAN && ((flags & Event::F_PARSED) ? (flags & Event::F_TRUE) != 0 : value == "true"); }
+    bool is_false() const { return type == Event::T_BOOLEAN && ((flags & Event::F_PARSED) ? (flags & Event::F_TRUE) == 0 : value == "false"); }
+    bool is_int() const { return type == Event::T_NUMBER && (flags & Event::F_PARSED) && (flags & (Event::F_FRAC | Event::F_EXP)) == 0; }
+
+    bool is( const char * p_name_in ) const { return name == p_name_in; }
+    bool is( const char * p_name_in, Event::Type type_in ) const { return name == p_name_in && type == type_in; }
+
+    // As the Event methods.  Numbers read by the parser are converted
+    // without copying the view.
+    double to_float() const;
+    int64_t to_int64() const;
+    uint64_t to_uint64() const;
+
+    // Copies the view into an Event, e.g. to keep it or to use the other
+    // Event conversion methods
+    void to_event( Event * p_event_out ) const;
+
+private:
+    void to_number_event( Event * p_event_out ) const;
+};
+
+//----------------------------------------------------------------------------
+//                             class Projection
+//----------------------------------------------------------------------------
+
+class Projection
+{
+    // The paths of the parts of a message that are wanted.  A Parser given a
+    // Projection only returns events for the values at the paths (including
+    // everything within them) and for the objects and arrays that contain
+    // them.  Everything else is skipped as Parser::skip() does.
+    //
+    // Paths are JSON Pointers (RFC 6901), such as "/user/id", except that a
+    // "*" segment matches any member name or array index, as in
+    // "/items/*/price".  The path "" is the whole message.
+    //
+    // The paths are compiled into a deterministic automaton, with a state
+    // for each object or array being read, so the cost of matching a member
+    // or array element doesn't depend on the number of paths.  The
+    // automaton is built when it is first used, or by compile().  A
+    // Projection shared between threads must be compiled beforehand.
+
+public:
+    enum Match { M_NONE, M_ANCESTOR, M_SELECTED };
+    typedef uint32_t State;
+
+private:
+    struct Node     // Of the trie of paths
+    {
+        std::vector< std::pair< std::string, size_t > > children;
+        size_t wildcard_child;      // 0 if none
+        bool is_path_end;
+
+        Node() : wildcard_child( 0 ), is_path_end( false ) {}
+    };
+
+    struct StateInfo
+    {
+        State other;            // For names and indices without their own transition
+        bool has_index_names;   // Some transitions are for names that are array indices
+    };
+
+    struct Transition
+    {
+        State from;
+        State to;               // 0 (never a target) if the entry is unused
+        uint32_t name_offset;
+        uint32_t name_size;
+    };
+
+    struct Automaton
+    {
+        bool is_built;
+        State start;
+        std::vector< StateInfo > states;
+        std::vector< Transition > transitions;  // A hash table
+        std::string names;
+
+        Automaton() : is_built( false ), start( 0 ) {}
+    };
+
+    struct Members {
+        std::vector< Node > nodes;
+        size_t n_paths;
+        mutable Automaton automaton;
+
+        Members() : nodes( 1 ), n_paths( 0 ) {}
+    } m;
+
+public:
+    Projection() {}
+
+    bool add( const std::string & r_path );     // Returns false if r_path is not a valid path
+    size_t size() const { return m.n_paths; }
+    void clear();
+    void compile() const;
+
+    // r_path is the member names and array indices (in decimal) leading to
+    // a value.  Returns M_SELECTED if the value is at or within one of the
+    // paths, M_ANCESTOR if one of the paths is within the value, and
+    // M_NONE otherwise.
+    Match match( const std::vector< std::string > & r_path ) const;
+
+    // Stepping through the automaton.  start() is the state of the whole
+    // message, and the next_...() methods give the state of a value in the
+    // object or array whose state is given.
+    State start() const { compile(); return m.automaton.start; }
+    State next_member( State state, const char * p_name, size_t name_size ) const;
+    State next_element( State state, size_t index ) const;
+    static Match match( State state ) { return state == s_none ? M_NONE : state == s_selected ? M_SELECTED : M_ANCESTOR; }
+
+private:
+    enum { s_none = 0, s_selected = 1 };
+
+    struct Builder;
+    void build() const;
+    State find_transition( State state, const char * p_name, size_t name_size ) const;
+};
+
+//----------------------------------------------------------------------------
+//                               class KeySet
+//----------------------------------------------------------------------------
+
+class KeySet
+{
+    // Member names known in advance, each with an ID, so that code reading
+    // events can switch on Event::key rather than compare names.  A Parser
+    // given a KeySet sets the key of each member's event to the ID of the
+    // member's name, and to K_UNKNOWN if the name isn't in the set.
+    //
+    // The names are put in a perfect hash table when the set is first used,
+    // or by compile(), so a name is found with one hash and at most one
+    // comparison.  A KeySet shared between threads must be compiled
+    // beforehand.
+
+public:
+    enum { K_UNKNOWN = 0 };
+
+private:
+    struct Slot
+    {
+        uint32_t name_offset;
+        uint32_t name_size;
+        int key;                // K_UNKNOWN if the slot is unused
+    };
+
+    struct Table
+    {
+        bool is_built;
+        uint32_t seed;
+        std::vector< uint32_t > displacements;  // One for each bucket of names
+        std::vector< Slot > slots;
+        std::string names;
+
+        Table() : is_built( false ), seed( 0 ) {}
+    };
+
+    struct Members {
+        std::vector< std::string > names;       // Indexed by key - 1
+        std::map< std::string, int > keys;
+        mutable Table table;
+    } m;
+
+public:
+    KeySet() {}
+
+    // IDs are given from 1 in the order names are added.  Adding a name
+    // that is already in the set returns its existing ID.
+    int add( const std::string & r_name );
+    size_t size() const { return m.names.size(); }
+    const std::string & name( int key ) const { return m.names[key - 1]; }
+    void clear();
+    void compile() const;
+
+    int find( const char * p_name, size_t name_size ) const;
+    int find( const std::string & r_name ) const { return find( r_name.data(), r_name.size() ); }
+
+private:
+    void build() const;
+    bool try_build( size_t n_slots ) const;
 };
 
 //----------------------------------------------------------------------------
 //                               class Parser
 //----------------------------------------------------------------------------
 
-class Parser
+class ParserBase
 {
 public:
     enum Status {
@@ -341,45 +1000,222 @@ public:
             PS_BAD_FORMAT_NUMBER,
             PS_BAD_UNICODE_ESCAPE,
             PS_EXPECTED_MEMBER_NAME,
+            PS_MAX_DEPTH_EXCEEDED,
+            PS_MAX_STRING_SIZE_EXCEEDED,
+            PS_MAX_NUMBER_SIZE_EXCEEDED,
+            PS_MAX_MESSAGE_SIZE_EXCEEDED,
+            PS_UNEXPECTED_VALUE_TYPE,       // Of a value read into a C++ type by cl-json-pull-bind.h
+            PS_NEED_MORE_INPUT,             // Not an error; get() can be called again once a ReaderFeed has more input
+            PS_NOT_A_SINGLE_ARRAY,          // Of the input to parse_elements_...() in cl-json-pull-parallel.h
             PS_UNDOCUMENTED_FAIL = 100
             };
 
-private:
+    // Limits on the input, to stop hostile input using excessive memory or
+    // time.  0 means no limit.  Reading stops as soon as a limit is exceeded.
+    struct Limits
+    {
+        size_t max_depth;           // Of nested objects and arrays
+        size_t max_string_size;     // Bytes of UTF-8 in a name or string, after unescaping
+        size_t max_number_size;     // Characters in a number, or in a true, false or null
+        size_t max_message_size;    // Bytes taken from the Reader for a message
+
+        Limits() : max_depth( 0 ), max_string_size( 0 ), max_number_size( 0 ), max_message_size( 0 ) {}
+    };
+
+protected:
     enum Context {
             C_OUTER, C_DONE, C_START_OBJECT, C_IN_OBJECT, C_START_ARRAY, C_IN_ARRAY };
 
+    class ContextStack
+    {
+        // The outermost context is always C_OUTER or C_DONE, and the others
+        // are one of the four object and array contexts, so each nested
+        // context is stored in 2 bits.  The first CLJP_INLINE_NESTING_DEPTH
+        // levels are stored in the object, so creating and clearing the
+        // stack doesn't allocate memory.  The top context is held separately
+        // as it is the one most used.
+
+    private:
+        enum { bits_per_level = 2, levels_per_word = 32,
+                inline_words = (CLJP_INLINE_NESTING_DEPTH + levels_per_word - 1) / levels_per_word };
+
+        struct Members {
+            size_t size;
+            Context top;
+            Context outer;
+            uint64_t inline_levels[inline_words];
+            std::vector< uint64_t > spilled_levels;
+        } m;
+
+    public:
+        ContextStack() { clear(); }
+
+        void clear() { m.size = 1; m.top = m.outer = C_OUTER; }
+        size_t size() const { return m.size; }
+        Context top() const { return m.top; }
+        void set_top( Context context ) { m.top = context; }
+        void push( Context context )
+        {
+            if( m.size == 1 )
+                m.outer = m.top;
+            else
+                store( m.size - 2, m.top );
+            ++m.size;
+            m.top = context;
+        }
+        void pop()
+        {
+            assert( m.size > 1 );
+            --m.size;
+            m.top = m.size == 1 ? m.outer : load( m.size - 2 );
+        }
+
+    private:
+        // Levels are numbered from 0 for the first context above the outer one
+        uint64_t & word( size_t level )
+        {
+            size_t index = level / levels_per_word;
+            if( index < inline_words )
+                return m.inline_levels[index];
+            index -= inline_words;
+            if( index >= m.spilled_levels.size() )
+                m.spilled_levels.resize( index + 1 );
+            return m.spilled_levels[index];
+        }
+        uint64_t word( size_t level ) const
+        {
+            size_t index = level / levels_per_word;
+            if( index < inline_words )
+                return m.inline_levels[index];
+            return m.spilled_levels[index - inline_words];
+        }
+        static unsigned int shift( size_t level ) { return (level % levels_per_word) * bits_per_level; }
+        void store( size_t level, Context context )
+        {
+            uint64_t & r_word = word( level );
+            r_word &= ~(uint64_t( 3 ) << shift( level ));
+            r_word |= static_cast< uint64_t >( context - C_START_OBJECT ) << shift( level );
+        }
+        Context load( size_t level ) const
+        {
+            return static_cast< Context >( C_START_OBJECT + ((word( level ) >> shift( level )) & 3) );
+        }
+    };
+};
+
+template< typename Treader >
+class BasicParser : public ParserBase
+{
+    // Treader is the type of Reader the parser reads from.  BasicParser< Reader >
+    // (i.e. Parser) can read from any Reader.  BasicParser< ReaderMemory > only
+    // reads from a ReaderMemory (or classes derived from it, such as
+    // ReaderString and ReaderMmap), but does so without virtual function calls.
+
+private:
+    struct ProjectionState
+    {
+        // Levels are numbered from 0 for the outermost object or array
+        struct Level
+        {
+            Projection::State state;
+            size_t n_elements;          // Read so far, if an array
+        };
+
+        const Projection * p_projection;
+        Projection::State value_state;      // Of the value being read
+        Projection::Match match;
+        size_t selected_level;              // Of the object or array all of which is wanted, or ~0
+        std::vector< Level > levels;
+        bool is_value_skipped;
+
+        ProjectionState() : p_projection( 0 ) { clear(); }
+        void clear() { match = Projection::M_SELECTED; selected_level = ~size_t( 0 ); is_value_skipped = false; }
+        bool is_selected( size_t level ) const { return selected_level <= level; }
+    };
+
+    struct SkipState    // Of a skip waiting for more input from a ReaderFeed
+    {
+        bool is_scanning;           // In skip_to_depth()
+        size_t scan_depth;
+        bool is_in_string;
+        bool is_escaped;
+        bool is_value;              // The scan is of a value that isn't in the projection
+        bool is_by_events;          // In skip_events()
+        size_t events_depth;
+
+        SkipState() { clear(); }
+        void clear() { is_scanning = is_in_string = is_escaped = is_value = is_by_events = false; scan_depth = events_depth = 0; }
+    };
+
     struct Members {
-        ReadUTF8WithUnget input;
-        typedef std::stack< Context > context_stack_t;
-        context_stack_t context_stack;
+        BasicReadUTF8WithUnget< Treader > input;
+        ContextStack context_stack;
         int c;
         Event * p_event_out;
         Status last_status;
-
-        Members( Reader & reader_in )
-            : input( reader_in )
+        Event view_event;           // Holds EventView names and values that aren't views of the input
+        StringView * p_name_view;   // Set while getting an EventView
+        StringView * p_value_view;
+        Limits limits;
+        ProjectionState projection;
+        SkipState skip;
+        const KeySet * p_keys;
+
+        Members( Treader & reader_in )
+            : input( reader_in ), p_name_view( 0 ), p_value_view( 0 ), p_keys( 0 )
         {
             new_message();
         }
         void new_message()
         {
-            context_stack = context_stack_t();
-            context_stack.push( C_OUTER );
+            input.limit_size( limit_or_max( limits.max_message_size ) );
+            context_stack.clear();
             c = ' ';
             p_event_out = 0;
             last_status = PS_OK;
+            projection.clear();
+            skip.clear();
         }
     } m;
 
 public:
-    Parser( Reader & reader_in )
+    BasicParser( Treader & reader_in )
         : m( reader_in )
     {}
+    // The index must be of the memory that reader_in reads from, and must
+    // outlive the parser.  The events returned are the same as without it.
+    // After an error the parser stops using it.
+    BasicParser( Treader & reader_in, const StructuralIndex & r_index_in )
+        : m( reader_in )
+    {
+        m.input.use_index( &r_index_in );
+    }
 
     Status get( Event * p_event_out );
+    Status get( EventView * p_event_out );
     Status skip();
     void new_message();
 
+    // The message size is counted from the first byte not yet read, and
+    // again from the start of each new message
+    void set_limits( const Limits & r_limits_in )
+    {
+        m.limits = r_limits_in;
+        m.input.limit_size( limit_or_max( m.limits.max_message_size ) );
+    }
+    const Limits & limits() const { return m.limits; }
+
+    // Only the parts of each message in the projection are returned.  The
+    // projection must remain valid while it is in use.  NULL turns it off.
+    // Set it before the first get() of a message.
+    void use_projection( const Projection * p_projection_in ) { m.projection.p_projection = p_projection_in; }
+    const Projection * projection() const { return m.projection.p_projection; }
+
+    // Sets the key of each member's event.  The key set must remain valid
+    // while it is in use.  NULL turns it off.
+    void use_keys( const KeySet * p_keys_in ) { m.p_keys = p_keys_in; }
+    const KeySet * keys() const { return m.p_keys; }
+
 private:
     int get() { m.c = m.input.get(); return m.c; }
     int get_non_ws() { m.c = m.input.get_non_ws(); return m.c; }
@@ -387,6 +1223,17 @@ private:
     void unget( int c ) { m.input.unget( c ); }
     void unget() { m.input.unget( m.c ); }
     Context context() const { return m.context_stack.top(); }
+    Status get_event( Event * p_event_out );
+    Status skip_to_depth( size_t done_depth, bool is_in_string, bool is_escaped );
+    Status wait_to_skip_to_depth( size_t done_depth, bool is_in_string, bool is_escaped );
+    Status resume_skip_to_depth();
+    Status skip_events( size_t done_depth );
+    Status skip_char( int c, bool * p_is_in_string, bool * p_is_escaped );
+    Status skip_value();
+    bool is_projected_out( Projection::State value_state );
+    bool is_member_projected_out();
+    bool is_element_projected_out();
+    void set_key();
     Status get_outer();
     Status get_start_object();
     Status get_in_object();
@@ -405,11 +1252,13 @@ private:
     Status get_constant_string(
                             const char * const p_chars_start,
                             Event::Type on_success_type,
+                            unsigned int on_success_flags,
                             Status on_error_code );
     bool is_number_start_char();
     bool is_invalid_json_number_start_char();
     Status get_number();
     Status get_string();
+    bool try_get_string_view( StringView * p_view_out );
     void read_to_non_quoted_value_end();
     bool is_separator();
     bool is_unexpected_object_close();
@@ -420,11 +1269,110 @@ private:
     Status unexpected_close_error();
     Status context_update_for_object();
     Status context_update_for_array();
-    void conditional_context_update_for_nesting_increase();
+    Status conditional_context_update_for_nesting_increase();
+    static size_t limit_or_max( size_t limit ) { return limit ? limit : ~size_t( 0 ); }
 
     Status report_error( Status error );
 };
 
+typedef BasicParser< Reader > Parser;
+
+//----------------------------------------------------------------------------
+//                               class Tape
+//----------------------------------------------------------------------------
+
+class Tape
+{
+    // A message held for random access, as a flat array of 64-bit entries
+    // (the tape) and one buffer of strings, rather than as a tree of
+    // separately allocated nodes.  Each entry has a type in its top 8 bits.
+    // The entries of an object or array start and end with the index of
+    // the other, so that skipping to the next member or element takes one
+    // step.  A member's value is preceded by an entry for its name.  Numbers
+    // have a second entry holding their integer value, or their floating
+    // point value if they have a fraction or exponent.  Clearing a tape, or
+    // building another message into it, keeps the memory it has allocated.
+
+private:
+    enum { tag_name = 15 };     // The other tags are Event::Type values
+
+    struct Members {
+        std::vector< uint64_t > entries;
+        std::string strings;            // Each is a 4 byte size, the bytes and a NUL
+        std::vector< size_t > open_starts;
+    } m;
+
+public:
+    class Value
+    {
+        // A value in a tape, which is only valid while the tape is
+        // unchanged.  A default constructed Value, or a member or element
+        // that isn't found, is invalid.
+
+    private:
+        const Tape * p_tape;
+        size_t index;           // Of the name entry of a member, otherwise of the value
+
+    public:
+        Value() : p_tape( 0 ), index( 0 ) {}
+        Value( const Tape * p_tape_in, size_t index_in ) : p_tape( p_tape_in ), index( index_in ) {}
+
+        bool is_valid() const { return p_tape != 0; }
+        Event::Type type() const { return is_valid() ? static_cast< Event::Type >( p_tape->tag( value_index() ) ) : Event::T_UNKNOWN; }
+        bool is_object() const { return type() == Event::T_OBJECT_START; }
+        bool is_array() const { return type() == Event::T_ARRAY_START; }
+
+        // The type, name and value of the value as the parser would give
+        // them, with the end of an object or array omitted.  The views
+        // refer to the tape.
+        // For numbers with a fraction or exponent int_magnitude is 0.
+        void to_event( EventView * p_event_out ) const;
+        StringView name() const;    // Empty if the value isn't a member
+
+        // Members and elements of an object or array
+        Value first() const;        // Invalid if there are none
+        Value next() const;         // Of the value's object or array.  Invalid at the end.
+        size_t size() const;        // Counts the members or elements
+        Value at( size_t index ) const;
+        Value find( const StringView & r_name ) const;      // The first member with the name
+        Value find( const char * p_name ) const;
+
+        bool operator == ( const Value & r_rhs ) const { return p_tape == r_rhs.p_tape && index == r_rhs.index; }
+        bool operator != ( const Value & r_rhs ) const { return ! (*this == r_rhs); }
+
+    private:
+        size_t value_index() const { return p_tape->tag( index ) == tag_name ? index + 1 : index; }
+        Value at_entry( size_t entry_index ) const;
+
+    };
+
+    friend class Value;
+
+    Tape() {}
+
+    // Reads the next message from the parser into the tape, replacing what
+    // it held.  If the status isn't PS_OK the tape holds the part of the
+    // message read before the error, and shouldn't be navigated.
+    ParserBase::Status build( Parser & r_parser );
+    ParserBase::Status build( BasicParser< ReaderMemory > & r_parser );
+    void clear() { m.entries.clear(); m.strings.clear(); m.open_starts.clear(); }
+
+    bool empty() const { return m.entries.empty(); }
+    size_t size() const { return m.entries.size(); }   // In entries
+    Value root() const { return empty() ? Value() : Value( this, 0 ); }
+
+private:
+    template< typename Tparser >
+    ParserBase::Status build_from( Tparser & r_parser );
+    void add( const EventView & r_event );
+    void add_entry( unsigned int tag, uint64_t payload ) { m.entries.push_back( (uint64_t( tag ) << 56) | payload ); }
+    uint64_t add_string( const StringView & r_string );
+    unsigned int tag( size_t index ) const { return static_cast< unsigned int >( m.entries[index] >> 56 ); }
+    uint64_t payload( size_t index ) const { return m.entries[index] & ((uint64_t( 1 ) << 56) - 1); }
+    StringView string_at( uint64_t offset ) const;
+    size_t next_index( size_t index ) const;    // Of the entry after the value at index
+};
+
 //----------------------------------------------------------------------------
 //                           class ParserException
 //----------------------------------------------------------------------------
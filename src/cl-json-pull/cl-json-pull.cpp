@@ -31,10 +31,40 @@
 // POSSIBILITY OF SUCH DAMAGE.
 //----------------------------------------------------------------------------
 
+#if ! defined( _WIN32 ) && ! defined( _FILE_OFFSET_BITS )
+    #define _FILE_OFFSET_BITS 64    // Allow ReaderMmap to map files > 4GiB on 32-bit POSIX systems
+#endif
+
 #include "cl-json-pull/cl-json-pull.h"
 
 #include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cfloat>
+#include <clocale>
+#include <algorithm>
+#include <map>
+#include <limits>
 #include <cassert>
+#include <stdint.h>
+
+#if defined( _WIN32 )
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <sys/types.h>
+    #include <sys/stat.h>
+    #include <sys/mman.h>
+    #include <fcntl.h>
+    #include <unistd.h>
+#endif
+
+#if CLJP_USE_SIMD && (defined( __x86_64__ ) || defined( __i386__ ) || defined( _M_X64 ) || defined( _M_IX86 ))
+    #include <immintrin.h>
+    #if defined( _MSC_VER )
+        #include <intrin.h>
+    #endif
+#endif
 
 namespace cljp {    // Codalogic JSON Pull (Parser)
 
@@ -63,6 +93,1832 @@ int code_point_from_surrogates( int high_surrogate, int low_surrogate )
     return ((high_surrogate & 0x3ff) << 10) + (low_surrogate & 0x3ff) + 0x10000;
 }
 
+//----------------------------------------------------------------------------
+//                             UTF-8 validation
+//----------------------------------------------------------------------------
+
+inline bool is_utf8_tail( unsigned char c )
+{
+    return c >= 0x80 && c <= 0xbf;
+}
+
+inline bool is_all_non_nul_ascii( uint64_t eight_bytes )
+{
+    const uint64_t high_bits = 0x8080808080808080ull;
+    const uint64_t low_bits = 0x0101010101010101ull;
+    bool has_non_ascii = (eight_bytes & high_bits) != 0;
+    bool has_nul = ((eight_bytes - low_bits) & ~eight_bytes & high_bits) != 0;
+    return ! has_non_ascii && ! has_nul;
+}
+
+size_t valid_utf8_sequence_length( const unsigned char * p, const unsigned char * p_stop )
+{
+    // Returns the length of the complete and valid UTF-8 sequence starting
+    // at p, or 0 if there isn't one.  As in the byte at a time decoder, NUL
+    // and the non-characters U+FFFE and U+FFFF are treated as invalid.
+    //
+    // From RFC 3629:
+    // UTF8-char   = UTF8-1 / UTF8-2 / UTF8-3 / UTF8-4
+    // UTF8-1      = %x00-7F
+    // UTF8-2      = %xC2-DF UTF8-tail
+    // UTF8-3      = %xE0 %xA0-BF UTF8-tail / %xE1-EC 2( UTF8-tail ) /
+    //               %xED %x80-9F UTF8-tail / %xEE-EF 2( UTF8-tail )
+    // UTF8-4      = %xF0 %x90-BF 2( UTF8-tail ) / %xF1-F3 3( UTF8-tail ) /
+    //               %xF4 %x80-8F 2( UTF8-tail )
+    // UTF8-tail   = %x80-BF
+
+    unsigned char c1 = *p;
+
+    if( c1 < 0x80 )
+        return c1 == 0 ? 0 : 1;
+
+    size_t n_bytes = 0;
+    unsigned char c2_min = 0x80, c2_max = 0xbf;
+
+    if( c1 >= 0xc2 && c1 <= 0xdf )
+        n_bytes = 2;
+    else if( c1 >= 0xe0 && c1 <= 0xef )
+    {
+        n_bytes = 3;
+        if( c1 == 0xe0 )
+            c2_min = 0xa0;
+        else if( c1 == 0xed )
+            c2_max = 0x9f;
+    }
+    else if( c1 >= 0xf0 && c1 <= 0xf4 )
+    {
+        n_bytes = 4;
+        if( c1 == 0xf0 )
+            c2_min = 0x90;
+        else if( c1 == 0xf4 )
+            c2_max = 0x8f;
+    }
+    else
+        return 0;
+
+    if( static_cast< size_t >( p_stop - p ) < n_bytes )
+        return 0;
+
+    if( p[1] < c2_min || p[1] > c2_max )
+        return 0;
+    if( n_bytes >= 3 && ! is_utf8_tail( p[2] ) )
+        return 0;
+    if( n_bytes == 4 && ! is_utf8_tail( p[3] ) )
+        return 0;
+    if( c1 == 0xef && p[1] == 0xbf && p[2] >= 0xbe )    // U+FFFE & U+FFFF are illegal
+        return 0;
+
+    return n_bytes;
+}
+
+const unsigned char * validate_utf8_sequences(
+                                const unsigned char * p,
+                                const unsigned char * p_limit,
+                                const unsigned char * p_stop )
+{
+    // Validates whole sequences starting before p_limit.  Sequences may
+    // extend up to p_stop.  Returns where validation stopped.
+    while( p < p_limit )
+    {
+        size_t n_bytes = valid_utf8_sequence_length( p, p_stop );
+        if( n_bytes == 0 )
+            break;
+        p += n_bytes;
+    }
+    return p;
+}
+
+const char * find_end_of_valid_utf8_scalar( const char * p_begin, const char * p_end )
+{
+    // Returns a pointer to the first byte in [p_begin, p_end) that does not
+    // start a complete and valid UTF-8 sequence.
+    const unsigned char * p = reinterpret_cast< const unsigned char * >( p_begin );
+    const unsigned char * p_stop = reinterpret_cast< const unsigned char * >( p_end );
+
+    while( p < p_stop )
+    {
+        uint64_t eight_bytes;
+        while( p_stop - p >= 8 &&
+                (memcpy( &eight_bytes, p, 8 ), is_all_non_nul_ascii( eight_bytes )) )
+            p += 8;
+
+        if( p == p_stop )
+            break;
+
+        size_t n_bytes = valid_utf8_sequence_length( p, p_stop );
+        if( n_bytes == 0 )
+            break;
+        p += n_bytes;
+    }
+
+    return reinterpret_cast< const char * >( p );
+}
+
+size_t incomplete_utf8_tail_length( const unsigned char * p_block_end )
+{
+    // For a block that has otherwise been validated, returns how many bytes
+    // at its end belong to a sequence that continues into the next block
+    if( p_block_end[-1] >= 0xc0 )
+        return 1;
+    if( p_block_end[-2] >= 0xe0 )
+        return 2;
+    if( p_block_end[-3] >= 0xf0 )
+        return 3;
+    return 0;
+}
+
+#if CLJP_USE_SIMD && (defined( __x86_64__ ) || defined( __i386__ ) || defined( _M_X64 ) || defined( _M_IX86 ))
+    #define CLJP_X86_SIMD 1
+#else
+    #define CLJP_X86_SIMD 0
+#endif
+
+#if CLJP_X86_SIMD
+
+#if defined( __GNUC__ )
+    #define CLJP_TARGET_SSE42 __attribute__(( target( "sse4.2" ) ))
+    #define CLJP_TARGET_AVX2 __attribute__(( target( "avx2" ) ))
+#else
+    #define CLJP_TARGET_SSE42
+    #define CLJP_TARGET_AVX2
+#endif
+
+// The vectorised validators use the lookup table algorithm described in
+// "Validating UTF-8 In Less Than One Instruction Per Byte" (Keiser & Lemire).
+// Each byte is classified by a lookup on the high nibble of the previous
+// byte, the low nibble of the previous byte and the high nibble of the
+// byte itself.  The three results are ANDed together, leaving a bit set
+// for any error in that pair of bytes.  Whether the byte needs to be a 3rd
+// or 4th byte continuation is checked separately.  NUL, U+FFFE and U+FFFF
+// are additionally rejected to match the scalar decoder.
+//
+// Blocks are validated independently, each starting on a sequence
+// boundary.  A sequence that crosses the end of a block is validated as
+// part of the next block, and any block found to contain an error is
+// re-validated by the scalar code so that the exact position of the error
+// is found.
+
+enum {
+    TOO_SHORT = 1 << 0,     // 11______ 0_______ or 11______ 11______
+    TOO_LONG = 1 << 1,      // 0_______ 10______
+    OVERLONG_3 = 1 << 2,    // 11100000 100_____
+    TOO_LARGE = 1 << 3,     // 11110100 1001____ or 11110100 101_____ etc.
+    SURROGATE = 1 << 4,     // 11101101 101_____
+    OVERLONG_2 = 1 << 5,    // 1100000_ 10______
+    TOO_LARGE_1000 = 1 << 6,    // 11110101 1000____ etc.
+    OVERLONG_4 = 1 << 6,    // 11110000 1000____
+    TWO_CONTS = 1 << 7,     // 10______ 10______
+    CARRY = TOO_SHORT | TOO_LONG | TWO_CONTS
+};
+
+#define CLJP_BYTE_1_HIGH_TABLE \
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, \
+    TOO_LONG, TOO_LONG, TOO_LONG, TOO_LONG, \
+    TWO_CONTS, TWO_CONTS, TWO_CONTS, TWO_CONTS, \
+    TOO_SHORT | OVERLONG_2, \
+    TOO_SHORT, \
+    TOO_SHORT | OVERLONG_3 | SURROGATE, \
+    TOO_SHORT | TOO_LARGE | TOO_LARGE_1000 | OVERLONG_4
+
+#define CLJP_BYTE_1_LOW_TABLE \
+    CARRY | OVERLONG_3 | OVERLONG_2 | OVERLONG_4, \
+    CARRY | OVERLONG_2, \
+    CARRY, \
+    CARRY, \
+    CARRY | TOO_LARGE, \
+    CARRY | TOO_LARGE | TOO_LARGE_1000, \
+    CARRY | TOO_LARGE | TOO_LARGE_1000, \
+    CARRY | TOO_LARGE | TOO_LARGE_1000, \
+    CARRY | TOO_LARGE | TOO_LARGE_1000, \
+    CARRY | TOO_LARGE | TOO_LARGE_1000, \
+    CARRY | TOO_LARGE | TOO_LARGE_1000, \
+    CARRY | TOO_LARGE | TOO_LARGE_1000, \
+    CARRY | TOO_LARGE | TOO_LARGE_1000, \
+    CARRY | TOO_LARGE | TOO_LARGE_1000 | SURROGATE, \
+    CARRY | TOO_LARGE | TOO_LARGE_1000, \
+    CARRY | TOO_LARGE | TOO_LARGE_1000
+
+#define CLJP_BYTE_2_HIGH_TABLE \
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, \
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT, \
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE_1000 | OVERLONG_4, \
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | OVERLONG_3 | TOO_LARGE, \
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE, \
+    TOO_LONG | OVERLONG_2 | TWO_CONTS | SURROGATE | TOO_LARGE, \
+    TOO_SHORT, TOO_SHORT, TOO_SHORT, TOO_SHORT
+
+CLJP_TARGET_SSE42
+inline __m128i utf8_errors_sse42( __m128i input, __m128i prev_input )
+{
+    const __m128i nibble_mask = _mm_set1_epi8( 0x0f );
+
+    __m128i prev1 = _mm_alignr_epi8( input, prev_input, 16 - 1 );
+    __m128i prev2 = _mm_alignr_epi8( input, prev_input, 16 - 2 );
+    __m128i prev3 = _mm_alignr_epi8( input, prev_input, 16 - 3 );
+
+    __m128i byte_1_high = _mm_shuffle_epi8(
+                                _mm_setr_epi8( CLJP_BYTE_1_HIGH_TABLE ),
+                                _mm_and_si128( _mm_srli_epi16( prev1, 4 ), nibble_mask ) );
+    __m128i byte_1_low = _mm_shuffle_epi8(
+                                _mm_setr_epi8( CLJP_BYTE_1_LOW_TABLE ),
+                                _mm_and_si128( prev1, nibble_mask ) );
+    __m128i byte_2_high = _mm_shuffle_epi8(
+                                _mm_setr_epi8( CLJP_BYTE_2_HIGH_TABLE ),
+                                _mm_and_si128( _mm_srli_epi16( input, 4 ), nibble_mask ) );
+    __m128i special_cases = _mm_and_si128( _mm_and_si128( byte_1_high, byte_1_low ), byte_2_high );
+
+    // Only 111_____ and 1111____ are >= 0x80 after the subtractions
+    __m128i is_third_byte = _mm_subs_epu8( prev2, _mm_set1_epi8( char(0xe0 - 0x80) ) );
+    __m128i is_fourth_byte = _mm_subs_epu8( prev3, _mm_set1_epi8( char(0xf0 - 0x80) ) );
+    __m128i must_be_2_3_continuation = _mm_and_si128(
+                                _mm_or_si128( is_third_byte, is_fourth_byte ),
+                                _mm_set1_epi8( char(0x80) ) );
+    __m128i errors = _mm_xor_si128( must_be_2_3_continuation, special_cases );
+
+    __m128i is_nul = _mm_cmpeq_epi8( input, _mm_setzero_si128() );
+    __m128i is_non_character = _mm_and_si128( _mm_and_si128(
+                                _mm_cmpeq_epi8( prev2, _mm_set1_epi8( char(0xef) ) ),
+                                _mm_cmpeq_epi8( prev1, _mm_set1_epi8( char(0xbf) ) ) ),
+                                _mm_cmpeq_epi8( _mm_or_si128( input, _mm_set1_epi8( 1 ) ),
+                                                _mm_set1_epi8( char(0xbf) ) ) );
+
+    return _mm_or_si128( errors, _mm_or_si128( is_nul, is_non_character ) );
+}
+
+CLJP_TARGET_SSE42
+const char * find_end_of_valid_utf8_sse42( const char * p_begin, const char * p_end )
+{
+    const size_t block_size = 64;
+
+    const unsigned char * p = reinterpret_cast< const unsigned char * >( p_begin );
+    const unsigned char * p_stop = reinterpret_cast< const unsigned char * >( p_end );
+
+    while( static_cast< size_t >( p_stop - p ) >= block_size )
+    {
+        __m128i in0 = _mm_loadu_si128( reinterpret_cast< const __m128i * >( p ) );
+        __m128i in1 = _mm_loadu_si128( reinterpret_cast< const __m128i * >( p + 16 ) );
+        __m128i in2 = _mm_loadu_si128( reinterpret_cast< const __m128i * >( p + 32 ) );
+        __m128i in3 = _mm_loadu_si128( reinterpret_cast< const __m128i * >( p + 48 ) );
+
+        __m128i any_bits = _mm_or_si128( _mm_or_si128( in0, in1 ), _mm_or_si128( in2, in3 ) );
+        __m128i min_byte = _mm_min_epu8( _mm_min_epu8( in0, in1 ), _mm_min_epu8( in2, in3 ) );
+        if( _mm_movemask_epi8( any_bits ) == 0 &&
+                _mm_movemask_epi8( _mm_cmpeq_epi8( min_byte, _mm_setzero_si128() ) ) == 0 )
+        {
+            p += block_size;    // All non-NUL ASCII
+            continue;
+        }
+
+        __m128i errors = utf8_errors_sse42( in0, _mm_setzero_si128() );
+        errors = _mm_or_si128( errors, utf8_errors_sse42( in1, in0 ) );
+        errors = _mm_or_si128( errors, utf8_errors_sse42( in2, in1 ) );
+        errors = _mm_or_si128( errors, utf8_errors_sse42( in3, in2 ) );
+
+        if( ! _mm_testz_si128( errors, errors ) )
+        {
+            const unsigned char * p_validated = validate_utf8_sequences( p, p + block_size, p_stop );
+            if( p_validated < p + block_size )
+                return reinterpret_cast< const char * >( p_validated );
+            p = p_validated;
+            continue;
+        }
+
+        p += block_size - incomplete_utf8_tail_length( p + block_size );
+    }
+
+    return find_end_of_valid_utf8_scalar( reinterpret_cast< const char * >( p ), p_end );
+}
+
+CLJP_TARGET_AVX2
+inline __m256i prev_bytes_avx2( __m256i input, __m256i prev_input, int n )
+{
+    // _mm256_alignr_epi8() works on each 128-bit lane separately, so the
+    // upper lane of prev_input and lower lane of input are combined first
+    __m256i shifted = _mm256_permute2x128_si256( prev_input, input, 0x21 );
+    switch( n )
+    {
+    case 1: return _mm256_alignr_epi8( input, shifted, 16 - 1 );
+    case 2: return _mm256_alignr_epi8( input, shifted, 16 - 2 );
+    default: return _mm256_alignr_epi8( input, shifted, 16 - 3 );
+    }
+}
+
+CLJP_TARGET_AVX2
+inline __m256i utf8_errors_avx2( __m256i input, __m256i prev_input )
+{
+    const __m256i nibble_mask = _mm256_set1_epi8( 0x0f );
+
+    __m256i prev1 = prev_bytes_avx2( input, prev_input, 1 );
+    __m256i prev2 = prev_bytes_avx2( input, prev_input, 2 );
+    __m256i prev3 = prev_bytes_avx2( input, prev_input, 3 );
+
+    __m256i byte_1_high = _mm256_shuffle_epi8(
+                                _mm256_setr_epi8( CLJP_BYTE_1_HIGH_TABLE, CLJP_BYTE_1_HIGH_TABLE ),
+                                _mm256_and_si256( _mm256_srli_epi16( prev1, 4 ), nibble_mask ) );
+    __m256i byte_1_low = _mm256_shuffle_epi8(
+                                _mm256_setr_epi8( CLJP_BYTE_1_LOW_TABLE, CLJP_BYTE_1_LOW_TABLE ),
+                                _mm256_and_si256( prev1, nibble_mask ) );
+    __m256i byte_2_high = _mm256_shuffle_epi8(
+                                _mm256_setr_epi8( CLJP_BYTE_2_HIGH_TABLE, CLJP_BYTE_2_HIGH_TABLE ),
+                                _mm256_and_si256( _mm256_srli_epi16( input, 4 ), nibble_mask ) );
+    __m256i special_cases = _mm256_and_si256( _mm256_and_si256( byte_1_high, byte_1_low ), byte_2_high );
+
+    __m256i is_third_byte = _mm256_subs_epu8( prev2, _mm256_set1_epi8( char(0xe0 - 0x80) ) );
+    __m256i is_fourth_byte = _mm256_subs_epu8( prev3, _mm256_set1_epi8( char(0xf0 - 0x80) ) );
+    __m256i must_be_2_3_continuation = _mm256_and_si256(
+                                _mm256_or_si256( is_third_byte, is_fourth_byte ),
+                                _mm256_set1_epi8( char(0x80) ) );
+    __m256i errors = _mm256_xor_si256( must_be_2_3_continuation, special_cases );
+
+    __m256i is_nul = _mm256_cmpeq_epi8( input, _mm256_setzero_si256() );
+    __m256i is_non_character = _mm256_and_si256( _mm256_and_si256(
+                                _mm256_cmpeq_epi8( prev2, _mm256_set1_epi8( char(0xef) ) ),
+                                _mm256_cmpeq_epi8( prev1, _mm256_set1_epi8( char(0xbf) ) ) ),
+                                _mm256_cmpeq_epi8( _mm256_or_si256( input, _mm256_set1_epi8( 1 ) ),
+                                                _mm256_set1_epi8( char(0xbf) ) ) );
+
+    return _mm256_or_si256( errors, _mm256_or_si256( is_nul, is_non_character ) );
+}
+
+CLJP_TARGET_AVX2
+const char * find_end_of_valid_utf8_avx2( const char * p_begin, const char * p_end )
+{
+    const size_t block_size = 64;
+
+    const unsigned char * p = reinterpret_cast< const unsigned char * >( p_begin );
+    const unsigned char * p_stop = reinterpret_cast< const unsigned char * >( p_end );
+
+    while( static_cast< size_t >( p_stop - p ) >= block_size )
+    {
+        __m256i in0 = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( p ) );
+        __m256i in1 = _mm256_loadu_si256( reinterpret_cast< const __m256i * >( p + 32 ) );
+
+        __m256i min_byte = _mm256_min_epu8( in0, in1 );
+        if( _mm256_movemask_epi8( _mm256_or_si256( in0, in1 ) ) == 0 &&
+                _mm256_movemask_epi8( _mm256_cmpeq_epi8( min_byte, _mm256_setzero_si256() ) ) == 0 )
+        {
+            p += block_size;    // All non-NUL ASCII
+            continue;
+        }
+
+        __m256i errors = utf8_errors_avx2( in0, _mm256_setzero_si256() );
+        errors = _mm256_or_si256( errors, utf8_errors_avx2( in1, in0 ) );
+
+        if( ! _mm256_testz_si256( errors, errors ) )
+        {
+            const unsigned char * p_validated = validate_utf8_sequences( p, p + block_size, p_stop );
+            if( p_validated < p + block_size )
+                return reinterpret_cast< const char * >( p_validated );
+            p = p_validated;
+            continue;
+        }
+
+        p += block_size - incomplete_utf8_tail_length( p + block_size );
+    }
+
+    return find_end_of_valid_utf8_scalar( reinterpret_cast< const char * >( p ), p_end );
+}
+
+bool is_cpu_feature_supported( ReadUTF8Base::UTF8Validators validator )
+{
+#if defined( _MSC_VER )
+    int cpu_info[4];
+    __cpuid( cpu_info, 0 );
+    int max_leaf = cpu_info[0];
+    if( max_leaf < 1 )
+        return false;
+    __cpuid( cpu_info, 1 );
+    bool has_sse42 = (cpu_info[2] & (1 << 20)) != 0;
+    bool has_osxsave = (cpu_info[2] & (1 << 27)) != 0;
+    bool has_avx = (cpu_info[2] & (1 << 28)) != 0;
+    if( validator == ReadUTF8Base::UV_SSE42 )
+        return has_sse42;
+    if( validator == ReadUTF8Base::UV_AVX2 )
+    {
+        if( max_leaf < 7 || ! has_osxsave || ! has_avx || (_xgetbv( 0 ) & 0x6) != 0x6 )
+            return false;
+        __cpuidex( cpu_info, 7, 0 );
+        return (cpu_info[1] & (1 << 5)) != 0;
+    }
+    return false;
+#else
+    __builtin_cpu_init();
+    if( validator == ReadUTF8Base::UV_SSE42 )
+        return __builtin_cpu_supports( "sse4.2" );
+    if( validator == ReadUTF8Base::UV_AVX2 )
+        return __builtin_cpu_supports( "avx2" );
+    return false;
+#endif
+}
+
+#endif  // CLJP_X86_SIMD
+
+typedef const char * (*FindEndOfValidUTF8Func)( const char * p_begin, const char * p_end );
+
+bool is_utf8_validator_available( ReadUTF8Base::UTF8Validators validator )
+{
+    if( validator == ReadUTF8Base::UV_SCALAR )
+        return true;
+#if CLJP_X86_SIMD
+    return is_cpu_feature_supported( validator );
+#else
+    return false;
+#endif
+}
+
+ReadUTF8Base::UTF8Validators best_utf8_validator()
+{
+    if( is_utf8_validator_available( ReadUTF8Base::UV_AVX2 ) )
+        return ReadUTF8Base::UV_AVX2;
+    if( is_utf8_validator_available( ReadUTF8Base::UV_SSE42 ) )
+        return ReadUTF8Base::UV_SSE42;
+    return ReadUTF8Base::UV_SCALAR;
+}
+
+FindEndOfValidUTF8Func utf8_validator_func( ReadUTF8Base::UTF8Validators validator )
+{
+#if CLJP_X86_SIMD
+    if( validator == ReadUTF8Base::UV_AVX2 )
+        return find_end_of_valid_utf8_avx2;
+    if( validator == ReadUTF8Base::UV_SSE42 )
+        return find_end_of_valid_utf8_sse42;
+#endif
+    return find_end_of_valid_utf8_scalar;
+}
+
+// Selected once at start-up from the instructions the CPU supports
+ReadUTF8Base::UTF8Validators selected_utf8_validator = best_utf8_validator();
+FindEndOfValidUTF8Func p_find_end_of_valid_utf8 = utf8_validator_func( selected_utf8_validator );
+
+bool is_sse42_enabled()
+{
+    // UTF-16 and UTF-32 transcoding, and the scanning done by skip(), use
+    // SSE4.2 unless the scalar UTF-8 validator has been selected
+    return selected_utf8_validator != ReadUTF8Base::UV_SCALAR;
+}
+
+inline const char * find_end_of_valid_utf8( const char * p_begin, const char * p_end )
+{
+    // Returns a pointer to the first byte in [p_begin, p_end) that does not
+    // start a complete and valid UTF-8 sequence.
+    return p_find_end_of_valid_utf8( p_begin, p_end );
+}
+
+//----------------------------------------------------------------------------
+//                        UTF-16 / UTF-32 transcoding
+//----------------------------------------------------------------------------
+
+#if CLJP_X86_SIMD
+
+// The vectorised transcoders convert runs of ASCII code units, which make up
+// the bulk of most JSON, 8 at a time.  They return the number of code units
+// converted, stopping at the first group of 8 that includes a non-ASCII or
+// NUL code unit.
+
+CLJP_TARGET_SSE42
+size_t transcode_ascii_utf16_sse42(
+                            const unsigned char * p_in, size_t n_units,
+                            char * p_out, bool is_big_endian )
+{
+    const __m128i non_ascii_mask = _mm_set1_epi16( static_cast< short >( 0xff80 ) );
+    const __m128i swap_bytes = _mm_setr_epi8( 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 );
+
+    size_t n_done = 0;
+    while( n_units - n_done >= 8 )
+    {
+        __m128i units = _mm_loadu_si128( reinterpret_cast< const __m128i * >( p_in + n_done * 2 ) );
+        if( is_big_endian )
+            units = _mm_shuffle_epi8( units, swap_bytes );
+
+        __m128i invalid = _mm_or_si128( _mm_and_si128( units, non_ascii_mask ),
+                                        _mm_cmpeq_epi16( units, _mm_setzero_si128() ) );
+        if( ! _mm_testz_si128( invalid, invalid ) )
+            break;
+
+        _mm_storel_epi64( reinterpret_cast< __m128i * >( p_out + n_done ), _mm_packus_epi16( units, units ) );
+        n_done += 8;
+    }
+    return n_done;
+}
+
+CLJP_TARGET_SSE42
+size_t transcode_ascii_utf32_sse42(
+                            const unsigned char * p_in, size_t n_units,
+                            char * p_out, bool is_big_endian )
+{
+    const __m128i non_ascii_mask = _mm_set1_epi32( static_cast< int >( 0xffffff80 ) );
+    const __m128i swap_bytes = _mm_setr_epi8( 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 );
+
+    size_t n_done = 0;
+    while( n_units - n_done >= 8 )
+    {
+        __m128i units0 = _mm_loadu_si128( reinterpret_cast< const __m128i * >( p_in + n_done * 4 ) );
+        __m128i units1 = _mm_loadu_si128( reinterpret_cast< const __m128i * >( p_in + n_done * 4 + 16 ) );
+        if( is_big_endian )
+        {
+            units0 = _mm_shuffle_epi8( units0, swap_bytes );
+            units1 = _mm_shuffle_epi8( units1, swap_bytes );
+        }
+
+        __m128i invalid = _mm_or_si128(
+                _mm_or_si128( _mm_and_si128( units0, non_ascii_mask ),
+                                _mm_cmpeq_epi32( units0, _mm_setzero_si128() ) ),
+                _mm_or_si128( _mm_and_si128( units1, non_ascii_mask ),
+                                _mm_cmpeq_epi32( units1, _mm_setzero_si128() ) ) );
+        if( ! _mm_testz_si128( invalid, invalid ) )
+            break;
+
+        __m128i units16 = _mm_packs_epi32( units0, units1 );
+        _mm_storel_epi64( reinterpret_cast< __m128i * >( p_out + n_done ), _mm_packus_epi16( units16, units16 ) );
+        n_done += 8;
+    }
+    return n_done;
+}
+
+#endif  // CLJP_X86_SIMD
+
+inline uint32_t read_utf16_unit( const unsigned char * p, bool is_big_endian )
+{
+    return is_big_endian ? (p[0] << 8) | p[1] : p[0] | (p[1] << 8);
+}
+
+inline uint32_t read_utf32_unit( const unsigned char * p, bool is_big_endian )
+{
+    if( is_big_endian )
+        return (uint32_t( p[0] ) << 24) | (uint32_t( p[1] ) << 16) | (uint32_t( p[2] ) << 8) | p[3];
+    return p[0] | (uint32_t( p[1] ) << 8) | (uint32_t( p[2] ) << 16) | (uint32_t( p[3] ) << 24);
+}
+
+inline size_t pack_utf8( uint32_t code_point, char * p_out )
+{
+    if( code_point <= 0x7f )
+    {
+        p_out[0] = static_cast< char >( code_point );
+        return 1;
+    }
+    if( code_point <= 0x7ff )
+    {
+        p_out[0] = static_cast< char >( 0xc0 | (code_point >> 6) );
+        p_out[1] = static_cast< char >( 0x80 | (code_point & 0x3f) );
+        return 2;
+    }
+    if( code_point <= 0xffff )
+    {
+        p_out[0] = static_cast< char >( 0xe0 | (code_point >> 12) );
+        p_out[1] = static_cast< char >( 0x80 | ((code_point >> 6) & 0x3f) );
+        p_out[2] = static_cast< char >( 0x80 | (code_point & 0x3f) );
+        return 3;
+    }
+    p_out[0] = static_cast< char >( 0xf0 | (code_point >> 18) );
+    p_out[1] = static_cast< char >( 0x80 | ((code_point >> 12) & 0x3f) );
+    p_out[2] = static_cast< char >( 0x80 | ((code_point >> 6) & 0x3f) );
+    p_out[3] = static_cast< char >( 0x80 | (code_point & 0x3f) );
+    return 4;
+}
+
+size_t transcode_to_utf8(
+                ReadUTF8Base::Modes mode,
+                const char * p_begin, const char * p_end,
+                char * p_out, size_t out_capacity, size_t * p_n_out )
+{
+    // Converts whole UTF-16 or UTF-32 code points in [p_begin, p_end) to
+    // UTF-8 until the output is full.  Returns the number of input bytes
+    // converted.  Conversion stops at a code point that crosses the end of
+    // the input, and at any code point that the byte at a time decoder
+    // rejects (U+0000, unpaired surrogates and, for UTF-32, values above
+    // U+10FFFF) so that it can report the error.
+    const size_t max_utf8_length = 4;
+
+    const unsigned char * p_in = reinterpret_cast< const unsigned char * >( p_begin );
+    const unsigned char * p_in_end = reinterpret_cast< const unsigned char * >( p_end );
+    bool is_big_endian = mode == ReadUTF8Base::UTF16BE || mode == ReadUTF8Base::UTF32BE;
+    bool is_utf16 = mode == ReadUTF8Base::UTF16LE || mode == ReadUTF8Base::UTF16BE;
+    size_t unit_size = is_utf16 ? 2 : 4;
+    size_t n_out = 0;
+
+#if CLJP_X86_SIMD
+    bool is_simd = is_sse42_enabled();
+#endif
+
+    while( out_capacity - n_out >= max_utf8_length &&
+            static_cast< size_t >( p_in_end - p_in ) >= unit_size )
+    {
+#if CLJP_X86_SIMD
+        if( is_simd )
+        {
+            size_t n_units = std::min( static_cast< size_t >( p_in_end - p_in ) / unit_size,
+                                        out_capacity - n_out );
+            size_t n_ascii = is_utf16 ?
+                    transcode_ascii_utf16_sse42( p_in, n_units, p_out + n_out, is_big_endian ) :
+                    transcode_ascii_utf32_sse42( p_in, n_units, p_out + n_out, is_big_endian );
+            p_in += n_ascii * unit_size;
+            n_out += n_ascii;
+            if( out_capacity - n_out < max_utf8_length ||
+                    static_cast< size_t >( p_in_end - p_in ) < unit_size )
+                break;
+        }
+#endif
+
+        uint32_t code_point;
+        size_t n_in;
+
+        if( is_utf16 )
+        {
+            code_point = read_utf16_unit( p_in, is_big_endian );
+            n_in = 2;
+            if( is_low_surrogate( code_point ) )
+                break;
+            if( is_high_surrogate( code_point ) )
+            {
+                if( p_in_end - p_in < 4 )
+                    break;
+                uint32_t low_surrogate = read_utf16_unit( p_in + 2, is_big_endian );
+                if( ! is_low_surrogate( low_surrogate ) )
+                    break;
+                code_point = code_point_from_surrogates( code_point, low_surrogate );
+                n_in = 4;
+            }
+        }
+        else
+        {
+            code_point = read_utf32_unit( p_in, is_big_endian );
+            n_in = 4;
+            if( code_point > 0x10ffff || is_high_surrogate( code_point ) || is_low_surrogate( code_point ) )
+                break;
+        }
+
+        if( code_point == 0 )
+            break;
+
+        n_out += pack_utf8( code_point, p_out + n_out );
+        p_in += n_in;
+    }
+
+    *p_n_out = n_out;
+    return p_in - reinterpret_cast< const unsigned char * >( p_begin );
+}
+
+//----------------------------------------------------------------------------
+//                       Structural index construction
+//----------------------------------------------------------------------------
+
+// Each 64 byte block of input is classified into bit masks, one bit per
+// byte, which are then combined with bitwise operations to find the
+// positions to index.  Only the classification uses SIMD instructions.
+
+struct BlockMasks
+{
+    uint64_t quote;
+    uint64_t backslash;
+    uint64_t whitespace;    // As isspace(), i.e. including \v and \f
+    uint64_t structural;    // {}[]:,
+    uint64_t control;       // < 0x20
+};
+
+void classify_block_scalar( const unsigned char * p, BlockMasks * p_masks )
+{
+    BlockMasks masks = { 0, 0, 0, 0, 0 };
+    for( size_t i = 0; i < 64; ++i )
+    {
+        unsigned char c = p[i];
+        uint64_t bit = uint64_t( 1 ) << i;
+        if( c == '"' )
+            masks.quote |= bit;
+        else if( c == '\\' )
+            masks.backslash |= bit;
+        else if( c == ' ' || (c >= '\t' && c <= '\r') )
+            masks.whitespace |= bit;
+        else if( c == '{' || c == '}' || c == '[' || c == ']' || c == ':' || c == ',' )
+            masks.structural |= bit;
+        if( c < 0x20 )
+            masks.control |= bit;
+    }
+    *p_masks = masks;
+}
+
+#if CLJP_X86_SIMD
+
+CLJP_TARGET_SSE42
+inline void classify_16_sse42( __m128i in, size_t shift, BlockMasks * p_masks )
+{
+    __m128i structural = _mm_or_si128(
+            _mm_or_si128( _mm_cmpeq_epi8( in, _mm_set1_epi8( '{' ) ), _mm_cmpeq_epi8( in, _mm_set1_epi8( '}' ) ) ),
+            _mm_or_si128(
+                _mm_or_si128( _mm_cmpeq_epi8( in, _mm_set1_epi8( '[' ) ), _mm_cmpeq_epi8( in, _mm_set1_epi8( ']' ) ) ),
+                _mm_or_si128( _mm_cmpeq_epi8( in, _mm_set1_epi8( ':' ) ), _mm_cmpeq_epi8( in, _mm_set1_epi8( ',' ) ) ) ) );
+    __m128i tab_to_cr = _mm_sub_epi8( in, _mm_set1_epi8( '\t' ) );
+    __m128i whitespace = _mm_or_si128( _mm_cmpeq_epi8( in, _mm_set1_epi8( ' ' ) ),
+            _mm_cmpeq_epi8( _mm_min_epu8( tab_to_cr, _mm_set1_epi8( '\r' - '\t' ) ), tab_to_cr ) );
+    __m128i control = _mm_cmpeq_epi8( _mm_max_epu8( in, _mm_set1_epi8( 0x1f ) ), _mm_set1_epi8( 0x1f ) );
+
+    p_masks->quote |= uint64_t( static_cast< uint16_t >( _mm_movemask_epi8( _mm_cmpeq_epi8( in, _mm_set1_epi8( '"' ) ) ) ) ) << shift;
+    p_masks->backslash |= uint64_t( static_cast< uint16_t >( _mm_movemask_epi8( _mm_cmpeq_epi8( in, _mm_set1_epi8( '\\' ) ) ) ) ) << shift;
+    p_masks->whitespace |= uint64_t( static_cast< uint16_t >( _mm_movemask_epi8( whitespace ) ) ) << shift;
+    p_masks->structural |= uint64_t( static_cast< uint16_t >( _mm_movemask_epi8( structural ) ) ) << shift;
+    p_masks->control |= uint64_t( static_cast< uint16_t >( _mm_movemask_epi8( control ) ) ) << shift;
+}
+
+CLJP_TARGET_SSE42
+void classify_block_sse42( const unsigned char * p, BlockMasks * p_masks )
+{
+    BlockMasks masks = { 0, 0, 0, 0, 0 };
+    for( size_t i = 0; i < 64; i += 16 )
+        classify_16_sse42( _mm_loadu_si128( reinterpret_cast< const __m128i * >( p + i ) ), i, &masks );
+    *p_masks = masks;
+}
+
+CLJP_TARGET_AVX2
+inline void classify_32_avx2( __m256i in, size_t shift, BlockMasks * p_masks )
+{
+    __m256i structural = _mm256_or_si256(
+            _mm256_or_si256( _mm256_cmpeq_epi8( in, _mm256_set1_epi8( '{' ) ), _mm256_cmpeq_epi8( in, _mm256_set1_epi8( '}' ) ) ),
+            _mm256_or_si256(
+                _mm256_or_si256( _mm256_cmpeq_epi8( in, _mm256_set1_epi8( '[' ) ), _mm256_cmpeq_epi8( in, _mm256_set1_epi8( ']' ) ) ),
+                _mm256_or_si256( _mm256_cmpeq_epi8( in, _mm256_set1_epi8( ':' ) ), _mm256_cmpeq_epi8( in, _mm256_set1_epi8( ',' ) ) ) ) );
+    __m256i tab_to_cr = _mm256_sub_epi8( in, _mm256_set1_epi8( '\t' ) );
+    __m256i whitespace = _mm256_or_si256( _mm256_cmpeq_epi8( in, _mm256_set1_epi8( ' ' ) ),
+            _mm256_cmpeq_epi8( _mm256_min_epu8( tab_to_cr, _mm256_set1_epi8( '\r' - '\t' ) ), tab_to_cr ) );
+    __m256i control = _mm256_cmpeq_epi8( _mm256_max_epu8( in, _mm256_set1_epi8( 0x1f ) ), _mm256_set1_epi8( 0x1f ) );
+
+    p_masks->quote |= uint64_t( static_cast< uint32_t >( _mm256_movemask_epi8( _mm256_cmpeq_epi8( in, _mm256_set1_epi8( '"' ) ) ) ) ) << shift;
+    p_masks->backslash |= uint64_t( static_cast< uint32_t >( _mm256_movemask_epi8( _mm256_cmpeq_epi8( in, _mm256_set1_epi8( '\\' ) ) ) ) ) << shift;
+    p_masks->whitespace |= uint64_t( static_cast< uint32_t >( _mm256_movemask_epi8( whitespace ) ) ) << shift;
+    p_masks->structural |= uint64_t( static_cast< uint32_t >( _mm256_movemask_epi8( structural ) ) ) << shift;
+    p_masks->control |= uint64_t( static_cast< uint32_t >( _mm256_movemask_epi8( control ) ) ) << shift;
+}
+
+CLJP_TARGET_AVX2
+void classify_block_avx2( const unsigned char * p, BlockMasks * p_masks )
+{
+    BlockMasks masks = { 0, 0, 0, 0, 0 };
+    classify_32_avx2( _mm256_loadu_si256( reinterpret_cast< const __m256i * >( p ) ), 0, &masks );
+    classify_32_avx2( _mm256_loadu_si256( reinterpret_cast< const __m256i * >( p + 32 ) ), 32, &masks );
+    *p_masks = masks;
+}
+
+#endif  // CLJP_X86_SIMD
+
+typedef void (*ClassifyBlockFunc)( const unsigned char * p, BlockMasks * p_masks );
+
+ClassifyBlockFunc classify_block_func()
+{
+    // Uses the same instruction set as has been selected for UTF-8 validation
+#if CLJP_X86_SIMD
+    if( selected_utf8_validator == ReadUTF8Base::UV_AVX2 )
+        return classify_block_avx2;
+    if( selected_utf8_validator == ReadUTF8Base::UV_SSE42 )
+        return classify_block_sse42;
+#endif
+    return classify_block_scalar;
+}
+
+inline unsigned int count_trailing_zeros( uint64_t bits )
+{
+    assert( bits != 0 );
+#if defined( __GNUC__ )
+    return __builtin_ctzll( bits );
+#else
+    unsigned int n = 0;
+    while( (bits & 1) == 0 )
+    {
+        bits >>= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+inline uint64_t prefix_xor( uint64_t bits )
+{
+    // Each bit becomes the XOR of itself and all lower bits
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+
+class StructuralIndexer
+{
+private:
+    struct Members {
+        std::vector< uint32_t > * p_positions;
+        size_t n_positions;         // p_positions is over-allocated while building
+        ClassifyBlockFunc classify_block;
+        bool is_prev_escaped;       // Carried over from the previous block
+        bool is_prev_in_string;
+        bool is_prev_whitespace;
+
+        Members( std::vector< uint32_t > * p_positions_in )
+            :
+            p_positions( p_positions_in ),
+            n_positions( 0 ),
+            classify_block( classify_block_func() ),
+            is_prev_escaped( false ),
+            is_prev_in_string( false ),
+            is_prev_whitespace( false )
+        {}
+    } m;
+
+public:
+    StructuralIndexer( std::vector< uint32_t > * p_positions_in )
+        : m( p_positions_in )
+    {}
+    void finish()
+    {
+        m.p_positions->resize( m.n_positions );
+    }
+
+    void add_block( const unsigned char * p_block, uint32_t offset, size_t n_valid = 64 )
+    {
+        BlockMasks masks;
+        m.classify_block( p_block, &masks );
+
+        uint64_t escaped = find_escaped( masks.backslash );
+        uint64_t quote = masks.quote & ~escaped;
+        uint64_t in_string = prefix_xor( quote ) ^ (m.is_prev_in_string ? ~uint64_t( 0 ) : 0);
+        m.is_prev_in_string = (in_string >> 63) != 0;
+
+        uint64_t follows_whitespace = (masks.whitespace << 1) | (m.is_prev_whitespace ? 1 : 0);
+        m.is_prev_whitespace = (masks.whitespace >> 63) != 0;
+
+        // in_string includes the opening quote but not the closing quote
+        uint64_t stops = quote |
+                ((masks.structural | (follows_whitespace & ~masks.whitespace)) & ~in_string) |
+                (((masks.backslash & ~escaped) | masks.control) & in_string);
+
+        if( n_valid < 64 )
+            stops &= (uint64_t( 1 ) << n_valid) - 1;
+
+        if( m.p_positions->size() - m.n_positions < 64 )
+            m.p_positions->resize( std::max< size_t >( 1024, m.p_positions->size() * 2 ) );
+
+        uint32_t * p_position = &(*m.p_positions)[m.n_positions];
+        while( stops != 0 )
+        {
+            *p_position++ = offset + count_trailing_zeros( stops );
+            stops &= stops - 1;
+        }
+        m.n_positions = p_position - &(*m.p_positions)[0];
+    }
+
+private:
+    uint64_t find_escaped( uint64_t backslash )
+    {
+        // Returns the characters that are escaped by a preceding backslash.
+        // Backslashes are rare enough to be handled one at a time.
+        uint64_t escaped = 0;
+        if( m.is_prev_escaped )
+        {
+            escaped = 1;
+            backslash &= ~uint64_t( 1 );
+        }
+        m.is_prev_escaped = false;
+
+        while( backslash != 0 )
+        {
+            unsigned int i = count_trailing_zeros( backslash );
+            if( i == 63 )
+            {
+                m.is_prev_escaped = true;
+                break;
+            }
+            escaped |= uint64_t( 1 ) << (i + 1);
+            backslash &= ~(uint64_t( 3 ) << i);
+        }
+        return escaped;
+    }
+};
+
+//----------------------------------------------------------------------------
+//                       Decimal to double conversion
+//----------------------------------------------------------------------------
+
+// Converts numbers of the form w * 10^q, where w has at most 19 digits, to a
+// correctly rounded double using the Eisel-Lemire algorithm (see Daniel
+// Lemire, "Number Parsing at a Gigabyte per Second").  The rare cases it
+// can't decide are passed to strtod().
+
+const int smallest_power_of_ten = -342;     // Smaller powers always give 0
+const int largest_power_of_ten = 308;       // Larger powers always give infinity
+
+// 128-bit approximations of 5^q, normalised so the most significant bit is
+// set, for q from smallest_power_of_ten to largest_power_of_ten.  Negative
+// powers are rounded up, and positive powers truncated.
+const uint64_t powers_of_five_128[][2] = {
+    { UINT64_C( 0xeef453d6923bd65a ), UINT64_C( 0x113faa2906a13b3f ) },   // 5^-342
+    { UINT64_C( 0x9558b4661b6565f8 ), UINT64_C( 0x4ac7ca59a424c507 ) },   // 5^-341
+    { UINT64_C( 0xbaaee17fa23ebf76 ), UINT64_C( 0x5d79bcf00d2df649 ) },   // 5^-340
+    { UINT64_C( 0xe95a99df8ace6f53 ), UINT64_C( 0xf4d82c2c107973dc ) },   // 5^-339
+    { UINT64_C( 0x91d8a02bb6c10594 ), UINT64_C( 0x79071b9b8a4be869 ) },   // 5^-338
+    { UINT64_C( 0xb64ec836a47146f9 ), UINT64_C( 0x9748e2826cdee284 ) },   // 5^-337
+    { UINT64_C( 0xe3e27a444d8d98b7 ), UINT64_C( 0xfd1b1b2308169b25 ) },   // 5^-336
+    { UINT64_C( 0x8e6d8c6ab0787f72 ), UINT64_C( 0xfe30f0f5e50e20f7 ) },   // 5^-335
+    { UINT64_C( 0xb208ef855c969f4f ), UINT64_C( 0xbdbd2d335e51a935 ) },   // 5^-334
+    { UINT64_C( 0xde8b2b66b3bc4723 ), UINT64_C( 0xad2c788035e61382 ) },   // 5^-333
+    { UINT64_C( 0x8b16fb203055ac76 ), UINT64_C( 0x4c3bcb5021afcc31 ) },   // 5^-332
+    { UINT64_C( 0xaddcb9e83c6b1793 ), UINT64_C( 0xdf4abe242a1bbf3d ) },   // 5^-331
+    { UINT64_C( 0xd953e8624b85dd78 ), UINT64_C( 0xd71d6dad34a2af0d ) },   // 5^-330
+    { UINT64_C( 0x87d4713d6f33aa6b ), UINT64_C( 0x8672648c40e5ad68 ) },   // 5^-329
+    { UINT64_C( 0xa9c98d8ccb009506 ), UINT64_C( 0x680efdaf511f18c2 ) },   // 5^-328
+    { UINT64_C( 0xd43bf0effdc0ba48 ), UINT64_C( 0x0212bd1b2566def2 ) },   // 5^-327
+    { UINT64_C( 0x84a57695fe98746d ), UINT64_C( 0x014bb630f7604b57 ) },   // 5^-326
+    { UINT64_C( 0xa5ced43b7e3e9188 ), UINT64_C( 0x419ea3bd35385e2d ) },   // 5^-325
+    { UINT64_C( 0xcf42894a5dce35ea ), UINT64_C( 0x52064cac828675b9 ) },   // 5^-324
+    { UINT64_C( 0x818995ce7aa0e1b2 ), UINT64_C( 0x7343efebd1940993 ) },   // 5^-323
+    { UINT64_C( 0xa1ebfb4219491a1f ), UINT64_C( 0x1014ebe6c5f90bf8 ) },   // 5^-322
+    { UINT64_C( 0xca66fa129f9b60a6 ), UINT64_C( 0xd41a26e077774ef6 ) },   // 5^-321
+    { UINT64_C( 0xfd00b897478238d0 ), UINT64_C( 0x8920b098955522b4 ) },   // 5^-320
+    { UINT64_C( 0x9e20735e8cb16382 ), UINT64_C( 0x55b46e5f5d5535b0 ) },   // 5^-319
+    { UINT64_C( 0xc5a890362fddbc62 ), UINT64_C( 0xeb2189f734aa831d ) },   // 5^-318
+    { UINT64_C( 0xf712b443bbd52b7b ), UINT64_C( 0xa5e9ec7501d523e4 ) },   // 5^-317
+    { UINT64_C( 0x9a6bb0aa55653b2d ), UINT64_C( 0x47b233c92125366e ) },   // 5^-316
+    { UINT64_C( 0xc1069cd4eabe89f8 ), UINT64_C( 0x999ec0bb696e840a ) },   // 5^-315
+    { UINT64_C( 0xf148440a256e2c76 ), UINT64_C( 0xc00670ea43ca250d ) },   // 5^-314
+    { UINT64_C( 0x96cd2a865764dbca ), UINT64_C( 0x380406926a5e5728 ) },   // 5^-313
+    { UINT64_C( 0xbc807527ed3e12bc ), UINT64_C( 0xc605083704f5ecf2 ) },   // 5^-312
+    { UINT64_C( 0xeba09271e88d976b ), UINT64_C( 0xf7864a44c633682e ) },   // 5^-311
+    { UINT64_C( 0x93445b8731587ea3 ), UINT64_C( 0x7ab3ee6afbe0211d ) },   // 5^-310
+    { UINT64_C( 0xb8157268fdae9e4c ), UINT64_C( 0x5960ea05bad82964 ) },   // 5^-309
+    { UINT64_C( 0xe61acf033d1a45df ), UINT64_C( 0x6fb92487298e33bd ) },   // 5^-308
+    { UINT64_C( 0x8fd0c16206306bab ), UINT64_C( 0xa5d3b6d479f8e056 ) },   // 5^-307
+    { UINT64_C( 0xb3c4f1ba87bc8696 ), UINT64_C( 0x8f48a4899877186c ) },   // 5^-306
+    { UINT64_C( 0xe0b62e2929aba83c ), UINT64_C( 0x331acdabfe94de87 ) },   // 5^-305
+    { UINT64_C( 0x8c71dcd9ba0b4925 ), UINT64_C( 0x9ff0c08b7f1d0b14 ) },   // 5^-304
+    { UINT64_C( 0xaf8e5410288e1b6f ), UINT64_C( 0x07ecf0ae5ee44dd9 ) },   // 5^-303
+    { UINT64_C( 0xdb71e91432b1a24a ), UINT64_C( 0xc9e82cd9f69d6150 ) },   // 5^-302
+    { UINT64_C( 0x892731ac9faf056e ), UINT64_C( 0xbe311c083a225cd2 ) },   // 5^-301
+    { UINT64_C( 0xab70fe17c79ac6ca ), UINT64_C( 0x6dbd630a48aaf406 ) },   // 5^-300
+    { UINT64_C( 0xd64d3d9db981787d ), UINT64_C( 0x092cbbccdad5b108 ) },   // 5^-299
+    { UINT64_C( 0x85f0468293f0eb4e ), UINT64_C( 0x25bbf56008c58ea5 ) },   // 5^-298
+    { UINT64_C( 0xa76c582338ed2621 ), UINT64_C( 0xaf2af2b80af6f24e ) },   // 5^-297
+    { UINT64_C( 0xd1476e2c07286faa ), UINT64_C( 0x1af5af660db4aee1 ) },   // 5^-296
+    { UINT64_C( 0x82cca4db847945ca ), UINT64_C( 0x50d98d9fc890ed4d ) },   // 5^-295
+    { UINT64_C( 0xa37fce126597973c ), UINT64_C( 0xe50ff107bab528a0 ) },   // 5^-294
+    { UINT64_C( 0xcc5fc196fefd7d0c ), UINT64_C( 0x1e53ed49a96272c8 ) },   // 5^-293
+    { UINT64_C( 0xff77b1fcbebcdc4f ), UINT64_C( 0x25e8e89c13bb0f7a ) },   // 5^-292
+    { UINT64_C( 0x9faacf3df73609b1 ), UINT64_C( 0x77b191618c54e9ac ) },   // 5^-291
+    { UINT64_C( 0xc795830d75038c1d ), UINT64_C( 0xd59df5b9ef6a2417 ) },   // 5^-290
+    { UINT64_C( 0xf97ae3d0d2446f25 ), UINT64_C( 0x4b0573286b44ad1d ) },   // 5^-289
+    { UINT64_C( 0x9becce62836ac577 ), UINT64_C( 0x4ee367f9430aec32 ) },   // 5^-288
+    { UINT64_C( 0xc2e801fb244576d5 ), UINT64_C( 0x229c41f793cda73f ) },   // 5^-287
+    { UINT64_C( 0xf3a20279ed56d48a ), UINT64_C( 0x6b43527578c1110f ) },   // 5^-286
+    { UINT64_C( 0x9845418c345644d6 ), UINT64_C( 0x830a13896b78aaa9 ) },   // 5^-285
+    { UINT64_C( 0xbe5691ef416bd60c ), UINT64_C( 0x23cc986bc656d553 ) },   // 5^-284
+    { UINT64_C( 0xedec366b11c6cb8f ), UINT64_C( 0x2cbfbe86b7ec8aa8 ) },   // 5^-283
+    { UINT64_C( 0x94b3a202eb1c3f39 ), UINT64_C( 0x7bf7d71432f3d6a9 ) },   // 5^-282
+    { UINT64_C( 0xb9e08a83a5e34f07 ), UINT64_C( 0xdaf5ccd93fb0cc53 ) },   // 5^-281
+    { UINT64_C( 0xe858ad248f5c22c9 ), UINT64_C( 0xd1b3400f8f9cff68 ) },   // 5^-280
+    { UINT64_C( 0x91376c36d99995be ), UINT64_C( 0x23100809b9c21fa1 ) },   // 5^-279
+    { UINT64_C( 0xb58547448ffffb2d ), UINT64_C( 0xabd40a0c2832a78a ) },   // 5^-278
+    { UINT64_C( 0xe2e69915b3fff9f9 ), UINT64_C( 0x16c90c8f323f516c ) },   // 5^-277
+    { UINT64_C( 0x8dd01fad907ffc3b ), UINT64_C( 0xae3da7d97f6792e3 ) },   // 5^-276
+    { UINT64_C( 0xb1442798f49ffb4a ), UINT64_C( 0x99cd11cfdf41779c ) },   // 5^-275
+    { UINT64_C( 0xdd95317f31c7fa1d ), UINT64_C( 0x40405643d711d583 ) },   // 5^-274
+    { UINT64_C( 0x8a7d3eef7f1cfc52 ), UINT64_C( 0x482835ea666b2572 ) },   // 5^-273
+    { UINT64_C( 0xad1c8eab5ee43b66 ), UINT64_C( 0xda3243650005eecf ) },   // 5^-272
+    { UINT64_C( 0xd863b256369d4a40 ), UINT64_C( 0x90bed43e40076a82 ) },   // 5^-271
+    { UINT64_C( 0x873e4f75e2224e68 ), UINT64_C( 0x5a7744a6e804a291 ) },   // 5^-270
+    { UINT64_C( 0xa90de3535aaae202 ), UINT64_C( 0x711515d0a205cb36 ) },   // 5^-269
+    { UINT64_C( 0xd3515c2831559a83 ), UINT64_C( 0x0d5a5b44ca873e03 ) },   // 5^-268
+    { UINT64_C( 0x8412d9991ed58091 ), UINT64_C( 0xe858790afe9486c2 ) },   // 5^-267
+    { UINT64_C( 0xa5178fff668ae0b6 ), UINT64_C( 0x626e974dbe39a872 ) },   // 5^-266
+    { UINT64_C( 0xce5d73ff402d98e3 ), UINT64_C( 0xfb0a3d212dc8128f ) },   // 5^-265
+    { UINT64_C( 0x80fa687f881c7f8e ), UINT64_C( 0x7ce66634bc9d0b99 ) },   // 5^-264
+    { UINT64_C( 0xa139029f6a239f72 ), UINT64_C( 0x1c1fffc1ebc44e80 ) },   // 5^-263
+    { UINT64_C( 0xc987434744ac874e ), UINT64_C( 0xa327ffb266b56220 ) },   // 5^-262
+    { UINT64_C( 0xfbe9141915d7a922 ), UINT64_C( 0x4bf1ff9f0062baa8 ) },   // 5^-261
+    { UINT64_C( 0x9d71ac8fada6c9b5 ), UINT64_C( 0x6f773fc3603db4a9 ) },   // 5^-260
+    { UINT64_C( 0xc4ce17b399107c22 ), UINT64_C( 0xcb550fb4384d21d3 ) },   // 5^-259
+    { UINT64_C( 0xf6019da07f549b2b ), UINT64_C( 0x7e2a53a146606a48 ) },   // 5^-258
+    { UINT64_C( 0x99c102844f94e0fb ), UINT64_C( 0x2eda7444cbfc426d ) },   // 5^-257
+    { UINT64_C( 0xc0314325637a1939 ), UINT64_C( 0xfa911155fefb5308 ) },   // 5^-256
+    { UINT64_C( 0xf03d93eebc589f88 ), UINT64_C( 0x793555ab7eba27ca ) },   // 5^-255
+    { UINT64_C( 0x96267c7535b763b5 ), UINT64_C( 0x4bc1558b2f3458de ) },   // 5^-254
+    { UINT64_C( 0xbbb01b9283253ca2 ), UINT64_C( 0x9eb1aaedfb016f16 ) },   // 5^-253
+    { UINT64_C( 0xea9c227723ee8bcb ), UINT64_C( 0x465e15a979c1cadc ) },   // 5^-252
+    { UINT64_C( 0x92a1958a7675175f ), UINT64_C( 0x0bfacd89ec191ec9 ) },   // 5^-251
+    { UINT64_C( 0xb749faed14125d36 ), UINT64_C( 0xcef980ec671f667b ) },   // 5^-250
+    { UINT64_C( 0xe51c79a85916f484 ), UINT64_C( 0x82b7e12780e7401a ) },   // 5^-249
+    { UINT64_C( 0x8f31cc0937ae58d2 ), UINT64_C( 0xd1b2ecb8b0908810 ) },   // 5^-248
+    { UINT64_C( 0xb2fe3f0b8599ef07 ), UINT64_C( 0x861fa7e6dcb4aa15 ) },   // 5^-247
+    { UINT64_C( 0xdfbdcece67006ac9 ), UINT64_C( 0x67a791e093e1d49a ) },   // 5^-246
+    { UINT64_C( 0x8bd6a141006042bd ), UINT64_C( 0xe0c8bb2c5c6d24e0 ) },   // 5^-245
+    { UINT64_C( 0xaecc49914078536d ), UINT64_C( 0x58fae9f773886e18 ) },   // 5^-244
+    { UINT64_C( 0xda7f5bf590966848 ), UINT64_C( 0xaf39a475506a899e ) },   // 5^-243
+    { UINT64_C( 0x888f99797a5e012d ), UINT64_C( 0x6d8406c952429603 ) },   // 5^-242
+    { UINT64_C( 0xaab37fd7d8f58178 ), UINT64_C( 0xc8e5087ba6d33b83 ) },   // 5^-241
+    { UINT64_C( 0xd5605fcdcf32e1d6 ), UINT64_C( 0xfb1e4a9a90880a64 ) },   // 5^-240
+    { UINT64_C( 0x855c3be0a17fcd26 ), UINT64_C( 0x5cf2eea09a55067f ) },   // 5^-239
+    { UINT64_C( 0xa6b34ad8c9dfc06f ), UINT64_C( 0xf42faa48c0ea481e ) },   // 5^-238
+    { UINT64_C( 0xd0601d8efc57b08b ), UINT64_C( 0xf13b94daf124da26 ) },   // 5^-237
+    { UINT64_C( 0x823c12795db6ce57 ), UINT64_C( 0x76c53d08d6b70858 ) },   // 5^-236
+    { UINT64_C( 0xa2cb1717b52481ed ), UINT64_C( 0x54768c4b0c64ca6e ) },   // 5^-235
+    { UINT64_C( 0xcb7ddcdda26da268 ), UINT64_C( 0xa9942f5dcf7dfd09 ) },   // 5^-234
+    { UINT64_C( 0xfe5d54150b090b02 ), UINT64_C( 0xd3f93b35435d7c4c ) },   // 5^-233
+    { UINT64_C( 0x9efa548d26e5a6e1 ), UINT64_C( 0xc47bc5014a1a6daf ) },   // 5^-232
+    { UINT64_C( 0xc6b8e9b0709f109a ), UINT64_C( 0x359ab6419ca1091b ) },   // 5^-231
+    { UINT64_C( 0xf867241c8cc6d4c0 ), UINT64_C( 0xc30163d203c94b62 ) },   // 5^-230
+    { UINT64_C( 0x9b407691d7fc44f8 ), UINT64_C( 0x79e0de63425dcf1d ) },   // 5^-229
+    { UINT64_C( 0xc21094364dfb5636 ), UINT64_C( 0x985915fc12f542e4 ) },   // 5^-228
+    { UINT64_C( 0xf294b943e17a2bc4 ), UINT64_C( 0x3e6f5b7b17b2939d ) },   // 5^-227
+    { UINT64_C( 0x979cf3ca6cec5b5a ), UINT64_C( 0xa705992ceecf9c42 ) },   // 5^-226
+    { UINT64_C( 0xbd8430bd08277231 ), UINT64_C( 0x50c6ff782a838353 ) },   // 5^-225
+    { UINT64_C( 0xece53cec4a314ebd ), UINT64_C( 0xa4f8bf5635246428 ) },   // 5^-224
+    { UINT64_C( 0x940f4613ae5ed136 ), UINT64_C( 0x871b7795e136be99 ) },   // 5^-223
+    { UINT64_C( 0xb913179899f68584 ), UINT64_C( 0x28e2557b59846e3f ) },   // 5^-222
+    { UINT64_C( 0xe757dd7ec07426e5 ), UINT64_C( 0x331aeada2fe589cf ) },   // 5^-221
+    { UINT64_C( 0x9096ea6f3848984f ), UINT64_C( 0x3ff0d2c85def7621 ) },   // 5^-220
+    { UINT64_C( 0xb4bca50b065abe63 ), UINT64_C( 0x0fed077a756b53a9 ) },   // 5^-219
+    { UINT64_C( 0xe1ebce4dc7f16dfb ), UINT64_C( 0xd3e8495912c62894 ) },   // 5^-218
+    { UINT64_C( 0x8d3360f09cf6e4bd ), UINT64_C( 0x64712dd7abbbd95c ) },   // 5^-217
+    { UINT64_C( 0xb080392cc4349dec ), UINT64_C( 0xbd8d794d96aacfb3 ) },   // 5^-216
+    { UINT64_C( 0xdca04777f541c567 ), UINT64_C( 0xecf0d7a0fc5583a0 ) },   // 5^-215
+    { UINT64_C( 0x89e42caaf9491b60 ), UINT64_C( 0xf41686c49db57244 ) },   // 5^-214
+    { UINT64_C( 0xac5d37d5b79b6239 ), UINT64_C( 0x311c2875c522ced5 ) },   // 5^-213
+    { UINT64_C( 0xd77485cb25823ac7 ), UINT64_C( 0x7d633293366b828b ) },   // 5^-212
+    { UINT64_C( 0x86a8d39ef77164bc ), UINT64_C( 0xae5dff9c02033197 ) },   // 5^-211
+    { UINT64_C( 0xa8530886b54dbdeb ), UINT64_C( 0xd9f57f830283fdfc ) },   // 5^-210
+    { UINT64_C( 0xd267caa862a12d66 ), UINT64_C( 0xd072df63c324fd7b ) },   // 5^-209
+    { UINT64_C( 0x8380dea93da4bc60 ), UINT64_C( 0x4247cb9e59f71e6d ) },   // 5^-208
+    { UINT64_C( 0xa46116538d0deb78 ), UINT64_C( 0x52d9be85f074e608 ) },   // 5^-207
+    { UINT64_C( 0xcd795be870516656 ), UINT64_C( 0x67902e276c921f8b ) },   // 5^-206
+    { UINT64_C( 0x806bd9714632dff6 ), UINT64_C( 0x00ba1cd8a3db53b6 ) },   // 5^-205
+    { UINT64_C( 0xa086cfcd97bf97f3 ), UINT64_C( 0x80e8a40eccd228a4 ) },   // 5^-204
+    { UINT64_C( 0xc8a883c0fdaf7df0 ), UINT64_C( 0x6122cd128006b2cd ) },   // 5^-203
+    { UINT64_C( 0xfad2a4b13d1b5d6c ), UINT64_C( 0x796b805720085f81 ) },   // 5^-202
+    { UINT64_C( 0x9cc3a6eec6311a63 ), UINT64_C( 0xcbe3303674053bb0 ) },   // 5^-201
+    { UINT64_C( 0xc3f490aa77bd60fc ), UINT64_C( 0xbedbfc4411068a9c ) },   // 5^-200
+    { UINT64_C( 0xf4f1b4d515acb93b ), UINT64_C( 0xee92fb5515482d44 ) },   // 5^-199
+    { UINT64_C( 0x991711052d8bf3c5 ), UINT64_C( 0x751bdd152d4d1c4a ) },   // 5^-198
+    { UINT64_C( 0xbf5cd54678eef0b6 ), UINT64_C( 0xd262d45a78a0635d ) },   // 5^-197
+    { UINT64_C( 0xef340a98172aace4 ), UINT64_C( 0x86fb897116c87c34 ) },   // 5^-196
+    { UINT64_C( 0x9580869f0e7aac0e ), UINT64_C( 0xd45d35e6ae3d4da0 ) },   // 5^-195
+    { UINT64_C( 0xbae0a846d2195712 ), UINT64_C( 0x8974836059cca109 ) },   // 5^-194
+    { UINT64_C( 0xe998d258869facd7 ), UINT64_C( 0x2bd1a438703fc94b ) },   // 5^-193
+    { UINT64_C( 0x91ff83775423cc06 ), UINT64_C( 0x7b6306a34627ddcf ) },   // 5^-192
+    { UINT64_C( 0xb67f6455292cbf08 ), UINT64_C( 0x1a3bc84c17b1d542 ) },   // 5^-191
+    { UINT64_C( 0xe41f3d6a7377eeca ), UINT64_C( 0x20caba5f1d9e4a93 ) },   // 5^-190
+    { UINT64_C( 0x8e938662882af53e ), UINT64_C( 0x547eb47b7282ee9c ) },   // 5^-189
+    { UINT64_C( 0xb23867fb2a35b28d ), UINT64_C( 0xe99e619a4f23aa43 ) },   // 5^-188
+    { UINT64_C( 0xdec681f9f4c31f31 ), UINT64_C( 0x6405fa00e2ec94d4 ) },   // 5^-187
+    { UINT64_C( 0x8b3c113c38f9f37e ), UINT64_C( 0xde83bc408dd3dd04 ) },   // 5^-186
+    { UINT64_C( 0xae0b158b4738705e ), UINT64_C( 0x9624ab50b148d445 ) },   // 5^-185
+    { UINT64_C( 0xd98ddaee19068c76 ), UINT64_C( 0x3badd624dd9b0957 ) },   // 5^-184
+    { UINT64_C( 0x87f8a8d4cfa417c9 ), UINT64_C( 0xe54ca5d70a80e5d6 ) },   // 5^-183
+    { UINT64_C( 0xa9f6d30a038d1dbc ), UINT64_C( 0x5e9fcf4ccd211f4c ) },   // 5^-182
+    { UINT64_C( 0xd47487cc8470652b ), UINT64_C( 0x7647c3200069671f ) },   // 5^-181
+    { UINT64_C( 0x84c8d4dfd2c63f3b ), UINT64_C( 0x29ecd9f40041e073 ) },   // 5^-180
+    { UINT64_C( 0xa5fb0a17c777cf09 ), UINT64_C( 0xf468107100525890 ) },   // 5^-179
+    { UINT64_C( 0xcf79cc9db955c2cc ), UINT64_C( 0x7182148d4066eeb4 ) },   // 5^-178
+    { UINT64_C( 0x81ac1fe293d599bf ), UINT64_C( 0xc6f14cd848405530 ) },   // 5^-177
+    { UINT64_C( 0xa21727db38cb002f ), UINT64_C( 0xb8ada00e5a506a7c ) },   // 5^-176
+    { UINT64_C( 0xca9cf1d206fdc03b ), UINT64_C( 0xa6d90811f0e4851c ) },   // 5^-175
+    { UINT64_C( 0xfd442e4688bd304a ), UINT64_C( 0x908f4a166d1da663 ) },   // 5^-174
+    { UINT64_C( 0x9e4a9cec15763e2e ), UINT64_C( 0x9a598e4e043287fe ) },   // 5^-173
+    { UINT64_C( 0xc5dd44271ad3cdba ), UINT64_C( 0x40eff1e1853f29fd ) },   // 5^-172
+    { UINT64_C( 0xf7549530e188c128 ), UINT64_C( 0xd12bee59e68ef47c ) },   // 5^-171
+    { UINT64_C( 0x9a94dd3e8cf578b9 ), UINT64_C( 0x82bb74f8301958ce ) },   // 5^-170
+    { UINT64_C( 0xc13a148e3032d6e7 ), UINT64_C( 0xe36a52363c1faf01 ) },   // 5^-169
+    { UINT64_C( 0xf18899b1bc3f8ca1 ), UINT64_C( 0xdc44e6c3cb279ac1 ) },   // 5^-168
+    { UINT64_C( 0x96f5600f15a7b7e5 ), UINT64_C( 0x29ab103a5ef8c0b9 ) },   // 5^-167
+    { UINT64_C( 0xbcb2b812db11a5de ), UINT64_C( 0x7415d448f6b6f0e7 ) },   // 5^-166
+    { UINT64_C( 0xebdf661791d60f56 ), UINT64_C( 0x111b495b3464ad21 ) },   // 5^-165
+    { UINT64_C( 0x936b9fcebb25c995 ), UINT64_C( 0xcab10dd900beec34 ) },   // 5^-164
+    { UINT64_C( 0xb84687c269ef3bfb ), UINT64_C( 0x3d5d514f40eea742 ) },   // 5^-163
+    { UINT64_C( 0xe65829b3046b0afa ), UINT64_C( 0x0cb4a5a3112a5112 ) },   // 5^-162
+    { UINT64_C( 0x8ff71a0fe2c2e6dc ), UINT64_C( 0x47f0e785eaba72ab ) },   // 5^-161
+    { UINT64_C( 0xb3f4e093db73a093 ), UINT64_C( 0x59ed216765690f56 ) },   // 5^-160
+    { UINT64_C( 0xe0f218b8d25088b8 ), UINT64_C( 0x306869c13ec3532c ) },   // 5^-159
+    { UINT64_C( 0x8c974f7383725573 ), UINT64_C( 0x1e414218c73a13fb ) },   // 5^-158
+    { UINT64_C( 0xafbd2350644eeacf ), UINT64_C( 0xe5d1929ef90898fa ) },   // 5^-157
+    { UINT64_C( 0xdbac6c247d62a583 ), UINT64_C( 0xdf45f746b74abf39 ) },   // 5^-156
+    { UINT64_C( 0x894bc396ce5da772 ), UINT64_C( 0x6b8bba8c328eb783 ) },   // 5^-155
+    { UINT64_C( 0xab9eb47c81f5114f ), UINT64_C( 0x066ea92f3f326564 ) },   // 5^-154
+    { UINT64_C( 0xd686619ba27255a2 ), UINT64_C( 0xc80a537b0efefebd ) },   // 5^-153
+    { UINT64_C( 0x8613fd0145877585 ), UINT64_C( 0xbd06742ce95f5f36 ) },   // 5^-152
+    { UINT64_C( 0xa798fc4196e952e7 ), UINT64_C( 0x2c48113823b73704 ) },   // 5^-151
+    { UINT64_C( 0xd17f3b51fca3a7a0 ), UINT64_C( 0xf75a15862ca504c5 ) },   // 5^-150
+    { UINT64_C( 0x82ef85133de648c4 ), UINT64_C( 0x9a984d73dbe722fb ) },   // 5^-149
+    { UINT64_C( 0xa3ab66580d5fdaf5 ), UINT64_C( 0xc13e60d0d2e0ebba ) },   // 5^-148
+    { UINT64_C( 0xcc963fee10b7d1b3 ), UINT64_C( 0x318df905079926a8 ) },   // 5^-147
+    { UINT64_C( 0xffbbcfe994e5c61f ), UINT64_C( 0xfdf17746497f7052 ) },   // 5^-146
+    { UINT64_C( 0x9fd561f1fd0f9bd3 ), UINT64_C( 0xfeb6ea8bedefa633 ) },   // 5^-145
+    { UINT64_C( 0xc7caba6e7c5382c8 ), UINT64_C( 0xfe64a52ee96b8fc0 ) },   // 5^-144
+    { UINT64_C( 0xf9bd690a1b68637b ), UINT64_C( 0x3dfdce7aa3c673b0 ) },   // 5^-143
+    { UINT64_C( 0x9c1661a651213e2d ), UINT64_C( 0x06bea10ca65c084e ) },   // 5^-142
+    { UINT64_C( 0xc31bfa0fe5698db8 ), UINT64_C( 0x486e494fcff30a62 ) },   // 5^-141
+    { UINT64_C( 0xf3e2f893dec3f126 ), UINT64_C( 0x5a89dba3c3efccfa ) },   // 5^-140
+    { UINT64_C( 0x986ddb5c6b3a76b7 ), UINT64_C( 0xf89629465a75e01c ) },   // 5^-139
+    { UINT64_C( 0xbe89523386091465 ), UINT64_C( 0xf6bbb397f1135823 ) },   // 5^-138
+    { UINT64_C( 0xee2ba6c0678b597f ), UINT64_C( 0x746aa07ded582e2c ) },   // 5^-137
+    { UINT64_C( 0x94db483840b717ef ), UINT64_C( 0xa8c2a44eb4571cdc ) },   // 5^-136
+    { UINT64_C( 0xba121a4650e4ddeb ), UINT64_C( 0x92f34d62616ce413 ) },   // 5^-135
+    { UINT64_C( 0xe896a0d7e51e1566 ), UINT64_C( 0x77b020baf9c81d17 ) },   // 5^-134
+    { UINT64_C( 0x915e2486ef32cd60 ), UINT64_C( 0x0ace1474dc1d122e ) },   // 5^-133
+    { UINT64_C( 0xb5b5ada8aaff80b8 ), UINT64_C( 0x0d819992132456ba ) },   // 5^-132
+    { UINT64_C( 0xe3231912d5bf60e6 ), UINT64_C( 0x10e1fff697ed6c69 ) },   // 5^-131
+    { UINT64_C( 0x8df5efabc5979c8f ), UINT64_C( 0xca8d3ffa1ef463c1 ) },   // 5^-130
+    { UINT64_C( 0xb1736b96b6fd83b3 ), UINT64_C( 0xbd308ff8a6b17cb2 ) },   // 5^-129
+    { UINT64_C( 0xddd0467c64bce4a0 ), UINT64_C( 0xac7cb3f6d05ddbde ) },   // 5^-128
+    { UINT64_C( 0x8aa22c0dbef60ee4 ), UINT64_C( 0x6bcdf07a423aa96b ) },   // 5^-127
+    { UINT64_C( 0xad4ab7112eb3929d ), UINT64_C( 0x86c16c98d2c953c6 ) },   // 5^-126
+    { UINT64_C( 0xd89d64d57a607744 ), UINT64_C( 0xe871c7bf077ba8b7 ) },   // 5^-125
+    { UINT64_C( 0x87625f056c7c4a8b ), UINT64_C( 0x11471cd764ad4972 ) },   // 5^-124
+    { UINT64_C( 0xa93af6c6c79b5d2d ), UINT64_C( 0xd598e40d3dd89bcf ) },   // 5^-123
+    { UINT64_C( 0xd389b47879823479 ), UINT64_C( 0x4aff1d108d4ec2c3 ) },   // 5^-122
+    { UINT64_C( 0x843610cb4bf160cb ), UINT64_C( 0xcedf722a585139ba ) },   // 5^-121
+    { UINT64_C( 0xa54394fe1eedb8fe ), UINT64_C( 0xc2974eb4ee658828 ) },   // 5^-120
+    { UINT64_C( 0xce947a3da6a9273e ), UINT64_C( 0x733d226229feea32 ) },   // 5^-119
+    { UINT64_C( 0x811ccc668829b887 ), UINT64_C( 0x0806357d5a3f525f ) },   // 5^-118
+    { UINT64_C( 0xa163ff802a3426a8 ), UINT64_C( 0xca07c2dcb0cf26f7 ) },   // 5^-117
+    { UINT64_C( 0xc9bcff6034c13052 ), UINT64_C( 0xfc89b393dd02f0b5 ) },   // 5^-116
+    { UINT64_C( 0xfc2c3f3841f17c67 ), UINT64_C( 0xbbac2078d443ace2 ) },   // 5^-115
+    { UINT64_C( 0x9d9ba7832936edc0 ), UINT64_C( 0xd54b944b84aa4c0d ) },   // 5^-114
+    { UINT64_C( 0xc5029163f384a931 ), UINT64_C( 0x0a9e795e65d4df11 ) },   // 5^-113
+    { UINT64_C( 0xf64335bcf065d37d ), UINT64_C( 0x4d4617b5ff4a16d5 ) },   // 5^-112
+    { UINT64_C( 0x99ea0196163fa42e ), UINT64_C( 0x504bced1bf8e4e45 ) },   // 5^-111
+    { UINT64_C( 0xc06481fb9bcf8d39 ), UINT64_C( 0xe45ec2862f71e1d6 ) },   // 5^-110
+    { UINT64_C( 0xf07da27a82c37088 ), UINT64_C( 0x5d767327bb4e5a4c ) },   // 5^-109
+    { UINT64_C( 0x964e858c91ba2655 ), UINT64_C( 0x3a6a07f8d510f86f ) },   // 5^-108
+    { UINT64_C( 0xbbe226efb628afea ), UINT64_C( 0x890489f70a55368b ) },   // 5^-107
+    { UINT64_C( 0xeadab0aba3b2dbe5 ), UINT64_C( 0x2b45ac74ccea842e ) },   // 5^-106
+    { UINT64_C( 0x92c8ae6b464fc96f ), UINT64_C( 0x3b0b8bc90012929d ) },   // 5^-105
+    { UINT64_C( 0xb77ada0617e3bbcb ), UINT64_C( 0x09ce6ebb40173744 ) },   // 5^-104
+    { UINT64_C( 0xe55990879ddcaabd ), UINT64_C( 0xcc420a6a101d0515 ) },   // 5^-103
+    { UINT64_C( 0x8f57fa54c2a9eab6 ), UINT64_C( 0x9fa946824a12232d ) },   // 5^-102
+    { UINT64_C( 0xb32df8e9f3546564 ), UINT64_C( 0x47939822dc96abf9 ) },   // 5^-101
+    { UINT64_C( 0xdff9772470297ebd ), UINT64_C( 0x59787e2b93bc56f7 ) },   // 5^-100
+    { UINT64_C( 0x8bfbea76c619ef36 ), UINT64_C( 0x57eb4edb3c55b65a ) },   // 5^-99
+    { UINT64_C( 0xaefae51477a06b03 ), UINT64_C( 0xede622920b6b23f1 ) },   // 5^-98
+    { UINT64_C( 0xdab99e59958885c4 ), UINT64_C( 0xe95fab368e45eced ) },   // 5^-97
+    { UINT64_C( 0x88b402f7fd75539b ), UINT64_C( 0x11dbcb0218ebb414 ) },   // 5^-96
+    { UINT64_C( 0xaae103b5fcd2a881 ), UINT64_C( 0xd652bdc29f26a119 ) },   // 5^-95
+    { UINT64_C( 0xd59944a37c0752a2 ), UINT64_C( 0x4be76d3346f0495f ) },   // 5^-94
+    { UINT64_C( 0x857fcae62d8493a5 ), UINT64_C( 0x6f70a4400c562ddb ) },   // 5^-93
+    { UINT64_C( 0xa6dfbd9fb8e5b88e ), UINT64_C( 0xcb4ccd500f6bb952 ) },   // 5^-92
+    { UINT64_C( 0xd097ad07a71f26b2 ), UINT64_C( 0x7e2000a41346a7a7 ) },   // 5^-91
+    { UINT64_C( 0x825ecc24c873782f ), UINT64_C( 0x8ed400668c0c28c8 ) },   // 5^-90
+    { UINT64_C( 0xa2f67f2dfa90563b ), UINT64_C( 0x728900802f0f32fa ) },   // 5^-89
+    { UINT64_C( 0xcbb41ef979346bca ), UINT64_C( 0x4f2b40a03ad2ffb9 ) },   // 5^-88
+    { UINT64_C( 0xfea126b7d78186bc ), UINT64_C( 0xe2f610c84987bfa8 ) },   // 5^-87
+    { UINT64_C( 0x9f24b832e6b0f436 ), UINT64_C( 0x0dd9ca7d2df4d7c9 ) },   // 5^-86
+    { UINT64_C( 0xc6ede63fa05d3143 ), UINT64_C( 0x91503d1c79720dbb ) },   // 5^-85
+    { UINT64_C( 0xf8a95fcf88747d94 ), UINT64_C( 0x75a44c6397ce912a ) },   // 5^-84
+    { UINT64_C( 0x9b69dbe1b548ce7c ), UINT64_C( 0xc986afbe3ee11aba ) },   // 5^-83
+    { UINT64_C( 0xc24452da229b021b ), UINT64_C( 0xfbe85badce996168 ) },   // 5^-82
+    { UINT64_C( 0xf2d56790ab41c2a2 ), UINT64_C( 0xfae27299423fb9c3 ) },   // 5^-81
+    { UINT64_C( 0x97c560ba6b0919a5 ), UINT64_C( 0xdccd879fc967d41a ) },   // 5^-80
+    { UINT64_C( 0xbdb6b8e905cb600f ), UINT64_C( 0x5400e987bbc1c920 ) },   // 5^-79
+    { UINT64_C( 0xed246723473e3813 ), UINT64_C( 0x290123e9aab23b68 ) },   // 5^-78
+    { UINT64_C( 0x9436c0760c86e30b ), UINT64_C( 0xf9a0b6720aaf6521 ) },   // 5^-77
+    { UINT64_C( 0xb94470938fa89bce ), UINT64_C( 0xf808e40e8d5b3e69 ) },   // 5^-76
+    { UINT64_C( 0xe7958cb87392c2c2 ), UINT64_C( 0xb60b1d1230b20e04 ) },   // 5^-75
+    { UINT64_C( 0x90bd77f3483bb9b9 ), UINT64_C( 0xb1c6f22b5e6f48c2 ) },   // 5^-74
+    { UINT64_C( 0xb4ecd5f01a4aa828 ), UINT64_C( 0x1e38aeb6360b1af3 ) },   // 5^-73
+    { UINT64_C( 0xe2280b6c20dd5232 ), UINT64_C( 0x25c6da63c38de1b0 ) },   // 5^-72
+    { UINT64_C( 0x8d590723948a535f ), UINT64_C( 0x579c487e5a38ad0e ) },   // 5^-71
+    { UINT64_C( 0xb0af48ec79ace837 ), UINT64_C( 0x2d835a9df0c6d851 ) },   // 5^-70
+    { UINT64_C( 0xdcdb1b2798182244 ), UINT64_C( 0xf8e431456cf88e65 ) },   // 5^-69
+    { UINT64_C( 0x8a08f0f8bf0f156b ), UINT64_C( 0x1b8e9ecb641b58ff ) },   // 5^-68
+    { UINT64_C( 0xac8b2d36eed2dac5 ), UINT64_C( 0xe272467e3d222f3f ) },   // 5^-67
+    { UINT64_C( 0xd7adf884aa879177 ), UINT64_C( 0x5b0ed81dcc6abb0f ) },   // 5^-66
+    { UINT64_C( 0x86ccbb52ea94baea ), UINT64_C( 0x98e947129fc2b4e9 ) },   // 5^-65
+    { UINT64_C( 0xa87fea27a539e9a5 ), UINT64_C( 0x3f2398d747b36224 ) },   // 5^-64
+    { UINT64_C( 0xd29fe4b18e88640e ), UINT64_C( 0x8eec7f0d19a03aad ) },   // 5^-63
+    { UINT64_C( 0x83a3eeeef9153e89 ), UINT64_C( 0x1953cf68300424ac ) },   // 5^-62
+    { UINT64_C( 0xa48ceaaab75a8e2b ), UINT64_C( 0x5fa8c3423c052dd7 ) },   // 5^-61
+    { UINT64_C( 0xcdb02555653131b6 ), UINT64_C( 0x3792f412cb06794d ) },   // 5^-60
+    { UINT64_C( 0x808e17555f3ebf11 ), UINT64_C( 0xe2bbd88bbee40bd0 ) },   // 5^-59
+    { UINT64_C( 0xa0b19d2ab70e6ed6 ), UINT64_C( 0x5b6aceaeae9d0ec4 ) },   // 5^-58
+    { UINT64_C( 0xc8de047564d20a8b ), UINT64_C( 0xf245825a5a445275 ) },   // 5^-57
+    { UINT64_C( 0xfb158592be068d2e ), UINT64_C( 0xeed6e2f0f0d56712 ) },   // 5^-56
+    { UINT64_C( 0x9ced737bb6c4183d ), UINT64_C( 0x55464dd69685606b ) },   // 5^-55
+    { UINT64_C( 0xc428d05aa4751e4c ), UINT64_C( 0xaa97e14c3c26b886 ) },   // 5^-54
+    { UINT64_C( 0xf53304714d9265df ), UINT64_C( 0xd53dd99f4b3066a8 ) },   // 5^-53
+    { UINT64_C( 0x993fe2c6d07b7fab ), UINT64_C( 0xe546a8038efe4029 ) },   // 5^-52
+    { UINT64_C( 0xbf8fdb78849a5f96 ), UINT64_C( 0xde98520472bdd033 ) },   // 5^-51
+    { UINT64_C( 0xef73d256a5c0f77c ), UINT64_C( 0x963e66858f6d4440 ) },   // 5^-50
+    { UINT64_C( 0x95a8637627989aad ), UINT64_C( 0xdde7001379a44aa8 ) },   // 5^-49
+    { UINT64_C( 0xbb127c53b17ec159 ), UINT64_C( 0x5560c018580d5d52 ) },   // 5^-48
+    { UINT64_C( 0xe9d71b689dde71af ), UINT64_C( 0xaab8f01e6e10b4a6 ) },   // 5^-47
+    { UINT64_C( 0x9226712162ab070d ), UINT64_C( 0xcab3961304ca70e8 ) },   // 5^-46
+    { UINT64_C( 0xb6b00d69bb55c8d1 ), UINT64_C( 0x3d607b97c5fd0d22 ) },   // 5^-45
+    { UINT64_C( 0xe45c10c42a2b3b05 ), UINT64_C( 0x8cb89a7db77c506a ) },   // 5^-44
+    { UINT64_C( 0x8eb98a7a9a5b04e3 ), UINT64_C( 0x77f3608e92adb242 ) },   // 5^-43
+    { UINT64_C( 0xb267ed1940f1c61c ), UINT64_C( 0x55f038b237591ed3 ) },   // 5^-42
+    { UINT64_C( 0xdf01e85f912e37a3 ), UINT64_C( 0x6b6c46dec52f6688 ) },   // 5^-41
+    { UINT64_C( 0x8b61313bbabce2c6 ), UINT64_C( 0x2323ac4b3b3da015 ) },   // 5^-40
+    { UINT64_C( 0xae397d8aa96c1b77 ), UINT64_C( 0xabec975e0a0d081a ) },   // 5^-39
+    { UINT64_C( 0xd9c7dced53c72255 ), UINT64_C( 0x96e7bd358c904a21 ) },   // 5^-38
+    { UINT64_C( 0x881cea14545c7575 ), UINT64_C( 0x7e50d64177da2e54 ) },   // 5^-37
+    { UINT64_C( 0xaa242499697392d2 ), UINT64_C( 0xdde50bd1d5d0b9e9 ) },   // 5^-36
+    { UINT64_C( 0xd4ad2dbfc3d07787 ), UINT64_C( 0x955e4ec64b44e864 ) },   // 5^-35
+    { UINT64_C( 0x84ec3c97da624ab4 ), UINT64_C( 0xbd5af13bef0b113e ) },   // 5^-34
+    { UINT64_C( 0xa6274bbdd0fadd61 ), UINT64_C( 0xecb1ad8aeacdd58e ) },   // 5^-33
+    { UINT64_C( 0xcfb11ead453994ba ), UINT64_C( 0x67de18eda5814af2 ) },   // 5^-32
+    { UINT64_C( 0x81ceb32c4b43fcf4 ), UINT64_C( 0x80eacf948770ced7 ) },   // 5^-31
+    { UINT64_C( 0xa2425ff75e14fc31 ), UINT64_C( 0xa1258379a94d028d ) },   // 5^-30
+    { UINT64_C( 0xcad2f7f5359a3b3e ), UINT64_C( 0x096ee45813a04330 ) },   // 5^-29
+    { UINT64_C( 0xfd87b5f28300ca0d ), UINT64_C( 0x8bca9d6e188853fc ) },   // 5^-28
+    { UINT64_C( 0x9e74d1b791e07e48 ), UINT64_C( 0x775ea264cf55347e ) },   // 5^-27
+    { UINT64_C( 0xc612062576589dda ), UINT64_C( 0x95364afe032a819e ) },   // 5^-26
+    { UINT64_C( 0xf79687aed3eec551 ), UINT64_C( 0x3a83ddbd83f52205 ) },   // 5^-25
+    { UINT64_C( 0x9abe14cd44753b52 ), UINT64_C( 0xc4926a9672793543 ) },   // 5^-24
+    { UINT64_C( 0xc16d9a0095928a27 ), UINT64_C( 0x75b7053c0f178294 ) },   // 5^-23
+    { UINT64_C( 0xf1c90080baf72cb1 ), UINT64_C( 0x5324c68b12dd6339 ) },   // 5^-22
+    { UINT64_C( 0x971da05074da7bee ), UINT64_C( 0xd3f6fc16ebca5e04 ) },   // 5^-21
+    { UINT64_C( 0xbce5086492111aea ), UINT64_C( 0x88f4bb1ca6bcf585 ) },   // 5^-20
+    { UINT64_C( 0xec1e4a7db69561a5 ), UINT64_C( 0x2b31e9e3d06c32e6 ) },   // 5^-19
+    { UINT64_C( 0x9392ee8e921d5d07 ), UINT64_C( 0x3aff322e62439fd0 ) },   // 5^-18
+    { UINT64_C( 0xb877aa3236a4b449 ), UINT64_C( 0x09befeb9fad487c3 ) },   // 5^-17
+    { UINT64_C( 0xe69594bec44de15b ), UINT64_C( 0x4c2ebe687989a9b4 ) },   // 5^-16
+    { UINT64_C( 0x901d7cf73ab0acd9 ), UINT64_C( 0x0f9d37014bf60a11 ) },   // 5^-15
+    { UINT64_C( 0xb424dc35095cd80f ), UINT64_C( 0x538484c19ef38c95 ) },   // 5^-14
+    { UINT64_C( 0xe12e13424bb40e13 ), UINT64_C( 0x2865a5f206b06fba ) },   // 5^-13
+    { UINT64_C( 0x8cbccc096f5088cb ), UINT64_C( 0xf93f87b7442e45d4 ) },   // 5^-12
+    { UINT64_C( 0xafebff0bcb24aafe ), UINT64_C( 0xf78f69a51539d749 ) },   // 5^-11
+    { UINT64_C( 0xdbe6fecebdedd5be ), UINT64_C( 0xb573440e5a884d1c ) },   // 5^-10
+    { UINT64_C( 0x89705f4136b4a597 ), UINT64_C( 0x31680a88f8953031 ) },   // 5^-9
+    { UINT64_C( 0xabcc77118461cefc ), UINT64_C( 0xfdc20d2b36ba7c3e ) },   // 5^-8
+    { UINT64_C( 0xd6bf94d5e57a42bc ), UINT64_C( 0x3d32907604691b4d ) },   // 5^-7
+    { UINT64_C( 0x8637bd05af6c69b5 ), UINT64_C( 0xa63f9a49c2c1b110 ) },   // 5^-6
+    { UINT64_C( 0xa7c5ac471b478423 ), UINT64_C( 0x0fcf80dc33721d54 ) },   // 5^-5
+    { UINT64_C( 0xd1b71758e219652b ), UINT64_C( 0xd3c36113404ea4a9 ) },   // 5^-4
+    { UINT64_C( 0x83126e978d4fdf3b ), UINT64_C( 0x645a1cac083126ea ) },   // 5^-3
+    { UINT64_C( 0xa3d70a3d70a3d70a ), UINT64_C( 0x3d70a3d70a3d70a4 ) },   // 5^-2
+    { UINT64_C( 0xcccccccccccccccc ), UINT64_C( 0xcccccccccccccccd ) },   // 5^-1
+    { UINT64_C( 0x8000000000000000 ), UINT64_C( 0x0000000000000000 ) },   // 5^0
+    { UINT64_C( 0xa000000000000000 ), UINT64_C( 0x0000000000000000 ) },   // 5^1
+    { UINT64_C( 0xc800000000000000 ), UINT64_C( 0x0000000000000000 ) },   // 5^2
+    { UINT64_C( 0xfa00000000000000 ), UINT64_C( 0x0000000000000000 ) },   // 5^3
+    { UINT64_C( 0x9c40000000000000 ), UINT64_C( 0x0000000000000000 ) },   // 5^4
+    { UINT64_C( 0xc350000000000000 ), UINT64_C( 0x0000000000000000 ) },   // 5^5
+    { UINT64_C( 0xf424000000000000 ), UINT64_C( 0x0000000000000000 ) },   // 5^6
+    { UINT64_C( 0x9896800000000000 ), UINT64_C( 0x0000000000000000 ) },   // 5^7
+    { UINT64_C( 0xbebc200000000000 ), UINT64_C( 0x0000000000000000 ) },   // 5^8
+    { UINT64_C( 0xee6b280000000000 ), UINT64_C( 0x0000000000000000 ) },   // 5^9
+    { UINT64_C( 0x9502f90000000000 ), UINT64_C( 0x0000000000000000 ) },   // 5^10
+    { UINT64_C( 0xba43b74000000000 ), UINT64_C( 0x0000000000000000 ) },   // 5^11
+    { UINT64_C( 0xe8d4a51000000000 ), UINT64_C( 0x0000000000000000 ) },   // 5^12
+    { UINT64_C( 0x9184e72a00000000 ), UINT64_C( 0x0000000000000000 ) },   // 5^13
+    { UINT64_C( 0xb5e620f480000000 ), UINT64_C( 0x0000000000000000 ) },   // 5^14
+    { UINT64_C( 0xe35fa931a0000000 ), UINT64_C( 0x0000000000000000 ) },   // 5^15
+    { UINT64_C( 0x8e1bc9bf04000000 ), UINT64_C( 0x0000000000000000 ) },   // 5^16
+    { UINT64_C( 0xb1a2bc2ec5000000 ), UINT64_C( 0x0000000000000000 ) },   // 5^17
+    { UINT64_C( 0xde0b6b3a76400000 ), UINT64_C( 0x0000000000000000 ) },   // 5^18
+    { UINT64_C( 0x8ac7230489e80000 ), UINT64_C( 0x0000000000000000 ) },   // 5^19
+    { UINT64_C( 0xad78ebc5ac620000 ), UINT64_C( 0x0000000000000000 ) },   // 5^20
+    { UINT64_C( 0xd8d726b7177a8000 ), UINT64_C( 0x0000000000000000 ) },   // 5^21
+    { UINT64_C( 0x878678326eac9000 ), UINT64_C( 0x0000000000000000 ) },   // 5^22
+    { UINT64_C( 0xa968163f0a57b400 ), UINT64_C( 0x0000000000000000 ) },   // 5^23
+    { UINT64_C( 0xd3c21bcecceda100 ), UINT64_C( 0x0000000000000000 ) },   // 5^24
+    { UINT64_C( 0x84595161401484a0 ), UINT64_C( 0x0000000000000000 ) },   // 5^25
+    { UINT64_C( 0xa56fa5b99019a5c8 ), UINT64_C( 0x0000000000000000 ) },   // 5^26
+    { UINT64_C( 0xcecb8f27f4200f3a ), UINT64_C( 0x0000000000000000 ) },   // 5^27
+    { UINT64_C( 0x813f3978f8940984 ), UINT64_C( 0x4000000000000000 ) },   // 5^28
+    { UINT64_C( 0xa18f07d736b90be5 ), UINT64_C( 0x5000000000000000 ) },   // 5^29
+    { UINT64_C( 0xc9f2c9cd04674ede ), UINT64_C( 0xa400000000000000 ) },   // 5^30
+    { UINT64_C( 0xfc6f7c4045812296 ), UINT64_C( 0x4d00000000000000 ) },   // 5^31
+    { UINT64_C( 0x9dc5ada82b70b59d ), UINT64_C( 0xf020000000000000 ) },   // 5^32
+    { UINT64_C( 0xc5371912364ce305 ), UINT64_C( 0x6c28000000000000 ) },   // 5^33
+    { UINT64_C( 0xf684df56c3e01bc6 ), UINT64_C( 0xc732000000000000 ) },   // 5^34
+    { UINT64_C( 0x9a130b963a6c115c ), UINT64_C( 0x3c7f400000000000 ) },   // 5^35
+    { UINT64_C( 0xc097ce7bc90715b3 ), UINT64_C( 0x4b9f100000000000 ) },   // 5^36
+    { UINT64_C( 0xf0bdc21abb48db20 ), UINT64_C( 0x1e86d40000000000 ) },   // 5^37
+    { UINT64_C( 0x96769950b50d88f4 ), UINT64_C( 0x1314448000000000 ) },   // 5^38
+    { UINT64_C( 0xbc143fa4e250eb31 ), UINT64_C( 0x17d955a000000000 ) },   // 5^39
+    { UINT64_C( 0xeb194f8e1ae525fd ), UINT64_C( 0x5dcfab0800000000 ) },   // 5^40
+    { UINT64_C( 0x92efd1b8d0cf37be ), UINT64_C( 0x5aa1cae500000000 ) },   // 5^41
+    { UINT64_C( 0xb7abc627050305ad ), UINT64_C( 0xf14a3d9e40000000 ) },   // 5^42
+    { UINT64_C( 0xe596b7b0c643c719 ), UINT64_C( 0x6d9ccd05d0000000 ) },   // 5^43
+    { UINT64_C( 0x8f7e32ce7bea5c6f ), UINT64_C( 0xe4820023a2000000 ) },   // 5^44
+    { UINT64_C( 0xb35dbf821ae4f38b ), UINT64_C( 0xdda2802c8a800000 ) },   // 5^45
+    { UINT64_C( 0xe0352f62a19e306e ), UINT64_C( 0xd50b2037ad200000 ) },   // 5^46
+    { UINT64_C( 0x8c213d9da502de45 ), UINT64_C( 0x4526f422cc340000 ) },   // 5^47
+    { UINT64_C( 0xaf298d050e4395d6 ), UINT64_C( 0x9670b12b7f410000 ) },   // 5^48
+    { UINT64_C( 0xdaf3f04651d47b4c ), UINT64_C( 0x3c0cdd765f114000 ) },   // 5^49
+    { UINT64_C( 0x88d8762bf324cd0f ), UINT64_C( 0xa5880a69fb6ac800 ) },   // 5^50
+    { UINT64_C( 0xab0e93b6efee0053 ), UINT64_C( 0x8eea0d047a457a00 ) },   // 5^51
+    { UINT64_C( 0xd5d238a4abe98068 ), UINT64_C( 0x72a4904598d6d880 ) },   // 5^52
+    { UINT64_C( 0x85a36366eb71f041 ), UINT64_C( 0x47a6da2b7f864750 ) },   // 5^53
+    { UINT64_C( 0xa70c3c40a64e6c51 ), UINT64_C( 0x999090b65f67d924 ) },   // 5^54
+    { UINT64_C( 0xd0cf4b50cfe20765 ), UINT64_C( 0xfff4b4e3f741cf6d ) },   // 5^55
+    { UINT64_C( 0x82818f1281ed449f ), UINT64_C( 0xbff8f10e7a8921a4 ) },   // 5^56
+    { UINT64_C( 0xa321f2d7226895c7 ), UINT64_C( 0xaff72d52192b6a0d ) },   // 5^57
+    { UINT64_C( 0xcbea6f8ceb02bb39 ), UINT64_C( 0x9bf4f8a69f764490 ) },   // 5^58
+    { UINT64_C( 0xfee50b7025c36a08 ), UINT64_C( 0x02f236d04753d5b4 ) },   // 5^59
+    { UINT64_C( 0x9f4f2726179a2245 ), UINT64_C( 0x01d762422c946590 ) },   // 5^60
+    { UINT64_C( 0xc722f0ef9d80aad6 ), UINT64_C( 0x424d3ad2b7b97ef5 ) },   // 5^61
+    { UINT64_C( 0xf8ebad2b84e0d58b ), UINT64_C( 0xd2e0898765a7deb2 ) },   // 5^62
+    { UINT64_C( 0x9b934c3b330c8577 ), UINT64_C( 0x63cc55f49f88eb2f ) },   // 5^63
+    { UINT64_C( 0xc2781f49ffcfa6d5 ), UINT64_C( 0x3cbf6b71c76b25fb ) },   // 5^64
+    { UINT64_C( 0xf316271c7fc3908a ), UINT64_C( 0x8bef464e3945ef7a ) },   // 5^65
+    { UINT64_C( 0x97edd871cfda3a56 ), UINT64_C( 0x97758bf0e3cbb5ac ) },   // 5^66
+    { UINT64_C( 0xbde94e8e43d0c8ec ), UINT64_C( 0x3d52eeed1cbea317 ) },   // 5^67
+    { UINT64_C( 0xed63a231d4c4fb27 ), UINT64_C( 0x4ca7aaa863ee4bdd ) },   // 5^68
+    { UINT64_C( 0x945e455f24fb1cf8 ), UINT64_C( 0x8fe8caa93e74ef6a ) },   // 5^69
+    { UINT64_C( 0xb975d6b6ee39e436 ), UINT64_C( 0xb3e2fd538e122b44 ) },   // 5^70
+    { UINT64_C( 0xe7d34c64a9c85d44 ), UINT64_C( 0x60dbbca87196b616 ) },   // 5^71
+    { UINT64_C( 0x90e40fbeea1d3a4a ), UINT64_C( 0xbc8955e946fe31cd ) },   // 5^72
+    { UINT64_C( 0xb51d13aea4a488dd ), UINT64_C( 0x6babab6398bdbe41 ) },   // 5^73
+    { UINT64_C( 0xe264589a4dcdab14 ), UINT64_C( 0xc696963c7eed2dd1 ) },   // 5^74
+    { UINT64_C( 0x8d7eb76070a08aec ), UINT64_C( 0xfc1e1de5cf543ca2 ) },   // 5^75
+    { UINT64_C( 0xb0de65388cc8ada8 ), UINT64_C( 0x3b25a55f43294bcb ) },   // 5^76
+    { UINT64_C( 0xdd15fe86affad912 ), UINT64_C( 0x49ef0eb713f39ebe ) },   // 5^77
+    { UINT64_C( 0x8a2dbf142dfcc7ab ), UINT64_C( 0x6e3569326c784337 ) },   // 5^78
+    { UINT64_C( 0xacb92ed9397bf996 ), UINT64_C( 0x49c2c37f07965404 ) },   // 5^79
+    { UINT64_C( 0xd7e77a8f87daf7fb ), UINT64_C( 0xdc33745ec97be906 ) },   // 5^80
+    { UINT64_C( 0x86f0ac99b4e8dafd ), UINT64_C( 0x69a028bb3ded71a3 ) },   // 5^81
+    { UINT64_C( 0xa8acd7c0222311bc ), UINT64_C( 0xc40832ea0d68ce0c ) },   // 5^82
+    { UINT64_C( 0xd2d80db02aabd62b ), UINT64_C( 0xf50a3fa490c30190 ) },   // 5^83
+    { UINT64_C( 0x83c7088e1aab65db ), UINT64_C( 0x792667c6da79e0fa ) },   // 5^84
+    { UINT64_C( 0xa4b8cab1a1563f52 ), UINT64_C( 0x577001b891185938 ) },   // 5^85
+    { UINT64_C( 0xcde6fd5e09abcf26 ), UINT64_C( 0xed4c0226b55e6f86 ) },   // 5^86
+    { UINT64_C( 0x80b05e5ac60b6178 ), UINT64_C( 0x544f8158315b05b4 ) },   // 5^87
+    { UINT64_C( 0xa0dc75f1778e39d6 ), UINT64_C( 0x696361ae3db1c721 ) },   // 5^88
+    { UINT64_C( 0xc913936dd571c84c ), UINT64_C( 0x03bc3a19cd1e38e9 ) },   // 5^89
+    { UINT64_C( 0xfb5878494ace3a5f ), UINT64_C( 0x04ab48a04065c723 ) },   // 5^90
+    { UINT64_C( 0x9d174b2dcec0e47b ), UINT64_C( 0x62eb0d64283f9c76 ) },   // 5^91
+    { UINT64_C( 0xc45d1df942711d9a ), UINT64_C( 0x3ba5d0bd324f8394 ) },   // 5^92
+    { UINT64_C( 0xf5746577930d6500 ), UINT64_C( 0xca8f44ec7ee36479 ) },   // 5^93
+    { UINT64_C( 0x9968bf6abbe85f20 ), UINT64_C( 0x7e998b13cf4e1ecb ) },   // 5^94
+    { UINT64_C( 0xbfc2ef456ae276e8 ), UINT64_C( 0x9e3fedd8c321a67e ) },   // 5^95
+    { UINT64_C( 0xefb3ab16c59b14a2 ), UINT64_C( 0xc5cfe94ef3ea101e ) },   // 5^96
+    { UINT64_C( 0x95d04aee3b80ece5 ), UINT64_C( 0xbba1f1d158724a12 ) },   // 5^97
+    { UINT64_C( 0xbb445da9ca61281f ), UINT64_C( 0x2a8a6e45ae8edc97 ) },   // 5^98
+    { UINT64_C( 0xea1575143cf97226 ), UINT64_C( 0xf52d09d71a3293bd ) },   // 5^99
+    { UINT64_C( 0x924d692ca61be758 ), UINT64_C( 0x593c2626705f9c56 ) },   // 5^100
+    { UINT64_C( 0xb6e0c377cfa2e12e ), UINT64_C( 0x6f8b2fb00c77836c ) },   // 5^101
+    { UINT64_C( 0xe498f455c38b997a ), UINT64_C( 0x0b6dfb9c0f956447 ) },   // 5^102
+    { UINT64_C( 0x8edf98b59a373fec ), UINT64_C( 0x4724bd4189bd5eac ) },   // 5^103
+    { UINT64_C( 0xb2977ee300c50fe7 ), UINT64_C( 0x58edec91ec2cb657 ) },   // 5^104
+    { UINT64_C( 0xdf3d5e9bc0f653e1 ), UINT64_C( 0x2f2967b66737e3ed ) },   // 5^105
+    { UINT64_C( 0x8b865b215899f46c ), UINT64_C( 0xbd79e0d20082ee74 ) },   // 5^106
+    { UINT64_C( 0xae67f1e9aec07187 ), UINT64_C( 0xecd8590680a3aa11 ) },   // 5^107
+    { UINT64_C( 0xda01ee641a708de9 ), UINT64_C( 0xe80e6f4820cc9495 ) },   // 5^108
+    { UINT64_C( 0x884134fe908658b2 ), UINT64_C( 0x3109058d147fdcdd ) },   // 5^109
+    { UINT64_C( 0xaa51823e34a7eede ), UINT64_C( 0xbd4b46f0599fd415 ) },   // 5^110
+    { UINT64_C( 0xd4e5e2cdc1d1ea96 ), UINT64_C( 0x6c9e18ac7007c91a ) },   // 5^111
+    { UINT64_C( 0x850fadc09923329e ), UINT64_C( 0x03e2cf6bc604ddb0 ) },   // 5^112
+    { UINT64_C( 0xa6539930bf6bff45 ), UINT64_C( 0x84db8346b786151c ) },   // 5^113
+    { UINT64_C( 0xcfe87f7cef46ff16 ), UINT64_C( 0xe612641865679a63 ) },   // 5^114
+    { UINT64_C( 0x81f14fae158c5f6e ), UINT64_C( 0x4fcb7e8f3f60c07e ) },   // 5^115
+    { UINT64_C( 0xa26da3999aef7749 ), UINT64_C( 0xe3be5e330f38f09d ) },   // 5^116
+    { UINT64_C( 0xcb090c8001ab551c ), UINT64_C( 0x5cadf5bfd3072cc5 ) },   // 5^117
+    { UINT64_C( 0xfdcb4fa002162a63 ), UINT64_C( 0x73d9732fc7c8f7f6 ) },   // 5^118
+    { UINT64_C( 0x9e9f11c4014dda7e ), UINT64_C( 0x2867e7fddcdd9afa ) },   // 5^119
+    { UINT64_C( 0xc646d63501a1511d ), UINT64_C( 0xb281e1fd541501b8 ) },   // 5^120
+    { UINT64_C( 0xf7d88bc24209a565 ), UINT64_C( 0x1f225a7ca91a4226 ) },   // 5^121
+    { UINT64_C( 0x9ae757596946075f ), UINT64_C( 0x3375788de9b06958 ) },   // 5^122
+    { UINT64_C( 0xc1a12d2fc3978937 ), UINT64_C( 0x0052d6b1641c83ae ) },   // 5^123
+    { UINT64_C( 0xf209787bb47d6b84 ), UINT64_C( 0xc0678c5dbd23a49a ) },   // 5^124
+    { UINT64_C( 0x9745eb4d50ce6332 ), UINT64_C( 0xf840b7ba963646e0 ) },   // 5^125
+    { UINT64_C( 0xbd176620a501fbff ), UINT64_C( 0xb650e5a93bc3d898 ) },   // 5^126
+    { UINT64_C( 0xec5d3fa8ce427aff ), UINT64_C( 0xa3e51f138ab4cebe ) },   // 5^127
+    { UINT64_C( 0x93ba47c980e98cdf ), UINT64_C( 0xc66f336c36b10137 ) },   // 5^128
+    { UINT64_C( 0xb8a8d9bbe123f017 ), UINT64_C( 0xb80b0047445d4184 ) },   // 5^129
+    { UINT64_C( 0xe6d3102ad96cec1d ), UINT64_C( 0xa60dc059157491e5 ) },   // 5^130
+    { UINT64_C( 0x9043ea1ac7e41392 ), UINT64_C( 0x87c89837ad68db2f ) },   // 5^131
+    { UINT64_C( 0xb454e4a179dd1877 ), UINT64_C( 0x29babe4598c311fb ) },   // 5^132
+    { UINT64_C( 0xe16a1dc9d8545e94 ), UINT64_C( 0xf4296dd6fef3d67a ) },   // 5^133
+    { UINT64_C( 0x8ce2529e2734bb1d ), UINT64_C( 0x1899e4a65f58660c ) },   // 5^134
+    { UINT64_C( 0xb01ae745b101e9e4 ), UINT64_C( 0x5ec05dcff72e7f8f ) },   // 5^135
+    { UINT64_C( 0xdc21a1171d42645d ), UINT64_C( 0x76707543f4fa1f73 ) },   // 5^136
+    { UINT64_C( 0x899504ae72497eba ), UINT64_C( 0x6a06494a791c53a8 ) },   // 5^137
+    { UINT64_C( 0xabfa45da0edbde69 ), UINT64_C( 0x0487db9d17636892 ) },   // 5^138
+    { UINT64_C( 0xd6f8d7509292d603 ), UINT64_C( 0x45a9d2845d3c42b6 ) },   // 5^139
+    { UINT64_C( 0x865b86925b9bc5c2 ), UINT64_C( 0x0b8a2392ba45a9b2 ) },   // 5^140
+    { UINT64_C( 0xa7f26836f282b732 ), UINT64_C( 0x8e6cac7768d7141e ) },   // 5^141
+    { UINT64_C( 0xd1ef0244af2364ff ), UINT64_C( 0x3207d795430cd926 ) },   // 5^142
+    { UINT64_C( 0x8335616aed761f1f ), UINT64_C( 0x7f44e6bd49e807b8 ) },   // 5^143
+    { UINT64_C( 0xa402b9c5a8d3a6e7 ), UINT64_C( 0x5f16206c9c6209a6 ) },   // 5^144
+    { UINT64_C( 0xcd036837130890a1 ), UINT64_C( 0x36dba887c37a8c0f ) },   // 5^145
+    { UINT64_C( 0x802221226be55a64 ), UINT64_C( 0xc2494954da2c9789 ) },   // 5^146
+    { UINT64_C( 0xa02aa96b06deb0fd ), UINT64_C( 0xf2db9baa10b7bd6c ) },   // 5^147
+    { UINT64_C( 0xc83553c5c8965d3d ), UINT64_C( 0x6f92829494e5acc7 ) },   // 5^148
+    { UINT64_C( 0xfa42a8b73abbf48c ), UINT64_C( 0xcb772339ba1f17f9 ) },   // 5^149
+    { UINT64_C( 0x9c69a97284b578d7 ), UINT64_C( 0xff2a760414536efb ) },   // 5^150
+    { UINT64_C( 0xc38413cf25e2d70d ), UINT64_C( 0xfef5138519684aba ) },   // 5^151
+    { UINT64_C( 0xf46518c2ef5b8cd1 ), UINT64_C( 0x7eb258665fc25d69 ) },   // 5^152
+    { UINT64_C( 0x98bf2f79d5993802 ), UINT64_C( 0xef2f773ffbd97a61 ) },   // 5^153
+    { UINT64_C( 0xbeeefb584aff8603 ), UINT64_C( 0xaafb550ffacfd8fa ) },   // 5^154
+    { UINT64_C( 0xeeaaba2e5dbf6784 ), UINT64_C( 0x95ba2a53f983cf38 ) },   // 5^155
+    { UINT64_C( 0x952ab45cfa97a0b2 ), UINT64_C( 0xdd945a747bf26183 ) },   // 5^156
+    { UINT64_C( 0xba756174393d88df ), UINT64_C( 0x94f971119aeef9e4 ) },   // 5^157
+    { UINT64_C( 0xe912b9d1478ceb17 ), UINT64_C( 0x7a37cd5601aab85d ) },   // 5^158
+    { UINT64_C( 0x91abb422ccb812ee ), UINT64_C( 0xac62e055c10ab33a ) },   // 5^159
+    { UINT64_C( 0xb616a12b7fe617aa ), UINT64_C( 0x577b986b314d6009 ) },   // 5^160
+    { UINT64_C( 0xe39c49765fdf9d94 ), UINT64_C( 0xed5a7e85fda0b80b ) },   // 5^161
+    { UINT64_C( 0x8e41ade9fbebc27d ), UINT64_C( 0x14588f13be847307 ) },   // 5^162
+    { UINT64_C( 0xb1d219647ae6b31c ), UINT64_C( 0x596eb2d8ae258fc8 ) },   // 5^163
+    { UINT64_C( 0xde469fbd99a05fe3 ), UINT64_C( 0x6fca5f8ed9aef3bb ) },   // 5^164
+    { UINT64_C( 0x8aec23d680043bee ), UINT64_C( 0x25de7bb9480d5854 ) },   // 5^165
+    { UINT64_C( 0xada72ccc20054ae9 ), UINT64_C( 0xaf561aa79a10ae6a ) },   // 5^166
+    { UINT64_C( 0xd910f7ff28069da4 ), UINT64_C( 0x1b2ba1518094da04 ) },   // 5^167
+    { UINT64_C( 0x87aa9aff79042286 ), UINT64_C( 0x90fb44d2f05d0842 ) },   // 5^168
+    { UINT64_C( 0xa99541bf57452b28 ), UINT64_C( 0x353a1607ac744a53 ) },   // 5^169
+    { UINT64_C( 0xd3fa922f2d1675f2 ), UINT64_C( 0x42889b8997915ce8 ) },   // 5^170
+    { UINT64_C( 0x847c9b5d7c2e09b7 ), UINT64_C( 0x69956135febada11 ) },   // 5^171
+    { UINT64_C( 0xa59bc234db398c25 ), UINT64_C( 0x43fab9837e699095 ) },   // 5^172
+    { UINT64_C( 0xcf02b2c21207ef2e ), UINT64_C( 0x94f967e45e03f4bb ) },   // 5^173
+    { UINT64_C( 0x8161afb94b44f57d ), UINT64_C( 0x1d1be0eebac278f5 ) },   // 5^174
+    { UINT64_C( 0xa1ba1ba79e1632dc ), UINT64_C( 0x6462d92a69731732 ) },   // 5^175
+    { UINT64_C( 0xca28a291859bbf93 ), UINT64_C( 0x7d7b8f7503cfdcfe ) },   // 5^176
+    { UINT64_C( 0xfcb2cb35e702af78 ), UINT64_C( 0x5cda735244c3d43e ) },   // 5^177
+    { UINT64_C( 0x9defbf01b061adab ), UINT64_C( 0x3a0888136afa64a7 ) },   // 5^178
+    { UINT64_C( 0xc56baec21c7a1916 ), UINT64_C( 0x088aaa1845b8fdd0 ) },   // 5^179
+    { UINT64_C( 0xf6c69a72a3989f5b ), UINT64_C( 0x8aad549e57273d45 ) },   // 5^180
+    { UINT64_C( 0x9a3c2087a63f6399 ), UINT64_C( 0x36ac54e2f678864b ) },   // 5^181
+    { UINT64_C( 0xc0cb28a98fcf3c7f ), UINT64_C( 0x84576a1bb416a7dd ) },   // 5^182
+    { UINT64_C( 0xf0fdf2d3f3c30b9f ), UINT64_C( 0x656d44a2a11c51d5 ) },   // 5^183
+    { UINT64_C( 0x969eb7c47859e743 ), UINT64_C( 0x9f644ae5a4b1b325 ) },   // 5^184
+    { UINT64_C( 0xbc4665b596706114 ), UINT64_C( 0x873d5d9f0dde1fee ) },   // 5^185
+    { UINT64_C( 0xeb57ff22fc0c7959 ), UINT64_C( 0xa90cb506d155a7ea ) },   // 5^186
+    { UINT64_C( 0x9316ff75dd87cbd8 ), UINT64_C( 0x09a7f12442d588f2 ) },   // 5^187
+    { UINT64_C( 0xb7dcbf5354e9bece ), UINT64_C( 0x0c11ed6d538aeb2f ) },   // 5^188
+    { UINT64_C( 0xe5d3ef282a242e81 ), UINT64_C( 0x8f1668c8a86da5fa ) },   // 5^189
+    { UINT64_C( 0x8fa475791a569d10 ), UINT64_C( 0xf96e017d694487bc ) },   // 5^190
+    { UINT64_C( 0xb38d92d760ec4455 ), UINT64_C( 0x37c981dcc395a9ac ) },   // 5^191
+    { UINT64_C( 0xe070f78d3927556a ), UINT64_C( 0x85bbe253f47b1417 ) },   // 5^192
+    { UINT64_C( 0x8c469ab843b89562 ), UINT64_C( 0x93956d7478ccec8e ) },   // 5^193
+    { UINT64_C( 0xaf58416654a6babb ), UINT64_C( 0x387ac8d1970027b2 ) },   // 5^194
+    { UINT64_C( 0xdb2e51bfe9d0696a ), UINT64_C( 0x06997b05fcc0319e ) },   // 5^195
+    { UINT64_C( 0x88fcf317f22241e2 ), UINT64_C( 0x441fece3bdf81f03 ) },   // 5^196
+    { UINT64_C( 0xab3c2fddeeaad25a ), UINT64_C( 0xd527e81cad7626c3 ) },   // 5^197
+    { UINT64_C( 0xd60b3bd56a5586f1 ), UINT64_C( 0x8a71e223d8d3b074 ) },   // 5^198
+    { UINT64_C( 0x85c7056562757456 ), UINT64_C( 0xf6872d5667844e49 ) },   // 5^199
+    { UINT64_C( 0xa738c6bebb12d16c ), UINT64_C( 0xb428f8ac016561db ) },   // 5^200
+    { UINT64_C( 0xd106f86e69d785c7 ), UINT64_C( 0xe13336d701beba52 ) },   // 5^201
+    { UINT64_C( 0x82a45b450226b39c ), UINT64_C( 0xecc0024661173473 ) },   // 5^202
+    { UINT64_C( 0xa34d721642b06084 ), UINT64_C( 0x27f002d7f95d0190 ) },   // 5^203
+    { UINT64_C( 0xcc20ce9bd35c78a5 ), UINT64_C( 0x31ec038df7b441f4 ) },   // 5^204
+    { UINT64_C( 0xff290242c83396ce ), UINT64_C( 0x7e67047175a15271 ) },   // 5^205
+    { UINT64_C( 0x9f79a169bd203e41 ), UINT64_C( 0x0f0062c6e984d386 ) },   // 5^206
+    { UINT64_C( 0xc75809c42c684dd1 ), UINT64_C( 0x52c07b78a3e60868 ) },   // 5^207
+    { UINT64_C( 0xf92e0c3537826145 ), UINT64_C( 0xa7709a56ccdf8a82 ) },   // 5^208
+    { UINT64_C( 0x9bbcc7a142b17ccb ), UINT64_C( 0x88a66076400bb691 ) },   // 5^209
+    { UINT64_C( 0xc2abf989935ddbfe ), UINT64_C( 0x6acff893d00ea435 ) },   // 5^210
+    { UINT64_C( 0xf356f7ebf83552fe ), UINT64_C( 0x0583f6b8c4124d43 ) },   // 5^211
+    { UINT64_C( 0x98165af37b2153de ), UINT64_C( 0xc3727a337a8b704a ) },   // 5^212
+    { UINT64_C( 0xbe1bf1b059e9a8d6 ), UINT64_C( 0x744f18c0592e4c5c ) },   // 5^213
+    { UINT64_C( 0xeda2ee1c7064130c ), UINT64_C( 0x1162def06f79df73 ) },   // 5^214
+    { UINT64_C( 0x9485d4d1c63e8be7 ), UINT64_C( 0x8addcb5645ac2ba8 ) },   // 5^215
+    { UINT64_C( 0xb9a74a0637ce2ee1 ), UINT64_C( 0x6d953e2bd7173692 ) },   // 5^216
+    { UINT64_C( 0xe8111c87c5c1ba99 ), UINT64_C( 0xc8fa8db6ccdd0437 ) },   // 5^217
+    { UINT64_C( 0x910ab1d4db9914a0 ), UINT64_C( 0x1d9c9892400a22a2 ) },   // 5^218
+    { UINT64_C( 0xb54d5e4a127f59c8 ), UINT64_C( 0x2503beb6d00cab4b ) },   // 5^219
+    { UINT64_C( 0xe2a0b5dc971f303a ), UINT64_C( 0x2e44ae64840fd61d ) },   // 5^220
+    { UINT64_C( 0x8da471a9de737e24 ), UINT64_C( 0x5ceaecfed289e5d2 ) },   // 5^221
+    { UINT64_C( 0xb10d8e1456105dad ), UINT64_C( 0x7425a83e872c5f47 ) },   // 5^222
+    { UINT64_C( 0xdd50f1996b947518 ), UINT64_C( 0xd12f124e28f77719 ) },   // 5^223
+    { UINT64_C( 0x8a5296ffe33cc92f ), UINT64_C( 0x82bd6b70d99aaa6f ) },   // 5^224
+    { UINT64_C( 0xace73cbfdc0bfb7b ), UINT64_C( 0x636cc64d1001550b ) },   // 5^225
+    { UINT64_C( 0xd8210befd30efa5a ), UINT64_C( 0x3c47f7e05401aa4e ) },   // 5^226
+    { UINT64_C( 0x8714a775e3e95c78 ), UINT64_C( 0x65acfaec34810a71 ) },   // 5^227
+    { UINT64_C( 0xa8d9d1535ce3b396 ), UINT64_C( 0x7f1839a741a14d0d ) },   // 5^228
+    { UINT64_C( 0xd31045a8341ca07c ), UINT64_C( 0x1ede48111209a050 ) },   // 5^229
+    { UINT64_C( 0x83ea2b892091e44d ), UINT64_C( 0x934aed0aab460432 ) },   // 5^230
+    { UINT64_C( 0xa4e4b66b68b65d60 ), UINT64_C( 0xf81da84d5617853f ) },   // 5^231
+    { UINT64_C( 0xce1de40642e3f4b9 ), UINT64_C( 0x36251260ab9d668e ) },   // 5^232
+    { UINT64_C( 0x80d2ae83e9ce78f3 ), UINT64_C( 0xc1d72b7c6b426019 ) },   // 5^233
+    { UINT64_C( 0xa1075a24e4421730 ), UINT64_C( 0xb24cf65b8612f81f ) },   // 5^234
+    { UINT64_C( 0xc94930ae1d529cfc ), UINT64_C( 0xdee033f26797b627 ) },   // 5^235
+    { UINT64_C( 0xfb9b7cd9a4a7443c ), UINT64_C( 0x169840ef017da3b1 ) },   // 5^236
+    { UINT64_C( 0x9d412e0806e88aa5 ), UINT64_C( 0x8e1f289560ee864e ) },   // 5^237
+    { UINT64_C( 0xc491798a08a2ad4e ), UINT64_C( 0xf1a6f2bab92a27e2 ) },   // 5^238
+    { UINT64_C( 0xf5b5d7ec8acb58a2 ), UINT64_C( 0xae10af696774b1db ) },   // 5^239
+    { UINT64_C( 0x9991a6f3d6bf1765 ), UINT64_C( 0xacca6da1e0a8ef29 ) },   // 5^240
+    { UINT64_C( 0xbff610b0cc6edd3f ), UINT64_C( 0x17fd090a58d32af3 ) },   // 5^241
+    { UINT64_C( 0xeff394dcff8a948e ), UINT64_C( 0xddfc4b4cef07f5b0 ) },   // 5^242
+    { UINT64_C( 0x95f83d0a1fb69cd9 ), UINT64_C( 0x4abdaf101564f98e ) },   // 5^243
+    { UINT64_C( 0xbb764c4ca7a4440f ), UINT64_C( 0x9d6d1ad41abe37f1 ) },   // 5^244
+    { UINT64_C( 0xea53df5fd18d5513 ), UINT64_C( 0x84c86189216dc5ed ) },   // 5^245
+    { UINT64_C( 0x92746b9be2f8552c ), UINT64_C( 0x32fd3cf5b4e49bb4 ) },   // 5^246
+    { UINT64_C( 0xb7118682dbb66a77 ), UINT64_C( 0x3fbc8c33221dc2a1 ) },   // 5^247
+    { UINT64_C( 0xe4d5e82392a40515 ), UINT64_C( 0x0fabaf3feaa5334a ) },   // 5^248
+    { UINT64_C( 0x8f05b1163ba6832d ), UINT64_C( 0x29cb4d87f2a7400e ) },   // 5^249
+    { UINT64_C( 0xb2c71d5bca9023f8 ), UINT64_C( 0x743e20e9ef511012 ) },   // 5^250
+    { UINT64_C( 0xdf78e4b2bd342cf6 ), UINT64_C( 0x914da9246b255416 ) },   // 5^251
+    { UINT64_C( 0x8bab8eefb6409c1a ), UINT64_C( 0x1ad089b6c2f7548e ) },   // 5^252
+    { UINT64_C( 0xae9672aba3d0c320 ), UINT64_C( 0xa184ac2473b529b1 ) },   // 5^253
+    { UINT64_C( 0xda3c0f568cc4f3e8 ), UINT64_C( 0xc9e5d72d90a2741e ) },   // 5^254
+    { UINT64_C( 0x8865899617fb1871 ), UINT64_C( 0x7e2fa67c7a658892 ) },   // 5^255
+    { UINT64_C( 0xaa7eebfb9df9de8d ), UINT64_C( 0xddbb901b98feeab7 ) },   // 5^256
+    { UINT64_C( 0xd51ea6fa85785631 ), UINT64_C( 0x552a74227f3ea565 ) },   // 5^257
+    { UINT64_C( 0x8533285c936b35de ), UINT64_C( 0xd53a88958f87275f ) },   // 5^258
+    { UINT64_C( 0xa67ff273b8460356 ), UINT64_C( 0x8a892abaf368f137 ) },   // 5^259
+    { UINT64_C( 0xd01fef10a657842c ), UINT64_C( 0x2d2b7569b0432d85 ) },   // 5^260
+    { UINT64_C( 0x8213f56a67f6b29b ), UINT64_C( 0x9c3b29620e29fc73 ) },   // 5^261
+    { UINT64_C( 0xa298f2c501f45f42 ), UINT64_C( 0x8349f3ba91b47b8f ) },   // 5^262
+    { UINT64_C( 0xcb3f2f7642717713 ), UINT64_C( 0x241c70a936219a73 ) },   // 5^263
+    { UINT64_C( 0xfe0efb53d30dd4d7 ), UINT64_C( 0xed238cd383aa0110 ) },   // 5^264
+    { UINT64_C( 0x9ec95d1463e8a506 ), UINT64_C( 0xf4363804324a40aa ) },   // 5^265
+    { UINT64_C( 0xc67bb4597ce2ce48 ), UINT64_C( 0xb143c6053edcd0d5 ) },   // 5^266
+    { UINT64_C( 0xf81aa16fdc1b81da ), UINT64_C( 0xdd94b7868e94050a ) },   // 5^267
+    { UINT64_C( 0x9b10a4e5e9913128 ), UINT64_C( 0xca7cf2b4191c8326 ) },   // 5^268
+    { UINT64_C( 0xc1d4ce1f63f57d72 ), UINT64_C( 0xfd1c2f611f63a3f0 ) },   // 5^269
+    { UINT64_C( 0xf24a01a73cf2dccf ), UINT64_C( 0xbc633b39673c8cec ) },   // 5^270
+    { UINT64_C( 0x976e41088617ca01 ), UINT64_C( 0xd5be0503e085d813 ) },   // 5^271
+    { UINT64_C( 0xbd49d14aa79dbc82 ), UINT64_C( 0x4b2d8644d8a74e18 ) },   // 5^272
+    { UINT64_C( 0xec9c459d51852ba2 ), UINT64_C( 0xddf8e7d60ed1219e ) },   // 5^273
+    { UINT64_C( 0x93e1ab8252f33b45 ), UINT64_C( 0xcabb90e5c942b503 ) },   // 5^274
+    { UINT64_C( 0xb8da1662e7b00a17 ), UINT64_C( 0x3d6a751f3b936243 ) },   // 5^275
+    { UINT64_C( 0xe7109bfba19c0c9d ), UINT64_C( 0x0cc512670a783ad4 ) },   // 5^276
+    { UINT64_C( 0x906a617d450187e2 ), UINT64_C( 0x27fb2b80668b24c5 ) },   // 5^277
+    { UINT64_C( 0xb484f9dc9641e9da ), UINT64_C( 0xb1f9f660802dedf6 ) },   // 5^278
+    { UINT64_C( 0xe1a63853bbd26451 ), UINT64_C( 0x5e7873f8a0396973 ) },   // 5^279
+    { UINT64_C( 0x8d07e33455637eb2 ), UINT64_C( 0xdb0b487b6423e1e8 ) },   // 5^280
+    { UINT64_C( 0xb049dc016abc5e5f ), UINT64_C( 0x91ce1a9a3d2cda62 ) },   // 5^281
+    { UINT64_C( 0xdc5c5301c56b75f7 ), UINT64_C( 0x7641a140cc7810fb ) },   // 5^282
+    { UINT64_C( 0x89b9b3e11b6329ba ), UINT64_C( 0xa9e904c87fcb0a9d ) },   // 5^283
+    { UINT64_C( 0xac2820d9623bf429 ), UINT64_C( 0x546345fa9fbdcd44 ) },   // 5^284
+    { UINT64_C( 0xd732290fbacaf133 ), UINT64_C( 0xa97c177947ad4095 ) },   // 5^285
+    { UINT64_C( 0x867f59a9d4bed6c0 ), UINT64_C( 0x49ed8eabcccc485d ) },   // 5^286
+    { UINT64_C( 0xa81f301449ee8c70 ), UINT64_C( 0x5c68f256bfff5a74 ) },   // 5^287
+    { UINT64_C( 0xd226fc195c6a2f8c ), UINT64_C( 0x73832eec6fff3111 ) },   // 5^288
+    { UINT64_C( 0x83585d8fd9c25db7 ), UINT64_C( 0xc831fd53c5ff7eab ) },   // 5^289
+    { UINT64_C( 0xa42e74f3d032f525 ), UINT64_C( 0xba3e7ca8b77f5e55 ) },   // 5^290
+    { UINT64_C( 0xcd3a1230c43fb26f ), UINT64_C( 0x28ce1bd2e55f35eb ) },   // 5^291
+    { UINT64_C( 0x80444b5e7aa7cf85 ), UINT64_C( 0x7980d163cf5b81b3 ) },   // 5^292
+    { UINT64_C( 0xa0555e361951c366 ), UINT64_C( 0xd7e105bcc332621f ) },   // 5^293
+    { UINT64_C( 0xc86ab5c39fa63440 ), UINT64_C( 0x8dd9472bf3fefaa7 ) },   // 5^294
+    { UINT64_C( 0xfa856334878fc150 ), UINT64_C( 0xb14f98f6f0feb951 ) },   // 5^295
+    { UINT64_C( 0x9c935e00d4b9d8d2 ), UINT64_C( 0x6ed1bf9a569f33d3 ) },   // 5^296
+    { UINT64_C( 0xc3b8358109e84f07 ), UINT64_C( 0x0a862f80ec4700c8 ) },   // 5^297
+    { UINT64_C( 0xf4a642e14c6262c8 ), UINT64_C( 0xcd27bb612758c0fa ) },   // 5^298
+    { UINT64_C( 0x98e7e9cccfbd7dbd ), UINT64_C( 0x8038d51cb897789c ) },   // 5^299
+    { UINT64_C( 0xbf21e44003acdd2c ), UINT64_C( 0xe0470a63e6bd56c3 ) },   // 5^300
+    { UINT64_C( 0xeeea5d5004981478 ), UINT64_C( 0x1858ccfce06cac74 ) },   // 5^301
+    { UINT64_C( 0x95527a5202df0ccb ), UINT64_C( 0x0f37801e0c43ebc8 ) },   // 5^302
+    { UINT64_C( 0xbaa718e68396cffd ), UINT64_C( 0xd30560258f54e6ba ) },   // 5^303
+    { UINT64_C( 0xe950df20247c83fd ), UINT64_C( 0x47c6b82ef32a2069 ) },   // 5^304
+    { UINT64_C( 0x91d28b7416cdd27e ), UINT64_C( 0x4cdc331d57fa5441 ) },   // 5^305
+    { UINT64_C( 0xb6472e511c81471d ), UINT64_C( 0xe0133fe4adf8e952 ) },   // 5^306
+    { UINT64_C( 0xe3d8f9e563a198e5 ), UINT64_C( 0x58180fddd97723a6 ) },   // 5^307
+    { UINT64_C( 0x8e679c2f5e44ff8f ), UINT64_C( 0x570f09eaa7ea7648 ) },   // 5^308
+};
+
+struct UInt128
+{
+    uint64_t low;
+    uint64_t high;
+};
+
+inline UInt128 full_multiplication( uint64_t a, uint64_t b )
+{
+    UInt128 result;
+#if defined( __SIZEOF_INT128__ )
+    unsigned __int128 product = static_cast<unsigned __int128>( a ) * b;
+    result.low = static_cast<uint64_t>( product );
+    result.high = static_cast<uint64_t>( product >> 64 );
+#elif defined( _MSC_VER ) && defined( _M_X64 )
+    result.low = _umul128( a, b, &result.high );
+#else
+    uint64_t a_low = a & 0xffffffff, a_high = a >> 32;
+    uint64_t b_low = b & 0xffffffff, b_high = b >> 32;
+    uint64_t low_low = a_low * b_low;
+    uint64_t low_high = a_low * b_high;
+    uint64_t high_low = a_high * b_low;
+    uint64_t high_high = a_high * b_high;
+    uint64_t middle = (low_low >> 32) + (low_high & 0xffffffff) + (high_low & 0xffffffff);
+    result.low = (middle << 32) | (low_low & 0xffffffff);
+    result.high = high_high + (low_high >> 32) + (high_low >> 32) + (middle >> 32);
+#endif
+    return result;
+}
+
+inline unsigned int count_leading_zeros( uint64_t bits )
+{
+    assert( bits != 0 );
+#if defined( __GNUC__ )
+    return __builtin_clzll( bits );
+#else
+    unsigned int n = 0;
+    while( (bits & (uint64_t( 1 ) << 63)) == 0 )
+    {
+        bits <<= 1;
+        ++n;
+    }
+    return n;
+#endif
+}
+
+inline double make_double( bool is_negative, uint64_t mantissa, int biased_exponent )
+{
+    uint64_t bits = mantissa | (static_cast<uint64_t>( biased_exponent ) << 52);
+    if( is_negative )
+        bits |= uint64_t( 1 ) << 63;
+    double result;
+    memcpy( &result, &bits, sizeof( result ) );
+    return result;
+}
+
+bool eisel_lemire( uint64_t w, int q, bool is_negative, double * p_result_out )
+{
+    // Returns false if the result can't be decided
+    const int mantissa_bits = 52;
+    const int minimum_exponent = -1023;
+    const int infinite_exponent = 0x7ff;
+
+    if( w == 0 || q < smallest_power_of_ten )
+    {
+        *p_result_out = make_double( is_negative, 0, 0 );
+        return true;
+    }
+    if( q > largest_power_of_ten )
+    {
+        *p_result_out = make_double( is_negative, 0, infinite_exponent );
+        return true;
+    }
+
+    unsigned int leading_zeros = count_leading_zeros( w );
+    w <<= leading_zeros;
+
+    // Only the top mantissa_bits + 3 bits of the product are needed, so the
+    // second half of the power only matters if they might be affected by it
+    const uint64_t * p_power = powers_of_five_128[q - smallest_power_of_ten];
+    UInt128 product = full_multiplication( w, p_power[0] );
+    const uint64_t precision_mask = ~uint64_t( 0 ) >> (mantissa_bits + 3);
+    if( (product.high & precision_mask) == precision_mask )
+    {
+        UInt128 second_product = full_multiplication( w, p_power[1] );
+        product.low += second_product.high;
+        if( second_product.high > product.low )
+            ++product.high;
+        if( product.low == ~uint64_t( 0 ) && (q < -27 || q > 55) )
+            return false;
+    }
+
+    unsigned int upper_bit = static_cast<unsigned int>( product.high >> 63 );
+    unsigned int shift = upper_bit + 64 - mantissa_bits - 3;
+    uint64_t mantissa = product.high >> shift;
+
+    // ((152170 + 65536) * q) >> 16 is floor( q * log2( 10 ) ) for the range of q used
+    int power2 = (((152170 + 65536) * q) >> 16) + 63 + upper_bit - leading_zeros - minimum_exponent;
+
+    if( power2 <= 0 )   // Subnormal
+    {
+        if( -power2 + 1 >= 64 )
+        {
+            *p_result_out = make_double( is_negative, 0, 0 );
+            return true;
+        }
+        mantissa >>= -power2 + 1;
+        mantissa += (mantissa & 1);
+        mantissa >>= 1;
+        power2 = (mantissa < (uint64_t( 1 ) << mantissa_bits)) ? 0 : 1;
+        *p_result_out = make_double( is_negative, mantissa & ~(uint64_t( 1 ) << mantissa_bits), power2 );
+        return true;
+    }
+
+    // Round ties to even.  Exact ties are only possible for small q
+    if( product.low <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 &&
+            (mantissa << shift) == product.high )
+        mantissa &= ~uint64_t( 1 );
+
+    mantissa += (mantissa & 1);
+    mantissa >>= 1;
+    if( mantissa >= (uint64_t( 2 ) << mantissa_bits) )
+    {
+        mantissa = uint64_t( 1 ) << mantissa_bits;
+        ++power2;
+    }
+    mantissa &= ~(uint64_t( 1 ) << mantissa_bits);
+
+    if( power2 >= infinite_exponent )
+        *p_result_out = make_double( is_negative, 0, infinite_exponent );
+    else
+        *p_result_out = make_double( is_negative, mantissa, power2 );
+    return true;
+}
+
+double locale_independent_strtod( const std::string & r_text )
+{
+    // JSON always uses '.' as the decimal point, but strtod() uses the
+    // decimal point of the current locale
+    const char * p_decimal_point = localeconv()->decimal_point;
+    if( p_decimal_point[0] == '.' && p_decimal_point[1] == '\0' )
+        return strtod( r_text.c_str(), 0 );
+
+    std::string localised;
+    for( std::string::const_iterator i( r_text.begin() ); i != r_text.end(); ++i )
+        if( *i == '.' )
+            localised += p_decimal_point;
+        else
+            localised += *i;
+    return strtod( localised.c_str(), 0 );
+}
+
+class DecimalAccumulator
+{
+    // Collects the first 19 significant digits of a number, and its decimal
+    // exponent, as the number is read
+
+private:
+    struct Members {
+        uint64_t significand;
+        int n_digits;               // Significant digits in significand
+        int exponent;               // Adjustment for digits not in significand, and frac digits
+        int explicit_exponent;
+        bool is_negative;
+        bool is_explicit_exponent_negative;
+        bool is_truncated;          // Non-zero digits were not included in significand
+
+        Members()
+            : significand( 0 ), n_digits( 0 ), exponent( 0 ), explicit_exponent( 0 ),
+                is_negative( false ), is_explicit_exponent_negative( false ),
+                is_truncated( false )
+        {}
+    } m;
+
+    enum { max_digits = 19, max_explicit_exponent = 100000 };
+
+public:
+    void minus() { m.is_negative = true; }
+    void int_digit( int c )
+    {
+        if( m.n_digits < max_digits )
+            accept_digit( c );
+        else
+            drop_int_digit( c );
+    }
+    void frac_digit( int c )
+    {
+        if( m.n_digits < max_digits )
+        {
+            accept_digit( c );
+            --m.exponent;
+        }
+        else if( c != '0' )
+            m.is_truncated = true;
+    }
+    void exp_minus() { m.is_explicit_exponent_negative = true; }
+    void exp_digit( int c )
+    {
+        if( m.explicit_exponent < max_explicit_exponent )
+            m.explicit_exponent = m.explicit_exponent * 10 + (c - '0');
+    }
+
+    double to_double( const std::string & r_text ) const
+    {
+        // r_text is the text of the number, for the rare cases that need it
+        int q = m.exponent + (m.is_explicit_exponent_negative ? -m.explicit_exponent : m.explicit_exponent);
+
+        // Clinger's fast path: w and 10^q are exact doubles, so a single
+        // correctly rounded operation gives the answer
+        static const double exact_powers_of_ten[] = {
+                1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22 };
+        if( ! m.is_truncated && m.significand <= (uint64_t( 1 ) << 53) && q >= -22 && q <= 22 &&
+                is_fast_path_accurate() )
+        {
+            double value = static_cast<double>( m.significand );
+            value = q < 0 ? value / exact_powers_of_ten[-q] : value * exact_powers_of_ten[q];
+            return m.is_negative ? -value : value;
+        }
+
+        double value;
+        if( ! eisel_lemire( m.significand, q, m.is_negative, &value ) )
+            return locale_independent_strtod( r_text );
+        if( m.is_truncated )
+        {
+            // The number is between significand and significand + 1.  If
+            // both round to the same double, that is the answer
+            double upper_value;
+            if( ! eisel_lemire( m.significand + 1, q, m.is_negative, &upper_value ) ||
+                    upper_value != value )
+                return locale_independent_strtod( r_text );
+        }
+        return value;
+    }
+
+private:
+    void accept_digit( int c )
+    {
+        m.significand = m.significand * 10 + (c - '0');
+        if( m.significand != 0 )    // Leading zeros are not significant
+            ++m.n_digits;
+    }
+    void drop_int_digit( int c )
+    {
+        ++m.exponent;
+        if( c != '0' )
+            m.is_truncated = true;
+    }
+    static bool is_fast_path_accurate()
+    {
+        // Intermediate results must not have extra precision (e.g. x87)
+#if defined( FLT_EVAL_METHOD )
+        return FLT_EVAL_METHOD == 0;
+#else
+        return true;
+#endif
+    }
+};
+
 //----------------------------------------------------------------------------
 //                             class UTF8Sequence
 //----------------------------------------------------------------------------
@@ -130,16 +1986,77 @@ private:
         }
         utf8[0] |= marker;
     }
-};
+};
+
+//----------------------------------------------------------------------------
+//                   JSON reading functions and classes
+//----------------------------------------------------------------------------
+
+inline bool is_separator( int c )
+{
+    return isspace( c ) || c == ',' || c == ']' || c == '}' ||
+            c == Reader::EOM;
+}
+
+inline bool is_unescaped_string_char( char c )
+{
+    // unescaped = %x20-21 / %x23-5B / %x5D-10FFFF
+    return static_cast< unsigned char >( c ) >= 0x20 && c != '"' && c != '\\';
+}
+
+inline bool is_skip_significant_char( char c )
+{
+    // The characters skip() needs to look at to find the end of an object
+    // or array
+    switch( c )
+    {
+    case '"': case '\\': case '[': case ']': case '{': case '}':
+        return true;
+    }
+    return false;
+}
+
+#if CLJP_X86_SIMD
+
+CLJP_TARGET_SSE42
+const char * find_skip_significant_char_sse42( const char * p, const char * p_end )
+{
+    // Returns the first character in a whole number of 16 byte groups that
+    // skip() needs to look at, or the start of the remaining partial group
+    while( p_end - p >= 16 )
+    {
+        __m128i in = _mm_loadu_si128( reinterpret_cast< const __m128i * >( p ) );
+        __m128i found = _mm_or_si128(
+                _mm_or_si128( _mm_cmpeq_epi8( in, _mm_set1_epi8( '"' ) ),
+                                _mm_cmpeq_epi8( in, _mm_set1_epi8( '\\' ) ) ),
+                _mm_or_si128(
+                        _mm_or_si128( _mm_cmpeq_epi8( in, _mm_set1_epi8( '[' ) ),
+                                        _mm_cmpeq_epi8( in, _mm_set1_epi8( ']' ) ) ),
+                        _mm_or_si128( _mm_cmpeq_epi8( in, _mm_set1_epi8( '{' ) ),
+                                        _mm_cmpeq_epi8( in, _mm_set1_epi8( '}' ) ) ) ) );
+        unsigned int mask = static_cast< unsigned int >( _mm_movemask_epi8( found ) );
+        if( mask != 0 )
+            return p + count_trailing_zeros( mask );
+        p += 16;
+    }
+    return p;
+}
 
-//----------------------------------------------------------------------------
-//                   JSON reading functions and classes
-//----------------------------------------------------------------------------
+#endif  // CLJP_X86_SIMD
 
-inline bool is_separator( int c )
+inline const char * find_skip_significant_char( const char * p, const char * p_end )
 {
-    return isspace( c ) || c == ',' || c == ']' || c == '}' ||
-            c == Reader::EOM;
+#if CLJP_X86_SIMD
+    if( is_sse42_enabled() )
+    {
+        p = find_skip_significant_char_sse42( p, p_end );
+        if( p_end - p >= 16 )
+            return p;
+    }
+#endif
+    while( p < p_end && ! is_skip_significant_char( *p ) )
+        ++p;
+    return p;
 }
 
 class HexAccumulator
@@ -172,25 +2089,26 @@ public:
     bool is_ok() const { return m.is_ok; }
 };
 
+template< typename Tinput >
 class UnicodeCodePointReader
 {
     struct Members {
-        ReadUTF8WithUnget & r_input;
+        Tinput & r_input;
         int c;
-        Parser::Status status;
+        ParserBase::Status status;
         int code_point;
 
-        Members( ReadUTF8WithUnget & r_input_in )
+        Members( Tinput & r_input_in )
             :
             r_input( r_input_in ),
             c( '\0' ),
-            status( Parser::PS_OK ),
+            status( ParserBase::PS_OK ),
             code_point( 0 )
         {}
     } m;
 
 public:
-    UnicodeCodePointReader( ReadUTF8WithUnget & r_input_in )
+    UnicodeCodePointReader( Tinput & r_input_in )
         : m( r_input_in )
     {
         //           %x75 4HEXDIG )  ; uXXXX                U+XXXX
@@ -206,8 +2124,8 @@ public:
         }
     }
 
-    Parser::Status status() const { return m.status; }
-    operator Parser::Status() const { return status(); }
+    ParserBase::Status status() const { return m.status; }
+    operator ParserBase::Status() const { return status(); }
     int code_point() const { return m.code_point; }
     UTF8Sequence as_utf8() const { return UTF8Sequence( m.code_point ); }
 
@@ -226,9 +2144,9 @@ private:
                 break;
         if( ! accumulator.is_ok() )
         {
-            m.status = Parser::PS_BAD_UNICODE_ESCAPE;
+            m.status = ParserBase::PS_BAD_UNICODE_ESCAPE;
             if( m.c == Reader::EOM )
-                m.status = Parser::PS_UNEXPECTED_END_OF_MESSAGE;
+                m.status = ParserBase::PS_UNEXPECTED_END_OF_MESSAGE;
             else if( m.c == '"' )
                 m.r_input.unget( m.c );     // Push back quote so end-of-string can be found later
             return false;
@@ -256,29 +2174,31 @@ private:
 
     void report_bad_unicode_escape()
     {
-        if( m.status == Parser::PS_OK )     // Don't overwrite an already recorded error
-            m.status = Parser::PS_BAD_UNICODE_ESCAPE;
+        if( m.status == ParserBase::PS_OK )     // Don't overwrite an already recorded error
+            m.status = ParserBase::PS_BAD_UNICODE_ESCAPE;
     }
 };
 
+template< typename Tinput >
 class StringReader
 {
 private:
     struct Members {
-        ReadUTF8WithUnget & r_input;
+        Tinput & r_input;
         int c;
         std::string * p_string;
-        Parser::Status status;
+        size_t max_size;
+        ParserBase::Status status;
 
-        Members( ReadUTF8WithUnget & r_input_in, int c_in, std::string * p_string_out )
-            : r_input( r_input_in ), c( c_in ), p_string( p_string_out ),
-                status( Parser::PS_OK )
+        Members( Tinput & r_input_in, int c_in, std::string * p_string_out, size_t max_size_in )
+            : r_input( r_input_in ), c( c_in ), p_string( p_string_out ), max_size( max_size_in ),
+                status( ParserBase::PS_OK )
         {}
     } m;
 
 public:
-    StringReader( ReadUTF8WithUnget & r_input_in, int c_in, std::string * p_string_out )
-        : m( r_input_in, c_in, p_string_out )
+    StringReader( Tinput & r_input_in, int c_in, std::string * p_string_out, size_t max_size_in = ~size_t( 0 ) )
+        : m( r_input_in, c_in, p_string_out, max_size_in )
     {
         // string = quotation-mark *char quotation-mark
 
@@ -289,8 +2209,8 @@ public:
         parse_string();
     }
 
-    Parser::Status status() const { return m.status; }
-    operator Parser::Status() const { return status(); }
+    ParserBase::Status status() const { return m.status; }
+    operator ParserBase::Status() const { return status(); }
 
 private:
     void get()
@@ -298,12 +2218,6 @@ private:
         m.c = m.r_input.get();
     }
 
-    void accept_and_get()
-    {
-        *m.p_string += m.c;
-        m.c = m.r_input.get();
-    }
-
     void skip_opening_quotes()
     {
         get();
@@ -334,10 +2248,17 @@ private:
                 handle_unescaped();
             else
                 handle_escaped();
+
+            if( m.p_string->size() > m.max_size )
+            {
+                // Unlike other errors, stop straight away
+                m.status = ParserBase::PS_MAX_STRING_SIZE_EXCEEDED;
+                return;
+            }
         }
 
         if( m.c == Reader::EOM )
-            m.status = Parser::PS_UNEXPECTED_END_OF_MESSAGE;
+            m.status = ParserBase::PS_UNEXPECTED_END_OF_MESSAGE;
     }
 
     void handle_unescaped()
@@ -346,11 +2267,44 @@ private:
         // %x22 = ", %x5c = \ which are already handled elsewhere
 
         if( m.c < 0x20 )
-            m.status = Parser::PS_BAD_FORMAT_STRING;
+            m.status = ParserBase::PS_BAD_FORMAT_STRING;
 
         accept_and_get();
     }
 
+    void accept_and_get()
+    {
+        *m.p_string += m.c;
+        accept_unescaped_run();
+        get();
+    }
+
+    void accept_unescaped_run()
+    {
+        // Copy any following characters that need no special handling
+        // straight from the input.  Once the string has an error the
+        // parser's idea of where it ends may differ from the index's, so
+        // the index is only used while there is none.
+        const char * p_begin = m.r_input.span_begin();
+        const char * p = m.status == ParserBase::PS_OK ? m.r_input.span_next_stop() : 0;
+        if( ! p )
+        {
+            const char * p_end = m.r_input.span_end();
+            p = p_begin;
+            while( p < p_end && is_unescaped_string_char( *p ) )
+                ++p;
+        }
+        size_t n_allowed = m.max_size > m.p_string->size() ? m.max_size - m.p_string->size() : 0;
+        if( static_cast< size_t >( p - p_begin ) > n_allowed )
+            p = p_begin + n_allowed + 1;    // Enough to exceed the limit
+        if( p != p_begin )
+        {
+            m.p_string->append( p_begin, p );
+            m.r_input.span_advance_to( p );
+        }
+    }
+
+
     void handle_escaped()
     {
         //           %x22 /          ; "    quotation mark  U+0022
@@ -378,10 +2332,10 @@ private:
 
         else
         {
-            record_first_error( Parser::PS_BAD_FORMAT_STRING );
+            record_first_error( ParserBase::PS_BAD_FORMAT_STRING );
 
             if( m.c == Reader::EOM )
-                m.status = Parser::PS_UNEXPECTED_END_OF_MESSAGE;
+                m.status = ParserBase::PS_UNEXPECTED_END_OF_MESSAGE;
         }
     }
 
@@ -402,46 +2356,54 @@ private:
         if( m.c != 'u' )
             return false;
 
-        UnicodeCodePointReader code_point_reader( m.r_input );
+        UnicodeCodePointReader< Tinput > code_point_reader( m.r_input );
 
         // Allow for a successful operation, without overwriting the error code of a previous unsuccessful operation
-        Parser::Status current_status = code_point_reader.status();
+        ParserBase::Status current_status = code_point_reader.status();
         get();
 
         record_first_error( current_status );
 
-        if( current_status != Parser::PS_OK )
+        if( current_status != ParserBase::PS_OK )
             return false;
 
         *m.p_string += code_point_reader.as_utf8();
         return true;
     }
 
-    void record_first_error( Parser::Status current_status )
+    void record_first_error( ParserBase::Status current_status )
     {
-        if( m.status == Parser::PS_OK )
+        if( m.status == ParserBase::PS_OK )
             m.status = current_status;
     }
 };
 
+template< typename Tinput >
 class NumberReader
 {
 private:
     struct Members {
-        ReadUTF8WithUnget & r_input;
+        Tinput & r_input;
         int c;
         Event * p_event;
-        Parser::Status status;
-
-        Members( ReadUTF8WithUnget & r_input_in, int c_in, Event * p_event_out )
+        ParserBase::Status status;
+        unsigned int flags;
+        uint64_t int_magnitude;
+        DecimalAccumulator decimal;
+        size_t max_size;
+        bool is_too_long;
+
+        Members( Tinput & r_input_in, int c_in, Event * p_event_out, size_t max_size_in )
             : r_input( r_input_in ), c( c_in ), p_event( p_event_out ),
-                status( Parser::PS_BAD_FORMAT_NUMBER )
+                status( ParserBase::PS_BAD_FORMAT_NUMBER ),
+                flags( Event::F_PARSED ), int_magnitude( 0 ),
+                max_size( max_size_in ), is_too_long( false )
         {}
     } m;
 
 public:
-    NumberReader( ReadUTF8WithUnget & r_input_in, int c_in, Event * p_event_out )
-        : m( r_input_in, c_in, p_event_out )
+    NumberReader( Tinput & r_input_in, int c_in, Event * p_event_out, size_t max_size_in = ~size_t( 0 ) )
+        : m( r_input_in, c_in, p_event_out, max_size_in )
     {
         // From RFC4627:
         // number = [ minus ] int [ frac ] [ exp ]
@@ -453,28 +2415,60 @@ public:
                 done() )
         {
             m.p_event->type = Event::T_NUMBER;
-            m.status = Parser::PS_OK;
+            m.p_event->flags = m.flags;
+            m.p_event->int_magnitude = m.int_magnitude;
+            m.p_event->float_value = m.decimal.to_double( m.p_event->value );
+            m.status = ParserBase::PS_OK;
         }
 
+        else if( m.is_too_long )
+            m.status = ParserBase::PS_MAX_NUMBER_SIZE_EXCEEDED;
+
         if( is_separator( m.c ) )
             m.r_input.unget( m.c );
     }
-    Parser::Status status() const { return m.status; }
-    operator Parser::Status() const { return status(); }
+    ParserBase::Status status() const { return m.status; }
+    operator ParserBase::Status() const { return status(); }
 
 private:
     void accept_and_get()
     {
         m.p_event->value += m.c;
+        if( m.p_event->value.size() > m.max_size )
+            m.is_too_long = true;
         m.c = m.r_input.get();
     }
 
+    bool is_digit() const
+    {
+        // Reading stops as soon as the number is too long
+        return isdigit( m.c ) && ! m.is_too_long;
+    }
+
+    void accept_int_digit_and_get()
+    {
+        const uint64_t max_div_10 = ~static_cast<uint64_t>( 0 ) / 10;
+        const unsigned int max_mod_10 = static_cast<unsigned int>( ~static_cast<uint64_t>( 0 ) % 10 );
+
+        unsigned int digit = m.c - '0';
+        if( m.int_magnitude < max_div_10 || (m.int_magnitude == max_div_10 && digit <= max_mod_10) )
+            m.int_magnitude = m.int_magnitude * 10 + digit;
+        else
+            m.flags |= Event::F_INT_OVERFLOW;
+        m.decimal.int_digit( m.c );
+        accept_and_get();
+    }
+
     bool optional_minus()
     {
         // minus = %x2D               ; -
 
         if( m.c == '-' )
+        {
+            m.flags |= Event::F_MINUS;
+            m.decimal.minus();
             accept_and_get();
+        }
         return true;
     }
 
@@ -489,8 +2483,8 @@ private:
 
         else if( m.c >= '1' && m.c <= '9' )
         {
-            while( isdigit( m.c ) )
-                accept_and_get();
+            while( is_digit() )
+                accept_int_digit_and_get();
         }
 
         else
@@ -506,19 +2500,23 @@ private:
 
         if( m.c == '.' )
         {
+            m.flags |= Event::F_FRAC;
             accept_and_get();
-            return one_or_more_digits();
+            return one_or_more_digits( &DecimalAccumulator::frac_digit );
         }
 
         return true;
     }
 
-    bool one_or_more_digits()
+    bool one_or_more_digits( void (DecimalAccumulator::*p_add_digit)( int ) )
     {
         if( ! isdigit( m.c ) )
             return false;
-        while( isdigit( m.c ) )
+        while( is_digit() )
+        {
+            (m.decimal.*p_add_digit)( m.c );
             accept_and_get();
+        }
         return true;
     }
 
@@ -531,8 +2529,9 @@ private:
 
         if( m.c == 'e' || m.c == 'E' )
         {
+            m.flags |= Event::F_EXP;
             accept_and_get();
-            if( optional_sign() && one_or_more_digits() )
+            if( optional_sign() && one_or_more_digits( &DecimalAccumulator::exp_digit ) )
                 return true;
             return false;
         }
@@ -541,6 +2540,8 @@ private:
 
     bool optional_sign()
     {
+        if( m.c == '-' )
+            m.decimal.exp_minus();
         if( m.c == '-' || m.c == '+' )
             accept_and_get();
         return true;
@@ -548,7 +2549,7 @@ private:
 
     bool done()
     {
-        return is_separator( m.c );
+        return is_separator( m.c ) && ! m.is_too_long;
     }
 };
 
@@ -648,6 +2649,34 @@ private:
 
 const int Reader::EOM = -1;
 
+int Reader::get_peeked()
+{
+    m.is_peeked = false;
+    return static_cast< unsigned char >( m.peeked );
+}
+
+size_t Reader::do_peek( const char * * pp_block_out )
+{
+    // Default implementation for classes that only implement do_get()
+    if( ! m.is_peeked )
+    {
+        int c = do_get();
+        if( c == EOM )
+            return 0;
+        m.peeked = static_cast< char >( c );
+        m.is_peeked = true;
+    }
+    *pp_block_out = &m.peeked;
+    return 1;
+}
+
+void Reader::do_consume( size_t n_bytes )
+{
+    assert( n_bytes <= 1 );
+    if( n_bytes > 0 )
+        m.is_peeked = false;
+}
+
 //----------------------------------------------------------------------------
 //                             class ReaderMemory
 //----------------------------------------------------------------------------
@@ -657,29 +2686,52 @@ ReaderMemory::ReaderMemory( const char * p_start_in, const char * p_end_in )
 {
 }
 
+void ReaderMemory::set_memory( const char * p_start_in, const char * p_end_in )
+{
+    m.p_start = m.p_now = p_start_in;
+    m.p_end = p_end_in;
+}
+
 int ReaderMemory::do_get()
 {
-    if( m.p_now < m.p_end )
-        return static_cast< unsigned char >( *m.p_now++ );
-    return EOM;
+    return get();
+}
+
+size_t ReaderMemory::do_peek( const char * * pp_block_out )
+{
+    return peek( pp_block_out );
+}
+
+void ReaderMemory::do_consume( size_t n_bytes )
+{
+    consume( n_bytes );
 }
 
 void ReaderMemory::do_rewind()
 {
-    m.p_now = m.p_start;
+    rewind();
+}
+
+bool ReaderMemory::do_has_stable_blocks() const
+{
+    return has_stable_blocks();
 }
 
 //----------------------------------------------------------------------------
 //                             class ReaderFile
 //----------------------------------------------------------------------------
 
-ReaderFile::ReaderFile( const char * p_file_name_in )
-    : m( fopen( p_file_name_in, "r" ) )
+ReaderFile::ReaderFile( const char * p_file_name_in, size_t block_size_in )
+    : m( fopen( p_file_name_in, "r" ), block_size_in )
 {
+    // We do our own buffering in block sized reads, so stdio's buffer would
+    // only add an extra copy
+    if( is_open() )
+        setvbuf( m.h_fin, 0, _IONBF, 0 );
 }
 
-ReaderFile::ReaderFile( FILE * h_fin_in )
-    : m( h_fin_in )
+ReaderFile::ReaderFile( FILE * h_fin_in, size_t block_size_in )
+    : m( h_fin_in, block_size_in )
 {
 }
 
@@ -689,18 +2741,40 @@ ReaderFile::~ReaderFile()
         fclose( m.h_fin );
 }
 
-int ReaderFile::do_get()
+bool ReaderFile::fill_buffer()
 {
     if( ! is_open() )
+        return false;
+    size_t n_read = fread( &m.buffer[0], 1, m.buffer.size(), m.h_fin );
+    m.p_now = &m.buffer[0];
+    m.p_end = m.p_now + n_read;
+    return n_read > 0;
+}
+
+int ReaderFile::do_get()
+{
+    if( m.p_now == m.p_end && ! fill_buffer() )
         return EOM;
-    int c = fgetc( m.h_fin );
-    if( c == EOF )
-        return EOM;
-    return c;
+    return static_cast< unsigned char >( *m.p_now++ );
+}
+
+size_t ReaderFile::do_peek( const char * * pp_block_out )
+{
+    if( m.p_now == m.p_end )
+        fill_buffer();
+    *pp_block_out = m.p_now;
+    return m.p_end - m.p_now;
+}
+
+void ReaderFile::do_consume( size_t n_bytes )
+{
+    assert( n_bytes <= static_cast< size_t >( m.p_end - m.p_now ) );
+    m.p_now += n_bytes;
 }
 
 void ReaderFile::do_rewind()
 {
+    m.p_now = m.p_end = 0;
     if( is_open() )
         fseek( m.h_fin, 0, SEEK_SET );
 }
@@ -710,11 +2784,360 @@ void ReaderFile::close_on_destruct( bool is_close_on_destruct_required )
     m.is_close_on_destruct_required = is_close_on_destruct_required;
 }
 
+//----------------------------------------------------------------------------
+//                             class ReaderMmap
+//----------------------------------------------------------------------------
+
+ReaderMmap::ReaderMmap( const char * p_file_name_in )
+{
+    m.is_open = map( p_file_name_in );
+    if( m.p_mapping )
+        set_memory( static_cast< const char * >( m.p_mapping ),
+                    static_cast< const char * >( m.p_mapping ) + m.mapping_size );
+}
+
+ReaderMmap::~ReaderMmap()
+{
+    unmap();
+}
+
+#if defined( _WIN32 )
+
+bool ReaderMmap::map( const char * p_file_name_in )
+{
+    HANDLE h_file = CreateFileA( p_file_name_in, GENERIC_READ, FILE_SHARE_READ, NULL,
+                                    OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL );
+    if( h_file == INVALID_HANDLE_VALUE )
+        return false;
+
+    LARGE_INTEGER file_size;
+    if( ! GetFileSizeEx( h_file, &file_size ) ||
+            static_cast< unsigned long long >( file_size.QuadPart ) > static_cast< size_t >( -1 ) )
+    {
+        CloseHandle( h_file );
+        return false;
+    }
+
+    if( file_size.QuadPart == 0 )   // Can't map an empty file
+    {
+        CloseHandle( h_file );
+        return true;
+    }
+
+    // The view remains valid after the file and mapping handles are closed
+    HANDLE h_mapping = CreateFileMappingA( h_file, NULL, PAGE_READONLY, 0, 0, NULL );
+    CloseHandle( h_file );
+    if( h_mapping == NULL )
+        return false;
+
+    m.p_mapping = MapViewOfFile( h_mapping, FILE_MAP_READ, 0, 0, 0 );
+    CloseHandle( h_mapping );
+    if( m.p_mapping == NULL )
+        return false;
+
+    m.mapping_size = static_cast< size_t >( file_size.QuadPart );
+    return true;
+}
+
+void ReaderMmap::unmap()
+{
+    if( m.p_mapping )
+        UnmapViewOfFile( m.p_mapping );
+    m.p_mapping = 0;
+}
+
+#else
+
+bool ReaderMmap::map( const char * p_file_name_in )
+{
+    int fd = open( p_file_name_in, O_RDONLY );
+    if( fd < 0 )
+        return false;
+
+    struct stat file_status;
+    if( fstat( fd, &file_status ) != 0 ||
+            static_cast< unsigned long long >( file_status.st_size ) > static_cast< size_t >( -1 ) )
+    {
+        close( fd );
+        return false;
+    }
+
+    if( file_status.st_size == 0 )  // Can't map an empty file
+    {
+        close( fd );
+        return true;
+    }
+
+    // The mapping remains valid after the file is closed
+    size_t mapping_size = static_cast< size_t >( file_status.st_size );
+    void * p_mapping = mmap( 0, mapping_size, PROT_READ, MAP_PRIVATE, fd, 0 );
+    close( fd );
+    if( p_mapping == MAP_FAILED )
+        return false;
+
+    madvise( p_mapping, mapping_size, MADV_SEQUENTIAL );
+
+    m.p_mapping = p_mapping;
+    m.mapping_size = mapping_size;
+    return true;
+}
+
+void ReaderMmap::unmap()
+{
+    if( m.p_mapping )
+        munmap( m.p_mapping, m.mapping_size );
+    m.p_mapping = 0;
+}
+
+#endif
+
+//----------------------------------------------------------------------------
+//                             class ReaderFeed
+//----------------------------------------------------------------------------
+
+ReaderFeed::ReaderFeed( size_t block_size_in )
+    : m( block_size_in )
+{
+}
+
+void ReaderFeed::feed( const char * p_bytes, size_t n_bytes )
+{
+    assert( ! m.is_finished );
+
+    while( n_bytes > 0 )
+    {
+        if( m.chunks.empty() || m.chunks.back().size() == m.chunks.back().capacity() )
+        {
+            m.chunks.push_back( std::vector< char >() );
+            m.chunks.back().swap( m.spare_chunk );
+            m.chunks.back().reserve( std::max( m.block_size, n_bytes ) );
+        }
+
+        // Appending within the capacity doesn't move blocks already offered
+        std::vector< char > & r_chunk = m.chunks.back();
+        size_t n_copied = std::min( n_bytes, r_chunk.capacity() - r_chunk.size() );
+        r_chunk.insert( r_chunk.end(), p_bytes, p_bytes + n_copied );
+        scan( p_bytes, n_copied );
+        m.n_fed += n_copied;
+        p_bytes += n_copied;
+        n_bytes -= n_copied;
+    }
+}
+
+void ReaderFeed::finish()
+{
+    m.is_finished = true;
+    offer_to( m.n_fed );
+}
+
+void ReaderFeed::scan( const char * p_bytes, size_t n_bytes )
+{
+    // Follows the input a byte at a time, noting where each event ends.  The
+    // state is kept between calls, so tokens can be split between feeds.
+    // Scalars end at the same separators as the parser reads them to.  Only
+    // well-formed input needs to be followed exactly, as the parser reports
+    // an error at or before the end of the first malformed token.  The
+    // exception is a string with a bad \u escape, which the parser may read
+    // past the quote the scan takes as its end.
+
+    static const char c_bom[] = "\xef\xbb\xbf";
+
+    for( size_t i = 0; i < n_bytes; ++i )
+    {
+        int c = static_cast< unsigned char >( p_bytes[i] );
+        size_t offset = m.n_fed + i;
+
+        switch( m.state )
+        {
+        case S_STRING:
+            // Most of a string needs no attention
+            while( i < n_bytes && p_bytes[i] != '"' && p_bytes[i] != '\\' )
+                ++i;
+            if( i == n_bytes )
+                return;
+            if( p_bytes[i] == '\\' )
+                m.state = S_STRING_ESCAPE;
+            else
+                end_string( m.n_fed + i );
+            continue;
+
+        case S_STRING_ESCAPE:
+            m.state = S_STRING;
+            if( c == 'u' )
+            {
+                m.state = S_STRING_UNICODE;
+                m.escape_code = 0;
+                m.n_escape_digits = 0;
+            }
+            continue;
+
+        case S_STRING_UNICODE:
+            {
+            // The parser drops a character that ends a \u escape early,
+            // unless it is a quote.  A dropped backslash no longer escapes
+            // the character after it, so the string's end can't be found.
+            HexAccumulator digit;
+            if( digit.accumulate( c ) )
+            {
+                m.escape_code = m.escape_code * 16 + digit.code_point();
+                if( ++m.n_escape_digits == 4 )
+                    m.state = is_high_surrogate( m.escape_code ) ? S_STRING_SURROGATE : S_STRING;
+            }
+            else if( c == '"' )
+                end_string( offset );
+            else if( c == '\\' )
+            {
+                m.state = S_NOT_FOLLOWED;
+                return;
+            }
+            else
+                m.state = S_STRING;
+            }
+            continue;
+
+        case S_STRING_SURROGATE:
+            // The parser drops the character after a high surrogate unless
+            // it starts another escape
+            if( c == '"' )
+            {
+                m.state = S_NOT_FOLLOWED;
+                return;
+            }
+            m.state = c == '\\' ? S_STRING_ESCAPE : S_STRING;
+            continue;
+
+        case S_NOT_FOLLOWED:
+            return;
+
+        case S_SCALAR:
+            while( i < n_bytes && ! is_separator( static_cast< unsigned char >( p_bytes[i] ) ) )
+                ++i;
+            if( i == n_bytes )
+                return;
+            c = static_cast< unsigned char >( p_bytes[i] );
+            offset = m.n_fed + i;
+            offer_to( offset );
+            m.state = S_BETWEEN;
+        break;
+
+        case S_BETWEEN:
+        break;
+        }
+
+        // Between tokens
+        if( isspace( c ) )
+            continue;
+
+        bool is_name_next = false;
+        if( offset == m.bom_size && m.bom_size < 3 && p_bytes[i] == c_bom[m.bom_size] )
+        {
+            ++m.bom_size;
+            continue;
+        }
+        else if( c == '"' )
+        {
+            m.state = S_STRING;
+            m.is_name = m.is_name_next;
+        }
+        else if( c == '{' || c == '[' )
+        {
+            m.containers.push_back( static_cast< char >( c ) );
+            is_name_next = c == '{';
+            offer_to( offset + 1 );
+        }
+        else if( c == '}' || c == ']' )
+        {
+            if( ! m.containers.empty() )
+                m.containers.pop_back();
+            offer_to( offset + 1 );
+        }
+        else if( c == ',' )
+            is_name_next = ! m.containers.empty() && m.containers.back() == '{';
+        else if( c != ':' )
+            m.state = S_SCALAR;
+        m.is_name_next = is_name_next;
+    }
+}
+
+void ReaderFeed::end_string( size_t offset )
+{
+    // offset is that of the closing quote
+    m.state = S_BETWEEN;
+    if( ! m.is_name )   // A name is part of its member's event
+        offer_to( offset + 1 );
+}
+
+int ReaderFeed::do_get()
+{
+    const char * p_block = 0;
+    if( do_peek( &p_block ) == 0 )
+        return EOM;
+    ++m.n_read;
+    return static_cast< unsigned char >( *p_block );
+}
+
+size_t ReaderFeed::do_peek( const char * * pp_block_out )
+{
+    // The block of the previous peek() is no longer in use, so chunks that
+    // have been read can be reused
+    while( ! m.chunks.empty() && m.n_read == m.front_offset + m.chunks.front().size() )
+    {
+        m.front_offset += m.chunks.front().size();
+        if( m.chunks.size() == 1 )
+        {
+            m.chunks.front().clear();
+            break;
+        }
+        m.spare_chunk.swap( m.chunks.front() );
+        m.spare_chunk.clear();
+        m.chunks.pop_front();
+    }
+
+    if( m.n_offered == m.n_read )
+        return 0;
+
+    std::vector< char > & r_chunk = m.chunks.front();
+    size_t begin = m.n_read - m.front_offset;
+    *pp_block_out = &r_chunk[begin];
+    return std::min( r_chunk.size(), m.n_offered - m.front_offset ) - begin;
+}
+
+void ReaderFeed::do_consume( size_t n_bytes )
+{
+    assert( n_bytes <= m.n_offered - m.n_read );
+    m.n_read += n_bytes;
+}
+
+void ReaderFeed::do_rewind()
+{
+    m = Members( m.block_size );
+}
+
 //----------------------------------------------------------------------------
 //                               class ReadUTF8
 //----------------------------------------------------------------------------
 
-int ReadUTF8::get()
+ReadUTF8Base::UTF8Validators ReadUTF8Base::utf8_validator()
+{
+    return selected_utf8_validator;
+}
+
+bool ReadUTF8Base::is_utf8_validator_supported( UTF8Validators validator )
+{
+    return is_utf8_validator_available( validator );
+}
+
+bool ReadUTF8Base::use_utf8_validator( UTF8Validators validator )
+{
+    if( ! is_utf8_validator_available( validator ) )
+        return false;
+    selected_utf8_validator = validator;
+    p_find_end_of_valid_utf8 = utf8_validator_func( validator );
+    return true;
+}
+
+template< typename Treader >
+int BasicReadUTF8< Treader >::get_from_current_mode()
 {
     // Supported input combinations are JSON-8OB-16OB-32NB
     // OB = Optional BOM, MB = Mandatory BOM and NB = No BOM
@@ -752,12 +3175,7 @@ int ReadUTF8::get()
         return state_learning_utf8_or_le();
 
     case UTF8:
-        {
-        int c = m.r_reader.get();
-        if( c > 0 && c <= 0x7f )
-            return c;
-        return state_utf8_reading_non_ascii( c );
-        }
+        return state_utf8();
 
     case UTF16LE:
         return state_utf16le();
@@ -779,11 +3197,47 @@ int ReadUTF8::get()
     return in_error();
 }
 
-ReadUTF8::CharPair ReadUTF8::get_pair()
+template< typename Treader >
+int BasicReadUTF8< Treader >::get_byte_from_next_block()
+{
+    if( ! take_next_block() )
+        return Reader::EOM;
+    return static_cast< unsigned char >( *m.p_now++ );
+}
+
+template< typename Treader >
+bool BasicReadUTF8< Treader >::take_next_block()
+{
+    // Take the whole of the next block from the reader so that subsequent
+    // bytes can be read without going via the reader
+    size_t n_bytes = m.r_reader.peek( &m.p_now );
+    if( n_bytes > m.n_bytes_allowed )
+    {
+        if( m.n_bytes_allowed == 0 )
+        {
+            m.is_size_limit_exceeded = true;
+            n_bytes = 0;
+        }
+        else
+            n_bytes = m.n_bytes_allowed;
+    }
+    if( n_bytes == 0 )
+    {
+        m.p_now = m.p_end = 0;
+        return false;
+    }
+    m.n_bytes_allowed -= n_bytes;
+    m.r_reader.consume( n_bytes );
+    m.p_end = m.p_now + n_bytes;
+    return true;
+}
+
+template< typename Treader >
+ReadUTF8Base::CharPair BasicReadUTF8< Treader >::get_pair()
 {
     CharPair pair;
 
-    pair.c1 = m.r_reader.get();
+    pair.c1 = get_byte();
 
     if( pair.c1 == Reader::EOM )
     {
@@ -791,7 +3245,7 @@ ReadUTF8::CharPair ReadUTF8::get_pair()
         return pair;
     }
 
-    pair.c2 = m.r_reader.get();
+    pair.c2 = get_byte();
 
     if( pair.c2 == Reader::EOM )
     {
@@ -802,7 +3256,8 @@ ReadUTF8::CharPair ReadUTF8::get_pair()
     return pair;
 }
 
-ReadUTF8::CharQuad ReadUTF8::get_quad()
+template< typename Treader >
+ReadUTF8Base::CharQuad BasicReadUTF8< Treader >::get_quad()
 {
     CharQuad quad;
 
@@ -828,12 +3283,17 @@ ReadUTF8::CharQuad ReadUTF8::get_quad()
     return quad;
 }
 
-int ReadUTF8::state_learning()
+template< typename Treader >
+int BasicReadUTF8< Treader >::state_learning()
 {
-    int c = m.r_reader.get();
+    // Running out of input while learning isn't an encoding error.  The mode
+    // is kept so that learning can continue if a reader such as ReaderFeed
+    // later has more input.
+
+    int c = get_byte();
 
     if( c == Reader::EOM )
-        return in_error();
+        return Reader::EOM;
 
     if( c == 0 )
         return state_learning_utf16be_or_utf32be();
@@ -862,12 +3322,13 @@ int ReadUTF8::state_learning()
     return in_error();
 }
 
-int ReadUTF8::state_learning_utf8_or_le()
+template< typename Treader >
+int BasicReadUTF8< Treader >::state_learning_utf8_or_le()
 {
-    int c = m.r_reader.get();
+    int c = get_byte();
 
     if( c == Reader::EOM )
-        return in_error();
+        return Reader::EOM;
 
     if( c > 0 )
     {
@@ -910,14 +3371,15 @@ int ReadUTF8::state_learning_utf8_or_le()
     return in_error();
 }
 
-int ReadUTF8::state_expecting_utf8_with_bom()
+template< typename Treader >
+int BasicReadUTF8< Treader >::state_expecting_utf8_with_bom()
 {
-    if( m.r_reader.get() != 0xBB || m.r_reader.get() != 0xBF )  // Next two bytes must be 0xBB 0xBF
+    if( get_byte() != 0xBB || get_byte() != 0xBF )  // Next two bytes must be 0xBB 0xBF
         return in_error();
 
     m.mode = UTF8;
 
-    int c = m.r_reader.get();
+    int c = get_byte();
 
     if( c == Reader::EOM )
         return in_error();
@@ -927,12 +3389,13 @@ int ReadUTF8::state_expecting_utf8_with_bom()
     return state_utf8_reading_non_ascii( c );
 }
 
-int ReadUTF8::state_expecting_utf16le_or_utf32le_with_bom()
+template< typename Treader >
+int BasicReadUTF8< Treader >::state_expecting_utf16le_or_utf32le_with_bom()
 {
     // FF FE        -> UTF-16, little-endian
     // FF FE 00 00  -> UTF-32, little-endian
 
-    if( m.r_reader.get() != 0xFE )
+    if( get_byte() != 0xFE )
         return in_error();
 
     // FF FE 00 00  -> UTF-32, little-endian
@@ -953,14 +3416,15 @@ int ReadUTF8::state_expecting_utf16le_or_utf32le_with_bom()
     return construct_utf8_from_utf16le( pair );
 }
 
-int ReadUTF8::state_learning_utf16be_or_utf32be()
+template< typename Treader >
+int BasicReadUTF8< Treader >::state_learning_utf16be_or_utf32be()
 {
     // 00 xx -- --  UTF-16BE
     // 00 00 -- --  UTF-32BE
     // 00 00 FE FF  -> UTF-32, big-endian BOM
     //  ^ here
 
-    int c = m.r_reader.get();
+    int c = get_byte();
 
     if( c == Reader::EOM )
         return in_error();
@@ -974,11 +3438,12 @@ int ReadUTF8::state_learning_utf16be_or_utf32be()
     return state_learning_utf32be_possibly_with_bom();
 }
 
-int ReadUTF8::state_expecting_utf16be_with_bom()
+template< typename Treader >
+int BasicReadUTF8< Treader >::state_expecting_utf16be_with_bom()
 {
     // FE FF        -> UTF-16, big-endian
 
-    int c = m.r_reader.get();
+    int c = get_byte();
 
     if( c != 0xff )
         return in_error();
@@ -988,7 +3453,8 @@ int ReadUTF8::state_expecting_utf16be_with_bom()
     return state_utf16be();
 }
 
-int ReadUTF8::state_learning_utf32be_possibly_with_bom()
+template< typename Treader >
+int BasicReadUTF8< Treader >::state_learning_utf32be_possibly_with_bom()
 {
     // 00 00 -- --  UTF-32BE
     // 00 00 FE FF  -> UTF-32, big-endian BOM
@@ -1016,7 +3482,38 @@ int ReadUTF8::state_learning_utf32be_possibly_with_bom()
     return construct_utf8( code_point );
 }
 
-int ReadUTF8::state_utf8_reading_non_ascii( int c )
+template< typename Treader >
+int BasicReadUTF8< Treader >::state_utf8()
+{
+    if( validate_utf8_ahead() )
+        return static_cast< unsigned char >( *m.p_span_now++ );
+
+    // Sequence is invalid, or crosses the end of the block.  Running out of
+    // input between characters isn't an error.
+    int c = get_byte();
+    if( c == Reader::EOM || (c > 0 && c <= 0x7f) )
+        return c;
+    return state_utf8_reading_non_ascii( c );
+}
+
+template< typename Treader >
+bool BasicReadUTF8< Treader >::validate_utf8_ahead()
+{
+    if( m.p_now == m.p_end && ! take_next_block() )
+        return false;
+
+    const char * p_validate_end = m.p_end;
+    if( static_cast< size_t >( m.p_end - m.p_now ) > validation_chunk_size )
+        p_validate_end = m.p_now + validation_chunk_size;
+
+    m.p_span_now = m.p_now;
+    m.p_span_end = m.p_now = find_end_of_valid_utf8( m.p_now, p_validate_end );
+
+    return m.p_span_now < m.p_span_end;
+}
+
+template< typename Treader >
+int BasicReadUTF8< Treader >::state_utf8_reading_non_ascii( int c )
 {
     if( c == Reader::EOM )
         return in_error();
@@ -1045,7 +3542,7 @@ int ReadUTF8::state_utf8_reading_non_ascii( int c )
 
     for( size_t i=0; i<n_to_read; ++i )
     {
-        c = m.r_reader.get();
+        c = get_byte();
         if( c < 0x80 || c > 0xbf )
             return in_error();
         m.utf8_buffer[i+1] = c;
@@ -1055,7 +3552,7 @@ int ReadUTF8::state_utf8_reading_non_ascii( int c )
     int c1 = m.utf8_buffer[0];
     int c2 = m.utf8_buffer[1];
 
-    if( c1 == 0xef && c2 == 0xbe && ( m.utf8_buffer[2] == 0xbe || m.utf8_buffer[2] == 0xbf ) ) // U+FFFE & U+FFFF are illegal
+    if( c1 == 0xef && c2 == 0xbf && ( m.utf8_buffer[2] == 0xbe || m.utf8_buffer[2] == 0xbf ) ) // U+FFFE & U+FFFF are illegal
         return in_error();
 
     // From RFC 3629 - Make sure sequence is valid (e.g. doesn't encode a surrogate etc.)
@@ -1085,8 +3582,32 @@ int ReadUTF8::state_utf8_reading_non_ascii( int c )
     return in_error();
 }
 
-int ReadUTF8::state_utf16le()
+template< typename Treader >
+bool BasicReadUTF8< Treader >::transcode_ahead()
 {
+    if( m.p_now == m.p_end && ! take_next_block() )
+        return false;
+
+    if( m.transcode_buffer.empty() )
+        m.transcode_buffer.resize( transcode_buffer_size );
+
+    char * p_transcoded = &m.transcode_buffer[0];
+    size_t n_transcoded = 0;
+    m.p_now += transcode_to_utf8( m.mode, m.p_now, m.p_end,
+                                p_transcoded, m.transcode_buffer.size(), &n_transcoded );
+    m.p_span_now = p_transcoded;
+    m.p_span_end = p_transcoded + n_transcoded;
+
+    return n_transcoded > 0;
+}
+
+template< typename Treader >
+int BasicReadUTF8< Treader >::state_utf16le()
+{
+    if( transcode_ahead() )
+        return static_cast< unsigned char >( *m.p_span_now++ );
+
+    // Code unit is invalid, or crosses the end of the block
     CharPair pair = get_pair();
 
     if( pair.is_eom() )
@@ -1095,7 +3616,8 @@ int ReadUTF8::state_utf16le()
     return construct_utf8_from_utf16le( pair );
 }
 
-int ReadUTF8::construct_utf8_from_utf16le( CharPair pair )
+template< typename Treader >
+int BasicReadUTF8< Treader >::construct_utf8_from_utf16le( CharPair pair )
 {
     int code_point = pair.to_little_endian_code_point();
 
@@ -1115,8 +3637,13 @@ int ReadUTF8::construct_utf8_from_utf16le( CharPair pair )
     return construct_utf8( code_point );
 }
 
-int ReadUTF8::state_utf16be()
+template< typename Treader >
+int BasicReadUTF8< Treader >::state_utf16be()
 {
+    if( transcode_ahead() )
+        return static_cast< unsigned char >( *m.p_span_now++ );
+
+    // Code unit is invalid, or crosses the end of the block
     CharPair pair = get_pair();
 
     if( pair.is_eom() )
@@ -1125,7 +3652,8 @@ int ReadUTF8::state_utf16be()
     return construct_utf8_from_utf16be( pair );
 }
 
-int ReadUTF8::construct_utf8_from_utf16be( CharPair pair )
+template< typename Treader >
+int BasicReadUTF8< Treader >::construct_utf8_from_utf16be( CharPair pair )
 {
     int code_point = pair.to_big_endian_code_point();
 
@@ -1145,8 +3673,13 @@ int ReadUTF8::construct_utf8_from_utf16be( CharPair pair )
     return construct_utf8( code_point );
 }
 
-int ReadUTF8::state_utf32le()
+template< typename Treader >
+int BasicReadUTF8< Treader >::state_utf32le()
 {
+    if( transcode_ahead() )
+        return static_cast< unsigned char >( *m.p_span_now++ );
+
+    // Code unit is invalid, or crosses the end of the block
     CharQuad quad = get_quad();
 
     if( quad.is_eom() )
@@ -1159,8 +3692,13 @@ int ReadUTF8::state_utf32le()
     return construct_utf8( code_point );
 }
 
-int ReadUTF8::state_utf32be()
+template< typename Treader >
+int BasicReadUTF8< Treader >::state_utf32be()
 {
+    if( transcode_ahead() )
+        return static_cast< unsigned char >( *m.p_span_now++ );
+
+    // Code unit is invalid, or crosses the end of the block
     CharQuad quad = get_quad();
 
     if( quad.is_eom() )
@@ -1173,25 +3711,90 @@ int ReadUTF8::state_utf32be()
     return construct_utf8( code_point );
 }
 
-int ReadUTF8::construct_utf8( int code_point )
+template< typename Treader >
+int BasicReadUTF8< Treader >::construct_utf8( int code_point )
 {
+    if( code_point == 0 )   // NUL is rejected, as it is in UTF-8 input
+        return in_error();
+    if( code_point < 0 || code_point > 0x10ffff )   // Out of range UTF-32
+        return in_error();
+
     UTF8Sequence( code_point ).copy_to_array( m.utf8_buffer );
     m.p_utf8_buffer = &(m.utf8_buffer[1]);
     return m.utf8_buffer[0];
 }
 
-void ReadUTF8::rewind()
+template< typename Treader >
+void BasicReadUTF8< Treader >::rewind()
 {
     m.r_reader.rewind();
     m.mode = LEARNING;
     m.p_utf8_buffer = 0;
+    m.p_now = m.p_end = m.p_span_now = m.p_span_end = 0;
+    m.n_bytes_allowed = m.max_size;
+    m.is_size_limit_exceeded = false;
+}
+
+template< typename Treader >
+void BasicReadUTF8< Treader >::limit_size( size_t max_size )
+{
+    // Bytes already taken from the reader but not yet read count towards
+    // the limit
+    size_t n_taken = (m.p_end - m.p_now) + (m.p_span_end - m.p_span_now);
+    m.max_size = max_size;
+    m.n_bytes_allowed = max_size > n_taken ? max_size - n_taken : 0;
+    m.is_size_limit_exceeded = false;
+}
+
+//----------------------------------------------------------------------------
+//                           class StructuralIndex
+//----------------------------------------------------------------------------
+
+void StructuralIndex::build( const char * p_begin_in, const char * p_end_in )
+{
+    m.positions.clear();
+    m.p_begin = m.p_end = 0;
+
+    if( static_cast< uint64_t >( p_end_in - p_begin_in ) >= 0xffffffffull )
+        return;     // Positions wouldn't fit in 32 bits
+
+    m.p_begin = p_begin_in;
+    m.p_end = p_end_in;
+
+    // Typical JSON has a position to index every 4 or 5 bytes.  Allocating
+    // enough for that up front avoids repeatedly growing the vector.
+    m.positions.resize( (p_end_in - p_begin_in) / 4 + 64 );
+
+    StructuralIndexer indexer( &m.positions );
+    const unsigned char * p = reinterpret_cast< const unsigned char * >( p_begin_in );
+    const unsigned char * p_end = reinterpret_cast< const unsigned char * >( p_end_in );
+    uint32_t offset = 0;
+
+    for( ; p_end - p >= 64; p += 64, offset += 64 )
+        indexer.add_block( p, offset );
+
+    if( p < p_end )
+    {
+        unsigned char last_block[64];
+        memset( last_block, ' ', sizeof( last_block ) );
+        memcpy( last_block, p, p_end - p );
+        indexer.add_block( last_block, offset, p_end - p );
+    }
+
+    indexer.finish();
+}
+
+size_t StructuralIndex::find_cursor( uint32_t offset ) const
+{
+    return std::lower_bound( m.positions.begin(), m.positions.end(), offset ) - m.positions.begin();
 }
 
 //----------------------------------------------------------------------------
 //                           class ReadUTF8WithUnget
 //----------------------------------------------------------------------------
 
-int ReadUTF8WithUnget::get()
+template< typename Treader >
+int BasicReadUTF8WithUnget< Treader >::get()
 {
     if( ! m.unget_buffer.empty() )
     {
@@ -1204,21 +3807,46 @@ int ReadUTF8WithUnget::get()
 }
 
 
-int ReadUTF8WithUnget::get_non_ws()
+template< typename Treader >
+int BasicReadUTF8WithUnget< Treader >::get_non_ws()
 {
     int c = get();
-    while( isspace( c ) )
+    for( size_t n_ws = 0; isspace( c ); ++n_ws )
+    {
+        // Within a run of whitespace (e.g. indentation) the next indexed
+        // position is the next non-whitespace character.  Single spaces
+        // are quicker to step over.
+        if( n_ws > 0 )
+        {
+            const char * p_stop = span_next_stop();
+            if( p_stop )
+                span_advance_to( p_stop );
+        }
         c = get();
+    }
     return c;
 }
 
-void ReadUTF8WithUnget::unget( int c )
+template< typename Treader >
+const char * BasicReadUTF8WithUnget< Treader >::span_next_stop()
+{
+    const char * p_begin = span_begin();
+    const char * p_end = span_end();
+    if( ! m.p_index || p_begin == p_end || ! m.p_index->is_indexed( p_begin ) )
+        return 0;
+    return std::min( m.p_index->next_stop( p_begin, &m.index_cursor ), p_end );
+}
+
+template< typename Treader >
+void BasicReadUTF8WithUnget< Treader >::unget( int c )
 {
     m.unget_buffer.push( c );
 }
 
-void ReadUTF8WithUnget::rewind()
+template< typename Treader >
+void BasicReadUTF8WithUnget< Treader >::rewind()
 {
+    m.index_cursor = 0;
     return m.read_utf8.rewind();
 }
 
@@ -1226,10 +3854,76 @@ void ReadUTF8WithUnget::rewind()
 //                             class Event
 //----------------------------------------------------------------------------
 
-bool Event::is_int() const
+namespace {
+
+void read_int_magnitude( const std::string & r_value, unsigned int * p_flags_out, uint64_t * p_magnitude_out )
+{
+    // For events not set by the parser.  Records the same details of the
+    // number as NumberReader does
+
+    const uint64_t max_div_10 = ~static_cast<uint64_t>( 0 ) / 10;
+    const unsigned int max_mod_10 = static_cast<unsigned int>( ~static_cast<uint64_t>( 0 ) % 10 );
+
+    unsigned int flags = Event::F_PARSED;
+    uint64_t magnitude = 0;
+
+    std::string::const_iterator i( r_value.begin() );
+    if( i != r_value.end() && *i == '-' )
+    {
+        flags |= Event::F_MINUS;
+        ++i;
+    }
+    for( ; i != r_value.end() && isdigit( *i ); ++i )
+    {
+        unsigned int digit = *i - '0';
+        if( magnitude < max_div_10 || (magnitude == max_div_10 && digit <= max_mod_10) )
+            magnitude = magnitude * 10 + digit;
+        else
+            flags |= Event::F_INT_OVERFLOW;
+    }
+    if( i != r_value.end() )
+        flags |= Event::F_FRAC;     // Or F_EXP, but either means it's not an integer
+
+    *p_flags_out = flags;
+    *p_magnitude_out = magnitude;
+}
+
+int64_t float_to_int64( double value )
+{
+    if( value >= 9223372036854775808.0 )     // 2^63
+        return std::numeric_limits< int64_t >::max();
+    if( value <= -9223372036854775808.0 )
+        return std::numeric_limits< int64_t >::min();
+    if( value != value )                    // NaN
+        return 0;
+    return static_cast<int64_t>( value );
+}
+
+uint64_t float_to_uint64( double value )
+{
+    if( value >= 18446744073709551616.0 )    // 2^64
+        return std::numeric_limits< uint64_t >::max();
+    if( ! (value > 0.0) )                   // Including NaN
+        return 0;
+    return static_cast<uint64_t>( value );
+}
+
+template< typename Tint >
+Tint clamp_int64( int64_t value )
+{
+    if( value > static_cast<int64_t>( std::numeric_limits< Tint >::max() ) )
+        return std::numeric_limits< Tint >::max();
+    if( value < static_cast<int64_t>( std::numeric_limits< Tint >::min() ) )
+        return std::numeric_limits< Tint >::min();
+    return static_cast<Tint>( value );
+}
+
+}   // End of anonymous namespace
+
+bool Event::is_int_text() const
 {
-    // Assumes that during parsing format has been validated as a number
-    return is_number() && value.find_first_of( ".eE" ) == std::string::npos;
+    // For events not set by the parser
+    return value.find_first_of( ".eE" ) == std::string::npos;
 }
 
 bool Event::to_bool() const
@@ -1237,7 +3931,7 @@ bool Event::to_bool() const
     switch( type )
     {
     case T_BOOLEAN:
-        return value != "false";
+        return ! is_false();
     case T_STRING:
         return ! value.empty();
     case T_NUMBER:
@@ -1258,7 +3952,9 @@ double Event::to_float() const
     switch( type )
     {
     case T_NUMBER:
-        return atof( value.c_str() );
+        if( flags & F_PARSED )
+            return float_value;
+        return locale_independent_strtod( value );
     default:
         return to_bool() ? 1.0 : 0.0;
     }
@@ -1266,12 +3962,56 @@ double Event::to_float() const
 
 int Event::to_int() const
 {
-    return static_cast<int>( to_float() );
+    return clamp_int64< int >( to_int64() );
 }
 
 long Event::to_long() const
 {
-    return static_cast<long>( to_float() );
+    return clamp_int64< long >( to_int64() );
+}
+
+int64_t Event::to_int64() const
+{
+    if( type != T_NUMBER )
+        return to_bool() ? 1 : 0;
+
+    unsigned int number_flags = flags;
+    uint64_t magnitude = int_magnitude;
+    if( ! (number_flags & F_PARSED) )
+        read_int_magnitude( value, &number_flags, &magnitude );
+
+    const uint64_t max_magnitude = static_cast<uint64_t>( std::numeric_limits< int64_t >::max() );
+
+    if( number_flags & (F_FRAC | F_EXP) )
+        return float_to_int64( to_float() );
+    if( number_flags & F_MINUS )
+    {
+        if( (number_flags & F_INT_OVERFLOW) || magnitude > max_magnitude )
+            return std::numeric_limits< int64_t >::min();
+        return -static_cast<int64_t>( magnitude );
+    }
+    if( (number_flags & F_INT_OVERFLOW) || magnitude > max_magnitude )
+        return std::numeric_limits< int64_t >::max();
+    return static_cast<int64_t>( magnitude );
+}
+
+uint64_t Event::to_uint64() const
+{
+    if( type != T_NUMBER )
+        return to_bool() ? 1 : 0;
+
+    unsigned int number_flags = flags;
+    uint64_t magnitude = int_magnitude;
+    if( ! (number_flags & F_PARSED) )
+        read_int_magnitude( value, &number_flags, &magnitude );
+
+    if( number_flags & (F_FRAC | F_EXP) )
+        return float_to_uint64( to_float() );
+    if( number_flags & F_MINUS )
+        return 0;
+    if( number_flags & F_INT_OVERFLOW )
+        return std::numeric_limits< uint64_t >::max();
+    return magnitude;
 }
 
 std::wstring Event::to_wstring() const
@@ -1281,26 +4021,571 @@ std::wstring Event::to_wstring() const
     return status;
 }
 
-//----------------------------------------------------------------------------
-//                               class Parser
-//----------------------------------------------------------------------------
-
-Parser::Status Parser::get( Event * p_event_out )
+//----------------------------------------------------------------------------
+//                             class StringView
+//----------------------------------------------------------------------------
+
+bool StringView::operator == ( const StringView & r_rhs ) const
+{
+    return m.size == r_rhs.m.size && memcmp( m.p_begin, r_rhs.m.p_begin, m.size ) == 0;
+}
+
+bool StringView::operator == ( const char * p_rhs ) const
+{
+    for( size_t i = 0; i < m.size; ++i )
+        if( p_rhs[i] == '\0' || p_rhs[i] != m.p_begin[i] )
+            return false;
+    return p_rhs[m.size] == '\0';
+}
+
+//----------------------------------------------------------------------------
+//                             class EventView
+//----------------------------------------------------------------------------
+
+void EventView::to_event( Event * p_event_out ) const
+{
+    p_event_out->name.assign( name.data(), name.size() );
+    p_event_out->value.assign( value.data(), value.size() );
+    p_event_out->type = type;
+    p_event_out->flags = flags;
+    p_event_out->int_magnitude = int_magnitude;
+    p_event_out->float_value = float_value;
+    p_event_out->key = key;
+}
+
+double EventView::to_float() const
+{
+    Event event;
+    to_number_event( &event );
+    return event.to_float();
+}
+
+int64_t EventView::to_int64() const
+{
+    Event event;
+    to_number_event( &event );
+    return event.to_int64();
+}
+
+uint64_t EventView::to_uint64() const
+{
+    Event event;
+    to_number_event( &event );
+    return event.to_uint64();
+}
+
+void EventView::to_number_event( Event * p_event_out ) const
+{
+    // The conversion methods of Event only read value if flags is 0, or if
+    // the event isn't a number
+    if( type != Event::T_NUMBER || ! (flags & Event::F_PARSED) )
+    {
+        to_event( p_event_out );
+        return;
+    }
+    p_event_out->type = type;
+    p_event_out->flags = flags;
+    p_event_out->int_magnitude = int_magnitude;
+    p_event_out->float_value = float_value;
+}
+
+//----------------------------------------------------------------------------
+//                             class Projection
+//----------------------------------------------------------------------------
+
+namespace {
+
+inline bool is_wildcard( const std::string & r_segment )
+{
+    return r_segment.size() == 1 && r_segment[0] == '*';
+}
+
+inline bool is_array_index( const std::string & r_segment )
+{
+    // array-index = %x30 / ( %x31-39 *(%x30-39) )
+    if( r_segment.empty() || (r_segment[0] == '0' && r_segment.size() > 1) )
+        return false;
+    for( size_t i = 0; i < r_segment.size(); ++i )
+        if( r_segment[i] < '0' || r_segment[i] > '9' )
+            return false;
+    return true;
+}
+
+inline uint32_t transition_hash( Projection::State state, const char * p_name, size_t name_size )
+{
+    // FNV-1a, starting with the state
+    uint32_t hash = (2166136261u ^ state) * 16777619u;
+    for( size_t i = 0; i < name_size; ++i )
+        hash = (hash ^ static_cast< unsigned char >( p_name[i] )) * 16777619u;
+    return hash;
+}
+
+}   // End of anonymous namespace
+
+struct Projection::Builder
+{
+    // Builds the automaton by subset construction.  Each state stands for
+    // the set of trie nodes that the member names and array indices read so
+    // far lead to.  A set that includes the end of a path is s_selected,
+    // and the empty set is s_none.
+
+    const std::vector< Node > & r_nodes;
+    Automaton & r_automaton;
+    std::map< std::vector< size_t >, State > state_ids;
+    std::vector< std::vector< size_t > > state_nodes;   // Indexed by state
+    size_t n_transitions;
+
+    Builder( const Projection & r_projection )
+        : r_nodes( r_projection.m.nodes ), r_automaton( r_projection.m.automaton ), state_nodes( 2 ), n_transitions( 0 )
+    {}
+
+    void build()
+    {
+        r_automaton.states.clear();
+        r_automaton.transitions.clear();
+        r_automaton.names.clear();
+        add_state_info( s_none );
+        add_state_info( s_selected );
+
+        r_automaton.start = state_for( std::vector< size_t >( 1, 0 ) );
+        for( size_t state = 2; state < state_nodes.size(); ++state )
+            add_transitions( static_cast< State >( state ) );
+
+        r_automaton.is_built = true;
+    }
+
+    void add_state_info( State other )
+    {
+        StateInfo info = { other, false };
+        r_automaton.states.push_back( info );
+    }
+
+    State state_for( std::vector< size_t > nodes )
+    {
+        for( size_t i = 0; i < nodes.size(); ++i )
+            if( r_nodes[nodes[i]].is_path_end )
+                return s_selected;
+
+        // Only the root of an empty trie leads nowhere
+        if( nodes.empty() || (r_nodes[0].children.empty() && ! r_nodes[0].wildcard_child) )
+            return s_none;
+
+        std::sort( nodes.begin(), nodes.end() );
+        nodes.erase( std::unique( nodes.begin(), nodes.end() ), nodes.end() );
+
+        std::map< std::vector< size_t >, State >::const_iterator i_found = state_ids.find( nodes );
+        if( i_found != state_ids.end() )
+            return i_found->second;
+
+        State state = static_cast< State >( state_nodes.size() );
+        state_ids[nodes] = state;
+        state_nodes.push_back( nodes );
+        add_state_info( s_none );
+        return state;
+    }
+
+    void add_transitions( State state )
+    {
+        // Any name leads to the wildcard children.  Names that some of the
+        // nodes have children for also lead to those children.
+
+        std::vector< size_t > nodes = state_nodes[state];
+        std::vector< size_t > wildcard_nodes;
+        std::map< std::string, std::vector< size_t > > named_nodes;
+        for( size_t i = 0; i < nodes.size(); ++i )
+        {
+            const Node & r_node = r_nodes[nodes[i]];
+            if( r_node.wildcard_child )
+                wildcard_nodes.push_back( r_node.wildcard_child );
+            for( size_t j = 0; j < r_node.children.size(); ++j )
+                named_nodes[r_node.children[j].first].push_back( r_node.children[j].second );
+        }
+
+        State other = state_for( wildcard_nodes );
+        r_automaton.states[state].other = other;
+
+        for( std::map< std::string, std::vector< size_t > >::iterator i_named = named_nodes.begin();
+                i_named != named_nodes.end();
+                ++i_named )
+        {
+            std::vector< size_t > & r_targets = i_named->second;
+            r_targets.insert( r_targets.end(), wildcard_nodes.begin(), wildcard_nodes.end() );
+            State to = state_for( r_targets );
+            if( to != other )
+            {
+                add_transition( state, i_named->first, to );
+                if( is_array_index( i_named->first ) )
+                    r_automaton.states[state].has_index_names = true;
+            }
+        }
+    }
+
+    void add_transition( State from, const std::string & r_name, State to )
+    {
+        // Kept at most half full
+        if( ++n_transitions * 2 > r_automaton.transitions.size() )
+            grow_table();
+
+        Transition transition = { from, to, static_cast< uint32_t >( r_automaton.names.size() ),
+                                    static_cast< uint32_t >( r_name.size() ) };
+        r_automaton.names += r_name;
+        insert( transition );
+    }
+
+    void grow_table()
+    {
+        std::vector< Transition > old_table;
+        old_table.swap( r_automaton.transitions );
+        Transition unused = { s_none, s_none, 0, 0 };
+        r_automaton.transitions.assign( std::max( old_table.size() * 2, size_t( 16 ) ), unused );
+        for( size_t i = 0; i < old_table.size(); ++i )
+            if( old_table[i].to != s_none )
+                insert( old_table[i] );
+    }
+
+    void insert( const Transition & r_transition )
+    {
+        std::vector< Transition > & r_table = r_automaton.transitions;
+        size_t mask = r_table.size() - 1;
+        size_t i = transition_hash( r_transition.from, r_automaton.names.data() + r_transition.name_offset,
+                                    r_transition.name_size ) & mask;
+        while( r_table[i].to != s_none )
+            i = (i + 1) & mask;
+        r_table[i] = r_transition;
+    }
+};
+
+bool Projection::add( const std::string & r_path )
+{
+    // json-pointer = *( "/" reference-token )
+    // reference-token = *( unescaped / escaped )
+    // escaped = "~" ( "0" / "1" )
+
+    if( ! r_path.empty() && r_path[0] != '/' )
+        return false;
+
+    std::vector< std::string > segments;
+    for( size_t i = 0; i < r_path.size(); ++i )
+    {
+        if( r_path[i] == '/' )
+            segments.push_back( std::string() );
+        else if( r_path[i] != '~' )
+            segments.back() += r_path[i];
+        else if( i + 1 < r_path.size() && (r_path[i + 1] == '0' || r_path[i + 1] == '1') )
+            segments.back() += r_path[++i] == '0' ? '~' : '/';
+        else
+            return false;
+    }
+
+    // Node indices are used as nodes may move as the trie grows
+    size_t node = 0;
+    for( size_t i = 0; i < segments.size(); ++i )
+    {
+        size_t child = 0;
+        if( is_wildcard( segments[i] ) )
+            child = m.nodes[node].wildcard_child;
+        else
+            for( size_t j = 0; j < m.nodes[node].children.size() && ! child; ++j )
+                if( m.nodes[node].children[j].first == segments[i] )
+                    child = m.nodes[node].children[j].second;
+
+        if( ! child )
+        {
+            child = m.nodes.size();
+            m.nodes.push_back( Node() );
+            if( is_wildcard( segments[i] ) )
+                m.nodes[node].wildcard_child = child;
+            else
+                m.nodes[node].children.push_back( std::make_pair( segments[i], child ) );
+        }
+        node = child;
+    }
+
+    m.nodes[node].is_path_end = true;
+    ++m.n_paths;
+    m.automaton = Automaton();
+    return true;
+}
+
+void Projection::clear()
+{
+    m.nodes.assign( 1, Node() );
+    m.n_paths = 0;
+    m.automaton = Automaton();
+}
+
+void Projection::compile() const
+{
+    if( ! m.automaton.is_built )
+        build();
+}
+
+void Projection::build() const
+{
+    Builder( *this ).build();
+}
+
+Projection::Match Projection::match( const std::vector< std::string > & r_path ) const
+{
+    State state = start();
+    for( size_t i = 0; i < r_path.size(); ++i )
+        state = next_member( state, r_path[i].data(), r_path[i].size() );
+    return match( state );
+}
+
+Projection::State Projection::next_member( State state, const char * p_name, size_t name_size ) const
+{
+    State to = find_transition( state, p_name, name_size );
+    return to != s_none ? to : m.automaton.states[state].other;
+}
+
+Projection::State Projection::next_element( State state, size_t index ) const
+{
+    // Only states with transitions for array indices need the index as a name
+    if( ! m.automaton.states[state].has_index_names )
+        return m.automaton.states[state].other;
+
+    char c_index[24];
+    char * p_index_end = c_index + sizeof( c_index );
+    char * p_index = p_index_end;
+    do
+    {
+        *--p_index = static_cast< char >( '0' + index % 10 );
+        index /= 10;
+    }
+    while( index > 0 );
+
+    return next_member( state, p_index, p_index_end - p_index );
+}
+
+Projection::State Projection::find_transition( State state, const char * p_name, size_t name_size ) const
+{
+    const std::vector< Transition > & r_table = m.automaton.transitions;
+    if( r_table.empty() )
+        return s_none;
+
+    size_t mask = r_table.size() - 1;
+    for( size_t i = transition_hash( state, p_name, name_size ) & mask; r_table[i].to != s_none; i = (i + 1) & mask )
+    {
+        const Transition & r_transition = r_table[i];
+        if( r_transition.from == state && r_transition.name_size == name_size &&
+                memcmp( m.automaton.names.data() + r_transition.name_offset, p_name, name_size ) == 0 )
+            return r_transition.to;
+    }
+    return s_none;
+}
+
+//----------------------------------------------------------------------------
+//                               class KeySet
+//----------------------------------------------------------------------------
+
+namespace {
+
+inline uint64_t key_hash( uint32_t seed, const char * p_name, size_t name_size )
+{
+    // FNV-1a, starting with the seed
+    uint64_t hash = (14695981039346656037ull ^ seed) * 1099511628211ull;
+    for( size_t i = 0; i < name_size; ++i )
+        hash = (hash ^ static_cast< unsigned char >( p_name[i] )) * 1099511628211ull;
+    return hash;
+}
+
+inline size_t key_bucket( uint64_t hash, size_t n_buckets )
+{
+    // The top bits of the hash choose the bucket
+    return static_cast< size_t >( ((hash >> 32) * n_buckets) >> 32 );
+}
+
+inline size_t key_slot( uint64_t hash, uint32_t displacement, size_t n_slots )
+{
+    // n_slots is a power of 2.  As the step is odd, the displacements of a
+    // bucket with one name reach every slot.
+    uint32_t step = static_cast< uint32_t >( hash >> 32 ) | 1;
+    return (static_cast< uint32_t >( hash ) + displacement * step) & (n_slots - 1);
+}
+
+}   // End of anonymous namespace
+
+int KeySet::add( const std::string & r_name )
+{
+    std::map< std::string, int >::const_iterator i_key = m.keys.find( r_name );
+    if( i_key != m.keys.end() )
+        return i_key->second;
+
+    m.names.push_back( r_name );
+    int key = static_cast< int >( m.names.size() );
+    m.keys[r_name] = key;
+    m.table = Table();
+    return key;
+}
+
+void KeySet::clear()
+{
+    m.names.clear();
+    m.keys.clear();
+    m.table = Table();
+}
+
+void KeySet::compile() const
+{
+    if( ! m.table.is_built )
+        build();
+}
+
+void KeySet::build() const
+{
+    // Hash and displace: the names are hashed into buckets, and then, from
+    // the largest bucket down, a displacement is found for each bucket that
+    // puts all its names in unused slots.  If that fails another seed is
+    // tried, and after a few seeds the table is made bigger.
+
+    size_t n_slots = 1;
+    while( n_slots < m.names.size() + m.names.size() / 4 )
+        n_slots *= 2;
+
+    for( ; ; n_slots *= 2 )
+        for( uint32_t seed = 0; seed < 16; ++seed )
+        {
+            m.table.seed = seed;
+            if( try_build( n_slots ) )
+            {
+                m.table.is_built = true;
+                return;
+            }
+        }
+}
+
+bool KeySet::try_build( size_t n_slots ) const
+{
+    Table & r_table = m.table;
+    r_table.names.clear();
+    r_table.displacements.assign( std::max( m.names.size(), size_t( 1 ) ), 0 );
+    Slot unused = { 0, 0, K_UNKNOWN };
+    r_table.slots.assign( m.names.empty() ? 0 : n_slots, unused );
+
+    std::vector< uint64_t > hashes( m.names.size() );
+    std::vector< std::vector< size_t > > buckets( r_table.displacements.size() );
+    for( size_t i = 0; i < m.names.size(); ++i )
+    {
+        hashes[i] = key_hash( r_table.seed, m.names[i].data(), m.names[i].size() );
+        buckets[key_bucket( hashes[i], buckets.size() )].push_back( i );
+    }
+
+    std::vector< std::pair< size_t, size_t > > order;   // (size, bucket)
+    for( size_t b = 0; b < buckets.size(); ++b )
+        if( ! buckets[b].empty() )
+            order.push_back( std::make_pair( buckets[b].size(), b ) );
+    std::sort( order.rbegin(), order.rend() );
+
+    std::vector< size_t > placed;
+    for( size_t i = 0; i < order.size(); ++i )
+    {
+        const std::vector< size_t > & r_bucket = buckets[order[i].second];
+        bool is_placed = false;
+        for( uint32_t displacement = 0; displacement < n_slots && ! is_placed; ++displacement )
+        {
+            placed.clear();
+            for( size_t j = 0; j < r_bucket.size(); ++j )
+            {
+                size_t slot = key_slot( hashes[r_bucket[j]], displacement, n_slots );
+                if( r_table.slots[slot].key != K_UNKNOWN )
+                    break;
+                r_table.slots[slot].key = static_cast< int >( r_bucket[j] + 1 );
+                placed.push_back( slot );
+            }
+            is_placed = placed.size() == r_bucket.size();
+            if( is_placed )
+                r_table.displacements[order[i].second] = displacement;
+            else
+                for( size_t j = 0; j < placed.size(); ++j )
+                    r_table.slots[placed[j]].key = K_UNKNOWN;
+        }
+        if( ! is_placed )
+            return false;
+    }
+
+    for( size_t i = 0; i < r_table.slots.size(); ++i )
+        if( r_table.slots[i].key != K_UNKNOWN )
+        {
+            const std::string & r_name = m.names[r_table.slots[i].key - 1];
+            r_table.slots[i].name_offset = static_cast< uint32_t >( r_table.names.size() );
+            r_table.slots[i].name_size = static_cast< uint32_t >( r_name.size() );
+            r_table.names += r_name;
+        }
+    return true;
+}
+
+int KeySet::find( const char * p_name, size_t name_size ) const
+{
+    compile();
+
+    const Table & r_table = m.table;
+    if( r_table.slots.empty() )
+        return K_UNKNOWN;
+
+    uint64_t hash = key_hash( r_table.seed, p_name, name_size );
+    const Slot & r_slot = r_table.slots[key_slot( hash,
+                                r_table.displacements[key_bucket( hash, r_table.displacements.size() )],
+                                r_table.slots.size() )];
+    if( r_slot.name_size == name_size && memcmp( r_table.names.data() + r_slot.name_offset, p_name, name_size ) == 0 )
+        return r_slot.key;
+    return K_UNKNOWN;
+}
+
+//----------------------------------------------------------------------------
+//                               class Parser
+//----------------------------------------------------------------------------
+
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::get( Event * p_event_out )
+{
+    Status status = get_event( p_event_out );
+
+    // Values that aren't in the projection are skipped without an event
+    while( status == PS_OK && m.projection.is_value_skipped )
+    {
+        if( m.p_name_view )
+            *m.p_name_view = *m.p_value_view = StringView();
+        status = get_event( p_event_out );
+    }
+
+    return status;
+}
+
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::get_event( Event * p_event_out )
 {
     if( m.last_status != PS_OK )
         return PS_UNABLE_TO_CONTINUE_DUE_TO_ERRORS;
 
+    if( m.skip.is_scanning )
+    {
+        // A skipped value gives no event, so get() moves on to the next one
+        bool is_value = m.skip.is_value;
+        Status status = resume_skip_to_depth();
+        if( status != PS_OK || is_value )
+        {
+            m.projection.is_value_skipped = is_value;
+            return status;
+        }
+    }
+
     if( context() == C_DONE )
         return PS_END_OF_MESSAGE;   // "End of message" is not treated as an error.
 
     m.p_event_out =  p_event_out;
     m.p_event_out->clear();
+    m.projection.is_value_skipped = false;
 
     get_non_ws();
 
     if( m.c == Reader::EOM )
     {
-        if( context() == C_OUTER )
+        // A reader awaiting input only stops between events, so nothing of
+        // the next event has been read yet
+        if( m.input.reader().is_awaiting_input() && ! m.input.is_size_limit_exceeded() )
+            return PS_NEED_MORE_INPUT;
+        if( context() == C_OUTER && ! m.input.is_size_limit_exceeded() )
             return (m.last_status = PS_END_OF_MESSAGE);
         return report_error( PS_UNEXPECTED_END_OF_MESSAGE );
     }
@@ -1330,33 +4615,334 @@ Parser::Status Parser::get( Event * p_event_out )
     return report_error( PS_UNDOCUMENTED_FAIL );
 }
 
-Parser::Status Parser::skip()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::get( EventView * p_event_out )
+{
+    struct ViewTargets  // Ensures the targets are reset even if an exception is thrown
+    {
+        Members & r_m;
+        ViewTargets( Members & r_m_in, EventView * p_event_out ) : r_m( r_m_in )
+        {
+            r_m.p_name_view = &p_event_out->name;
+            r_m.p_value_view = &p_event_out->value;
+        }
+        ~ViewTargets() { r_m.p_name_view = r_m.p_value_view = 0; }
+    };
+
+    p_event_out->clear();
+
+    Status status;
+    {
+    ViewTargets view_targets( m, p_event_out );
+    status = get( &m.view_event );
+    }
+
+    // Anything not viewed directly in the input was read into view_event
+    p_event_out->type = m.view_event.type;
+    p_event_out->flags = m.view_event.flags;
+    p_event_out->int_magnitude = m.view_event.int_magnitude;
+    p_event_out->float_value = m.view_event.float_value;
+    p_event_out->key = m.view_event.key;
+    if( ! m.view_event.name.empty() )
+        p_event_out->name = StringView( m.view_event.name );
+    if( ! m.view_event.value.empty() )
+        p_event_out->value = StringView( m.view_event.value );
+
+    return status;
+}
+
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::skip()
+{
+    // Once inside an object or array, the rest of it is skipped by looking
+    // only at the brackets, and at the quotes and escapes that show where
+    // strings are, rather than by generating events.  The UTF-8 is still
+    // validated, but the format of names and values isn't checked.  A
+    // StructuralIndex isn't used, as it records more positions (such as the
+    // start of every value) than need looking at here.
+    //
+    // A skip that returned PS_NEED_MORE_INPUT is carried on from where it
+    // stopped.
+
+    if( m.last_status != PS_OK )
+        return skip_events( m.context_stack.size() - 1 );
+
+    if( m.skip.is_by_events )
+    {
+        m.skip.is_by_events = false;
+        return skip_events( m.skip.events_depth );
+    }
+
+    if( m.skip.is_scanning )
+    {
+        // After a value skipped by the projection, the rest of the object or
+        // array it was in is skipped too
+        bool is_value = m.skip.is_value;
+        Status status = resume_skip_to_depth();
+        if( status != PS_OK || ! is_value )
+            return status;
+    }
+
+    if( m.context_stack.size() == 1 )
+        return skip_events( m.context_stack.size() - 1 );
+
+    return skip_to_depth( m.context_stack.size() - 1, false, false );
+}
+
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::skip_to_depth( size_t done_depth, bool is_in_string, bool is_escaped )
+{
+    // Scans until the context stack is back to done_depth, and not in a
+    // string
+
+    while( is_in_string || m.context_stack.size() > done_depth )
+    {
+        const char * p = m.input.span_begin();
+        const char * p_end = m.input.span_end();
+        if( p == p_end )
+        {
+            int c = get();
+            if( c == Reader::EOM )
+            {
+                if( m.input.reader().is_awaiting_input() && ! m.input.is_size_limit_exceeded() )
+                    return wait_to_skip_to_depth( done_depth, is_in_string, is_escaped );
+                return report_error( PS_UNEXPECTED_END_OF_MESSAGE );
+            }
+            if( is_escaped )
+                is_escaped = false;
+            else
+            {
+                Status status = skip_char( c, &is_in_string, &is_escaped );
+                if( status != PS_OK )
+                    return status;
+            }
+            continue;
+        }
+
+        while( p < p_end && (is_in_string || m.context_stack.size() > done_depth) )
+        {
+            if( is_escaped )
+            {
+                is_escaped = false;
+                ++p;
+                continue;
+            }
+            p = find_skip_significant_char( p, p_end );
+            if( p == p_end )
+                break;
+            Status status = skip_char( *p++, &is_in_string, &is_escaped );
+            if( status != PS_OK )
+            {
+                m.input.span_advance_to( p );
+                return status;
+            }
+        }
+        m.input.span_advance_to( p );
+    }
+    return PS_OK;
+}
+
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::wait_to_skip_to_depth( size_t done_depth, bool is_in_string, bool is_escaped )
+{
+    m.skip.is_scanning = true;
+    m.skip.scan_depth = done_depth;
+    m.skip.is_in_string = is_in_string;
+    m.skip.is_escaped = is_escaped;
+    return PS_NEED_MORE_INPUT;
+}
+
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::resume_skip_to_depth()
+{
+    m.skip.is_scanning = false;
+    Status status = skip_to_depth( m.skip.scan_depth, m.skip.is_in_string, m.skip.is_escaped );
+    if( status == PS_OK && m.skip.is_value )
+    {
+        // As context_update_for_object() and context_update_for_array() do
+        // after a value
+        if( context() == C_START_OBJECT )
+            m.context_stack.set_top( C_IN_OBJECT );
+        else if( context() == C_START_ARRAY )
+            m.context_stack.set_top( C_IN_ARRAY );
+    }
+    if( status != PS_NEED_MORE_INPUT )
+        m.skip.is_value = false;
+    return status;
+}
+
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::skip_events( size_t done_depth )
 {
     Event event;
-    size_t done_depth = m.context_stack.size() - 1;
     while( m.context_stack.size() > done_depth )
     {
         Status status = get( &event );
+        if( status == PS_NEED_MORE_INPUT )
+        {
+            m.skip.is_by_events = true;
+            m.skip.events_depth = done_depth;
+            return status;
+        }
         if( status != PS_OK )
             return report_error( status );
     }
     return PS_OK;
 }
 
-void Parser::new_message()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::skip_char( int c, bool * p_is_in_string, bool * p_is_escaped )
+{
+    if( *p_is_in_string )
+    {
+        if( c == '"' )
+            *p_is_in_string = false;
+        else if( c == '\\' )
+            *p_is_escaped = true;
+        return PS_OK;
+    }
+
+    switch( c )
+    {
+    case '"':
+        *p_is_in_string = true;
+        break;
+    case '[': case '{':
+        if( m.limits.max_depth && m.context_stack.size() > m.limits.max_depth )
+            return report_error( PS_MAX_DEPTH_EXCEEDED );
+        m.context_stack.push( c == '[' ? C_START_ARRAY : C_START_OBJECT );
+        break;
+    case ']':
+        if( context() != C_START_ARRAY && context() != C_IN_ARRAY )
+            return report_error( PS_UNEXPECTED_ARRAY_CLOSE );
+        m.context_stack.pop();
+        break;
+    case '}':
+        if( context() != C_START_OBJECT && context() != C_IN_OBJECT )
+            return report_error( PS_UNEXPECTED_OBJECT_CLOSE );
+        m.context_stack.pop();
+        break;
+    }
+    return PS_OK;
+}
+
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::skip_value()
+{
+    // Skips a value that isn't in the projection, starting at its first
+    // character
+
+    // Input that can't start a value is reported as without the projection
+    if( m.c != 't' && m.c != 'f' && m.c != 'n' && ! is_number_start_char() &&
+            m.c != '{' && m.c != '[' && m.c != '"' )
+        return error_on_unrecognised_value_start();
+
+    m.projection.is_value_skipped = true;
+
+    if( m.c == '{' || m.c == '[' || m.c == '"' )
+    {
+        Status status;
+        if( m.c == '"' )
+            status = skip_to_depth( m.context_stack.size(), true, false );
+        else
+        {
+            bool is_in_string = false;
+            bool is_escaped = false;
+            status = skip_char( m.c, &is_in_string, &is_escaped );
+            if( status != PS_OK )
+                return status;
+            status = skip_to_depth( m.context_stack.size() - 1, false, false );
+        }
+        // The context is updated once the rest of the value has been fed
+        if( status == PS_NEED_MORE_INPUT )
+            m.skip.is_value = true;
+        return status;
+    }
+
+    // Numbers, true, false and null run to the next separator
+    const char * p = m.input.span_begin();
+    const char * p_end = m.input.span_end();
+    while( p < p_end && ! cljp::is_separator( static_cast< unsigned char >( *p ) ) )
+        ++p;
+    m.input.span_advance_to( p );
+    if( p == p_end )
+    {
+        while( ! is_separator() )
+            get();
+        unget();
+    }
+    return PS_OK;
+}
+
+template< typename Treader >
+bool BasicParser< Treader >::is_projected_out( Projection::State value_state )
+{
+    // Records how the value being read matches the projection.  m.c is the
+    // first character of the value.  Only objects and arrays can contain
+    // the values that are wanted.
+
+    ProjectionState & r_projection = m.projection;
+    r_projection.value_state = value_state;
+    r_projection.match = Projection::match( value_state );
+    return r_projection.match == Projection::M_NONE ||
+            (r_projection.match == Projection::M_ANCESTOR && m.c != '{' && m.c != '[');
+}
+
+template< typename Treader >
+bool BasicParser< Treader >::is_member_projected_out()
+{
+    size_t level = m.context_stack.size() - 2;
+    if( m.projection.is_selected( level ) )
+    {
+        m.projection.match = Projection::M_SELECTED;
+        return false;
+    }
+
+    Projection::State state = m.projection.levels[level].state;
+    if( m.p_name_view && m.p_event_out->name.empty() )
+        return is_projected_out( m.projection.p_projection->next_member(
+                                        state, m.p_name_view->data(), m.p_name_view->size() ) );
+    return is_projected_out( m.projection.p_projection->next_member(
+                                        state, m.p_event_out->name.data(), m.p_event_out->name.size() ) );
+}
+
+template< typename Treader >
+bool BasicParser< Treader >::is_element_projected_out()
+{
+    size_t level = m.context_stack.size() - 2;
+    if( m.projection.is_selected( level ) )
+    {
+        m.projection.match = Projection::M_SELECTED;
+        return false;
+    }
+
+    typename ProjectionState::Level & r_level = m.projection.levels[level];
+    return is_projected_out( m.projection.p_projection->next_element( r_level.state, r_level.n_elements++ ) );
+}
+
+template< typename Treader >
+void BasicParser< Treader >::new_message()
 {
     m.new_message();
 }
 
-Parser::Status Parser::get_outer()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::get_outer()
 {
     // JSON-text = value
 
-    m.context_stack.top() = Parser::C_DONE;
+    m.context_stack.set_top( C_DONE );
+
+    if( m.projection.p_projection )
+    {
+        if( is_projected_out( m.projection.p_projection->start() ) )
+            return skip_value();
+    }
 
     Status status = get_value();
 
-    conditional_context_update_for_nesting_increase();
+    if( status == PS_OK )
+        status = conditional_context_update_for_nesting_increase();
 
     if( status != PS_OK )
         return report_error( status );
@@ -1364,7 +4950,8 @@ Parser::Status Parser::get_outer()
     return PS_OK;
 }
 
-Parser::Status Parser::get_start_object()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::get_start_object()
 {
     if( m.c == '}' )
     {
@@ -1378,7 +4965,8 @@ Parser::Status Parser::get_start_object()
     return get_for_object();
 }
 
-Parser::Status Parser::get_in_object()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::get_in_object()
 {
     if( m.c == '}' )
     {
@@ -1403,7 +4991,8 @@ Parser::Status Parser::get_in_object()
     return get_for_object();
 }
 
-Parser::Status Parser::get_for_object()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::get_for_object()
 {
     Status status = get_member();
 
@@ -1413,7 +5002,8 @@ Parser::Status Parser::get_for_object()
     return status;
 }
 
-Parser::Status Parser::get_start_array()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::get_start_array()
 {
     if( m.c == ']' )
     {
@@ -1427,7 +5017,8 @@ Parser::Status Parser::get_start_array()
     return get_for_array();
 }
 
-Parser::Status Parser::get_in_array()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::get_in_array()
 {
     if( m.c == ']' )
     {
@@ -1452,9 +5043,10 @@ Parser::Status Parser::get_in_array()
     return get_for_array();
 }
 
-Parser::Status Parser::get_for_array()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::get_for_array()
 {
-    Status status = get_value();
+    Status status = m.projection.p_projection && is_element_projected_out() ? skip_value() : get_value();
 
     if( status == PS_OK )
         status = context_update_for_array();
@@ -1462,7 +5054,8 @@ Parser::Status Parser::get_for_array()
     return status;
 }
 
-Parser::Status Parser::get_member()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::get_member()
 {
     // member = string name-separator value
 
@@ -1471,18 +5064,38 @@ Parser::Status Parser::get_member()
     if( status == PS_OK )
         status = skip_name_separator();
 
-    if( status == PS_OK )
-        status = get_value();
+    if( status != PS_OK )
+        return status;
 
-    return status;
+    if( m.projection.p_projection && is_member_projected_out() )
+        return skip_value();
+
+    if( m.p_keys )
+        set_key();
+
+    return get_value();
+}
+
+template< typename Treader >
+void BasicParser< Treader >::set_key()
+{
+    if( m.p_name_view && m.p_event_out->name.empty() )
+        m.p_event_out->key = m.p_keys->find( m.p_name_view->data(), m.p_name_view->size() );
+    else
+        m.p_event_out->key = m.p_keys->find( m.p_event_out->name );
 }
 
-Parser::Status Parser::get_name()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::get_name()
 {
     if( m.c != '"' )
         return report_error( PS_EXPECTED_MEMBER_NAME );
 
-    Status status = StringReader( m.input, m.c, &m.p_event_out->name );
+    if( m.p_name_view && try_get_string_view( m.p_name_view ) )
+        return PS_OK;
+
+    Status status = StringReader< BasicReadUTF8WithUnget< Treader > >( m.input, m.c, &m.p_event_out->name,
+                                                                        limit_or_max( m.limits.max_string_size ) );
 
     if( status != PS_OK )
         return report_error( status );
@@ -1490,7 +5103,8 @@ Parser::Status Parser::get_name()
     return PS_OK;
 }
 
-Parser::Status Parser::skip_name_separator()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::skip_name_separator()
 {
     get_non_ws();
 
@@ -1508,7 +5122,8 @@ Parser::Status Parser::skip_name_separator()
     return PS_OK;
 }
 
-Parser::Status Parser::get_value()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::get_value()
 {
     // value = false / null / true / object (start) / array (start) / number / string
 
@@ -1543,7 +5158,8 @@ Parser::Status Parser::get_value()
         return error_on_unrecognised_value_start();
 }
 
-Parser::Status Parser::error_on_unrecognised_value_start()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::error_on_unrecognised_value_start()
 {
     if( m.c == Reader::EOM )
         return report_error( PS_UNEXPECTED_END_OF_MESSAGE );
@@ -1563,24 +5179,29 @@ Parser::Status Parser::error_on_unrecognised_value_start()
     return report_error( PS_UNRECOGNISED_VALUE_FORMAT );
 }
 
-Parser::Status Parser::get_false()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::get_false()
 {
-    return get_constant_string( "false", Event::T_BOOLEAN, PS_BAD_FORMAT_FALSE );
+    return get_constant_string( "false", Event::T_BOOLEAN, Event::F_PARSED, PS_BAD_FORMAT_FALSE );
 }
 
-Parser::Status Parser::get_true()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::get_true()
 {
-    return get_constant_string( "true", Event::T_BOOLEAN, PS_BAD_FORMAT_TRUE );
+    return get_constant_string( "true", Event::T_BOOLEAN, Event::F_PARSED | Event::F_TRUE, PS_BAD_FORMAT_TRUE );
 }
 
-Parser::Status Parser::get_null()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::get_null()
 {
-    return get_constant_string( "null", Event::T_NULL, PS_BAD_FORMAT_NULL );
+    return get_constant_string( "null", Event::T_NULL, Event::F_PARSED, PS_BAD_FORMAT_NULL );
 }
 
-Parser::Status Parser::get_constant_string(
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::get_constant_string(
                                         const char * const p_chars_start,
                                         Event::Type on_success_type,
+                                        unsigned int on_success_flags,
                                         Status on_error_code )
 {
     read_to_non_quoted_value_end();
@@ -1589,10 +5210,12 @@ Parser::Status Parser::get_constant_string(
         return report_error( on_error_code );
 
     m.p_event_out->type = on_success_type;
+    m.p_event_out->flags = on_success_flags;
     return PS_OK;
 }
 
-bool Parser::is_number_start_char()
+template< typename Treader >
+bool BasicParser< Treader >::is_number_start_char()
 {
     // number = [ minus ] int [ frac ] [ exp ]
     // int = zero / ( digit1-9 *DIGIT )
@@ -1600,16 +5223,19 @@ bool Parser::is_number_start_char()
     return m.c == '-' || (m.c >= '0' && m.c <= '9');
 }
 
-bool Parser::is_invalid_json_number_start_char()
+template< typename Treader >
+bool BasicParser< Treader >::is_invalid_json_number_start_char()
 {
     // JSON numbers can't start with + and .
 
     return m.c == '+' || m.c == '.';
 }
 
-Parser::Status Parser::get_number()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::get_number()
 {
-    Status status = NumberReader( m.input, m.c, m.p_event_out );
+    Status status = NumberReader< BasicReadUTF8WithUnget< Treader > >( m.input, m.c, m.p_event_out,
+                                                                        limit_or_max( m.limits.max_number_size ) );
 
     if( status != PS_OK )
         return report_error( status );
@@ -1617,11 +5243,16 @@ Parser::Status Parser::get_number()
     return PS_OK;
 }
 
-Parser::Status Parser::get_string()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::get_string()
 {
     m.p_event_out->type = Event::T_STRING;
 
-    Status status = StringReader( m.input, m.c, &m.p_event_out->value );
+    if( m.p_value_view && try_get_string_view( m.p_value_view ) )
+        return PS_OK;
+
+    Status status = StringReader< BasicReadUTF8WithUnget< Treader > >( m.input, m.c, &m.p_event_out->value,
+                                                                        limit_or_max( m.limits.max_string_size ) );
 
     if( status != PS_OK )
         return report_error( status );
@@ -1629,49 +5260,89 @@ Parser::Status Parser::get_string()
     return PS_OK;
 }
 
-void Parser::read_to_non_quoted_value_end()
+template< typename Treader >
+bool BasicParser< Treader >::try_get_string_view( StringView * p_view_out )
+{
+    // If the string has no escapes and is wholly in input that will remain
+    // valid, the view can refer directly to the input.  Otherwise nothing
+    // is consumed and the string is read in the normal way.
+
+    if( ! m.input.is_span_stable() )
+        return false;
+
+    const char * p_begin = m.input.span_begin();
+    const char * p_end = m.input.span_end();
+    const char * p = m.input.span_next_stop();
+    if( ! p )
+    {
+        p = p_begin;
+        while( p < p_end && is_unescaped_string_char( *p ) )
+            ++p;
+    }
+
+    if( p == p_end || *p != '"' || static_cast< size_t >( p - p_begin ) > limit_or_max( m.limits.max_string_size ) )
+        return false;
+
+    *p_view_out = StringView( p_begin, p );
+    m.input.span_advance_to( p + 1 );
+    m.c = '"';
+    return true;
+}
+
+template< typename Treader >
+void BasicParser< Treader >::read_to_non_quoted_value_end()
 {
+    // Reading of these values is limited in the same way as numbers
+    size_t max_size = limit_or_max( m.limits.max_number_size );
+
     m.p_event_out->value += m.c;
     while( get() )
     {
-        if( is_separator() )
+        if( is_separator() || m.p_event_out->value.size() > max_size )
             break;
         m.p_event_out->value += m.c;
     }
     unget();
 }
 
-bool Parser::is_separator()
+template< typename Treader >
+bool BasicParser< Treader >::is_separator()
 {
     return cljp::is_separator( m.c );
 }
 
-bool Parser::is_unexpected_object_close()
+template< typename Treader >
+bool BasicParser< Treader >::is_unexpected_object_close()
 {
     return m.c == '}';
 }
 
-Parser::Status Parser::unexpected_object_close_error()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::unexpected_object_close_error()
 {
     return report_error( PS_UNEXPECTED_OBJECT_CLOSE );
 }
 
-bool Parser::is_unexpected_array_close()
+template< typename Treader >
+bool BasicParser< Treader >::is_unexpected_array_close()
 {
     return m.c == ']';
 }
 
-Parser::Status Parser::unexpected_array_close_error()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::unexpected_array_close_error()
 {
     return report_error( PS_UNEXPECTED_ARRAY_CLOSE );
 }
 
-bool Parser::is_unexpected_close()
+template< typename Treader >
+bool BasicParser< Treader >::is_unexpected_close()
 {
     return m.c == '}' || m.c == ']';
 }
 
-Parser::Status Parser::unexpected_close_error()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::unexpected_close_error()
 {
     if( m.c == '}' )
         return report_error( PS_UNEXPECTED_OBJECT_CLOSE );
@@ -1682,50 +5353,329 @@ Parser::Status Parser::unexpected_close_error()
     return PS_OK;
 }
 
-Parser::Status Parser::context_update_for_object()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::context_update_for_object()
 {
     if( m.p_event_out->type == Event::T_OBJECT_END )
         m.context_stack.pop();
     else if( m.p_event_out->type == Event::T_ARRAY_END )
         return report_error( PS_UNEXPECTED_ARRAY_CLOSE );
     else
-        m.context_stack.top() = C_IN_OBJECT;
+        m.context_stack.set_top( C_IN_OBJECT );
 
-    conditional_context_update_for_nesting_increase();
-
-    return PS_OK;
+    return conditional_context_update_for_nesting_increase();
 }
 
-Parser::Status Parser::context_update_for_array()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::context_update_for_array()
 {
     if( m.p_event_out->type == Event::T_ARRAY_END )
         m.context_stack.pop();
     else if( m.p_event_out->type == Event::T_OBJECT_END )
         return report_error( PS_UNEXPECTED_OBJECT_CLOSE );
     else
-        m.context_stack.top() = C_IN_ARRAY;
+        m.context_stack.set_top( C_IN_ARRAY );
 
-    conditional_context_update_for_nesting_increase();
-
-    return PS_OK;
+    return conditional_context_update_for_nesting_increase();
 }
 
-void Parser::conditional_context_update_for_nesting_increase()
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::conditional_context_update_for_nesting_increase()
 {
+    if( m.p_event_out->type != Event::T_ARRAY_START && m.p_event_out->type != Event::T_OBJECT_START )
+        return PS_OK;
+
+    if( m.limits.max_depth && m.context_stack.size() > m.limits.max_depth )
+        return report_error( PS_MAX_DEPTH_EXCEEDED );
+
     if( m.p_event_out->type == Event::T_ARRAY_START )
         m.context_stack.push( C_START_ARRAY );
-    else if( m.p_event_out->type == Event::T_OBJECT_START )
+    else
         m.context_stack.push( C_START_OBJECT );
+
+    if( m.projection.p_projection )
+    {
+        // A selection made at this level or above has ended
+        ProjectionState & r_projection = m.projection;
+        size_t level = m.context_stack.size() - 2;
+        if( r_projection.selected_level >= level )
+            r_projection.selected_level = r_projection.match == Projection::M_SELECTED ? level : ~size_t( 0 );
+        if( r_projection.levels.size() <= level )
+            r_projection.levels.resize( level + 1 );
+        r_projection.levels[level].state = r_projection.value_state;
+        r_projection.levels[level].n_elements = 0;
+    }
+
+    return PS_OK;
 }
 
-Parser::Status Parser::report_error( Status error )
+template< typename Treader >
+ParserBase::Status BasicParser< Treader >::report_error( Status error )
 {
+    if( m.input.is_size_limit_exceeded() )
+        error = PS_MAX_MESSAGE_SIZE_EXCEEDED;   // The input stopping caused the error
+
     m.last_status = error;
 
+    // The next message may start part way through what the index took to
+    // be a string, or outside what it took to be one
+    m.input.use_index( 0 );
+
     #if CLJP_THROW_ERRORS == 1
         throw( ParserException( error ) );
     #endif
     return error;
 }
 
+//----------------------------------------------------------------------------
+//                               class Tape
+//----------------------------------------------------------------------------
+
+namespace {
+
+const unsigned int number_flags_shift = 48;
+const uint64_t number_offset_mask = (uint64_t( 1 ) << number_flags_shift) - 1;
+
+bool is_float_stored( unsigned int flags )
+{
+    // Otherwise the number's second entry is its integer magnitude
+    return ! (flags & Event::F_PARSED) || (flags & (Event::F_FRAC | Event::F_EXP | Event::F_INT_OVERFLOW));
+}
+
+}   // End of anonymous namespace
+
+ParserBase::Status Tape::build( Parser & r_parser )
+{
+    return build_from( r_parser );
+}
+
+ParserBase::Status Tape::build( BasicParser< ReaderMemory > & r_parser )
+{
+    return build_from( r_parser );
+}
+
+template< typename Tparser >
+ParserBase::Status Tape::build_from( Tparser & r_parser )
+{
+    clear();
+
+    EventView event;
+    ParserBase::Status status;
+    while( (status = r_parser.get( &event )) == ParserBase::PS_OK )
+        add( event );
+
+    if( status == ParserBase::PS_END_OF_MESSAGE && ! empty() )
+        return ParserBase::PS_OK;
+    return status;
+}
+
+void Tape::add( const EventView & r_event )
+{
+    if( ! m.open_starts.empty() && tag( m.open_starts.back() ) == Event::T_OBJECT_START &&
+            r_event.type != Event::T_OBJECT_END )
+        add_entry( tag_name, add_string( r_event.name ) );
+
+    switch( r_event.type )
+    {
+    case Event::T_OBJECT_START:
+    case Event::T_ARRAY_START:
+        m.open_starts.push_back( m.entries.size() );
+        add_entry( r_event.type, 0 );
+    break;
+
+    case Event::T_OBJECT_END:
+    case Event::T_ARRAY_END:
+        {
+        size_t start = m.open_starts.back();
+        m.open_starts.pop_back();
+        m.entries[start] |= m.entries.size();
+        add_entry( r_event.type, start );
+        }
+    break;
+
+    case Event::T_STRING:
+        add_entry( Event::T_STRING, add_string( r_event.value ) );
+    break;
+
+    case Event::T_NUMBER:
+        {
+        add_entry( Event::T_NUMBER, (uint64_t( r_event.flags ) << number_flags_shift) | add_string( r_event.value ) );
+        uint64_t number = r_event.int_magnitude;
+        if( is_float_stored( r_event.flags ) )
+        {
+            double float_value = r_event.to_float();
+            memcpy( &number, &float_value, sizeof( number ) );
+        }
+        m.entries.push_back( number );
+        }
+    break;
+
+    case Event::T_BOOLEAN:
+        add_entry( Event::T_BOOLEAN, r_event.is_true() ? 1 : 0 );
+    break;
+
+    case Event::T_NULL:
+    case Event::T_UNKNOWN:
+    default:
+        add_entry( r_event.type, 0 );
+    break;
+    }
+}
+
+uint64_t Tape::add_string( const StringView & r_string )
+{
+    uint64_t offset = m.strings.size();
+    uint32_t size = static_cast< uint32_t >( r_string.size() );
+    m.strings.append( reinterpret_cast< const char * >( &size ), sizeof( size ) );
+    m.strings.append( r_string.data(), r_string.size() );
+    m.strings += '\0';
+    return offset;
+}
+
+StringView Tape::string_at( uint64_t offset ) const
+{
+    uint32_t size;
+    memcpy( &size, m.strings.data() + offset, sizeof( size ) );
+    return StringView( m.strings.data() + offset + sizeof( size ), size );
+}
+
+size_t Tape::next_index( size_t index ) const
+{
+    switch( tag( index ) )
+    {
+    case Event::T_OBJECT_START:
+    case Event::T_ARRAY_START:
+        return static_cast< size_t >( payload( index ) ) + 1;
+    case Event::T_NUMBER:
+        return index + 2;
+    default:
+        return index + 1;
+    }
+}
+
+void Tape::Value::to_event( EventView * p_event_out ) const
+{
+    p_event_out->clear();
+    if( ! is_valid() )
+        return;
+
+    size_t i = value_index();
+    p_event_out->type = type();
+    p_event_out->name = name();
+    uint64_t payload = p_tape->payload( i );
+
+    switch( p_event_out->type )
+    {
+    case Event::T_STRING:
+        p_event_out->value = p_tape->string_at( payload );
+    break;
+
+    case Event::T_NUMBER:
+        {
+        p_event_out->flags = static_cast< unsigned int >( payload >> number_flags_shift );
+        p_event_out->value = p_tape->string_at( payload & number_offset_mask );
+        uint64_t number = p_tape->m.entries[i + 1];
+        if( is_float_stored( p_event_out->flags ) )
+        {
+            memcpy( &p_event_out->float_value, &number, sizeof( number ) );
+        }
+        else
+        {
+            p_event_out->int_magnitude = number;
+            p_event_out->float_value = static_cast< double >( number );
+            if( p_event_out->flags & Event::F_MINUS )
+                p_event_out->float_value = -p_event_out->float_value;
+        }
+        }
+    break;
+
+    case Event::T_BOOLEAN:
+        p_event_out->flags = Event::F_PARSED | (payload ? Event::F_TRUE : 0);
+        p_event_out->value = payload ? StringView( "true", 4 ) : StringView( "false", 5 );
+    break;
+
+    case Event::T_NULL:
+        p_event_out->value = StringView( "null", 4 );
+    break;
+
+    default:
+    break;
+    }
+}
+
+StringView Tape::Value::name() const
+{
+    if( ! is_valid() || p_tape->tag( index ) != tag_name )
+        return StringView();
+    return p_tape->string_at( p_tape->payload( index ) );
+}
+
+Tape::Value Tape::Value::at_entry( size_t entry_index ) const
+{
+    // Invalid at the end of an object or array, or of the tape
+    if( entry_index >= p_tape->size() )
+        return Value();
+    unsigned int entry_tag = p_tape->tag( entry_index );
+    if( entry_tag == Event::T_OBJECT_END || entry_tag == Event::T_ARRAY_END )
+        return Value();
+    return Value( p_tape, entry_index );
+}
+
+Tape::Value Tape::Value::first() const
+{
+    if( ! is_object() && ! is_array() )
+        return Value();
+    return at_entry( value_index() + 1 );
+}
+
+Tape::Value Tape::Value::next() const
+{
+    if( ! is_valid() )
+        return Value();
+    return at_entry( p_tape->next_index( value_index() ) );
+}
+
+size_t Tape::Value::size() const
+{
+    size_t n = 0;
+    for( Value value = first(); value.is_valid(); value = value.next() )
+        ++n;
+    return n;
+}
+
+Tape::Value Tape::Value::at( size_t index ) const
+{
+    Value value = first();
+    for( ; value.is_valid() && index > 0; --index )
+        value = value.next();
+    return value;
+}
+
+Tape::Value Tape::Value::find( const StringView & r_name ) const
+{
+    if( ! is_object() )
+        return Value();
+    for( Value value = first(); value.is_valid(); value = value.next() )
+        if( value.name() == r_name )
+            return value;
+    return Value();
+}
+
+Tape::Value Tape::Value::find( const char * p_name ) const
+{
+    return find( StringView( p_name, strlen( p_name ) ) );
+}
+
+//----------------------------------------------------------------------------
+//                         Template instantiations
+//----------------------------------------------------------------------------
+
+template class BasicReadUTF8< Reader >;
+template class BasicReadUTF8WithUnget< Reader >;
+template class BasicParser< Reader >;
+
+template class BasicReadUTF8< ReaderMemory >;
+template class BasicReadUTF8WithUnget< ReaderMemory >;
+template class BasicParser< ReaderMemory >;
+
 }   // End of namespace cljp
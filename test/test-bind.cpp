@@ -0,0 +1,170 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull-bind.h"  // Put file under test first to verify dependencies
+
+#include "clunit.h"
+
+#include "test-harness.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Location
+{
+    double lat;
+    double lon;
+    std::string label;
+
+    Location() : lat( 0.0 ), lon( 0.0 ) {}
+};
+
+struct Record
+{
+    uint64_t id;
+    std::string name;
+    bool active;
+    int score;
+    unsigned char level;
+    float ratio;
+    std::vector< std::string > tags;
+    Location location;
+    std::vector< Location > visits;
+
+    Record() : id( 0 ), active( false ), score( 0 ), level( 0 ), ratio( 0.0f ) {}
+};
+
+}   // End of anonymous namespace
+
+CLJP_BIND_BEGIN( Location )
+    CLJP_BIND_MEMBER( lat )
+    CLJP_BIND_MEMBER( lon )
+    CLJP_BIND_MEMBER( label )
+CLJP_BIND_END()
+
+CLJP_BIND_BEGIN( Record )
+    CLJP_BIND_MEMBER( id )
+    CLJP_BIND_MEMBER( name )
+    CLJP_BIND_MEMBER( active )
+    CLJP_BIND_MEMBER( score )
+    CLJP_BIND_MEMBER( level )
+    CLJP_BIND_MEMBER_NAMED( ratio, "ratio-value" )
+    CLJP_BIND_MEMBER( tags )
+    CLJP_BIND_MEMBER( location )
+    CLJP_BIND_MEMBER( visits )
+CLJP_BIND_END()
+
+namespace {
+
+template< typename T >
+cljp::Parser::Status read_from( const char * p_input, T * p_out )
+{
+    std::string json( p_input );
+    cljp::ReaderString reader( json );
+    cljp::Parser parser( reader );
+    return cljp::bind::read( parser, p_out );
+}
+
+const char * p_record =
+        "{\"id\":9007199254740993,\"name\":\"J\\u00f6\",\"active\":true,\"score\":-12,"
+        "\"level\":300,\"ratio-value\":0.5,\"tags\":[\"a\",\"b\"],"
+        "\"location\":{\"lat\":51.5,\"label\":null,\"lon\":-0.25},"
+        "\"unknown\":{\"id\":[1,{\"x\":2}]},\"more\":[3],"
+        "\"visits\":[{\"lat\":1},{\"label\":\"x\"}]}";
+
+}   // End of anonymous namespace
+
+TFEATURE( "bind::read() - structs" )
+{
+    Record record;
+    TTEST( read_from( p_record, &record ) == cljp::Parser::PS_OK );
+    TTEST( record.id == 9007199254740993ull );
+    TTEST( record.name == "J\xc3\xb6" );
+    TTEST( record.active );
+    TTEST( record.score == -12 );
+    TTEST( record.level == 255 );
+    TTEST( record.ratio == 0.5f );
+    TTEST( record.tags.size() == 2 && record.tags[0] == "a" && record.tags[1] == "b" );
+    TTEST( record.location.lat == 51.5 );
+    TTEST( record.location.lon == -0.25 );
+    TTEST( record.location.label.empty() );
+    TTEST( record.visits.size() == 2 );
+    TTEST( record.visits[0].lat == 1.0 && record.visits[0].label.empty() );
+    TTEST( record.visits[1].lat == 0.0 && record.visits[1].label == "x" );
+
+    TDOC( "The parser's own keys are restored" );
+    {
+    std::string json( p_record );
+    cljp::ReaderString reader( json );
+    cljp::Parser parser( reader );
+    cljp::KeySet keys;
+    parser.use_keys( &keys );
+    TTEST( cljp::bind::read( parser, &record ) == cljp::Parser::PS_OK );
+    TTEST( parser.keys() == &keys );
+    }
+}
+
+TFEATURE( "bind::read() - other values" )
+{
+    std::vector< int > values;
+    TTEST( read_from( "[1,-2,3.7,null]", &values ) == cljp::Parser::PS_OK );
+    TTEST( values.size() == 4 && values[0] == 1 && values[1] == -2 && values[2] == 3 && values[3] == 0 );
+
+    std::vector< std::vector< double > > matrix;
+    TTEST( read_from( "[[1,2],[],[3]]", &matrix ) == cljp::Parser::PS_OK );
+    TTEST( matrix.size() == 3 && matrix[0].size() == 2 && matrix[1].empty() && matrix[2][0] == 3.0 );
+
+    std::string text( "unchanged" );
+    TTEST( read_from( "null", &text ) == cljp::Parser::PS_OK );
+    TTEST( text == "unchanged" );
+
+    unsigned int n = 7;
+    TTEST( read_from( "-1", &n ) == cljp::Parser::PS_OK );
+    TTEST( n == 0 );
+}
+
+TFEATURE( "bind::read() - errors" )
+{
+    Record record;
+    TTEST( read_from( "[]", &record ) == cljp::Parser::PS_UNEXPECTED_VALUE_TYPE );
+    TTEST( read_from( "{\"id\":\"1\"}", &record ) == cljp::Parser::PS_UNEXPECTED_VALUE_TYPE );
+    TTEST( read_from( "{\"active\":1}", &record ) == cljp::Parser::PS_UNEXPECTED_VALUE_TYPE );
+    TTEST( read_from( "{\"tags\":{}}", &record ) == cljp::Parser::PS_UNEXPECTED_VALUE_TYPE );
+    TTEST( read_from( "{\"location\":[]}", &record ) == cljp::Parser::PS_UNEXPECTED_VALUE_TYPE );
+    TTEST( read_from( "{\"name\":\"x\"", &record ) == cljp::Parser::PS_UNEXPECTED_END_OF_MESSAGE );
+    TTEST( read_from( "{\"unknown\":[1}", &record ) == cljp::Parser::PS_UNEXPECTED_OBJECT_CLOSE );
+    TTEST( read_from( "", &record ) == cljp::Parser::PS_END_OF_MESSAGE );
+}
@@ -0,0 +1,352 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull-coroutine.h"    // Put file under test first to verify dependencies
+
+#include "clunit.h"
+
+#include "test-harness.h"
+
+#include <algorithm>
+#include <coroutine>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace {
+
+std::string generated_events_of( const std::string & r_input )   // As events_of() from test-harness.h
+{
+    cljp::ReaderString reader( r_input );
+    cljp::Parser parser( reader );
+    std::string events;
+    for( ;; )
+    {
+        cljp::EventGenerator generator = cljp::events( parser );
+        size_t n_events = 0;
+        for( const cljp::Event & r_event : generator )
+        {
+            events += describe( cljp::Parser::PS_OK, r_event );
+            ++n_events;
+        }
+        events += describe( generator.status() );
+        if( generator.status() != cljp::Parser::PS_END_OF_MESSAGE || n_events == 0 )
+            return events;
+        parser.new_message();
+    }
+}
+
+class Task      // A coroutine that runs straight away, for the tests to await the generator from
+{
+public:
+    struct promise_type
+    {
+        std::exception_ptr p_exception;
+
+        Task get_return_object() { return Task( handle::from_promise( *this ) ); }
+        std::suspend_never initial_suspend() noexcept { return std::suspend_never(); }
+        std::suspend_always final_suspend() noexcept { return std::suspend_always(); }
+        void return_void() {}
+        void unhandled_exception() { p_exception = std::current_exception(); }
+    };
+
+    typedef std::coroutine_handle< promise_type > handle;
+
+private:
+    handle coroutine;
+
+public:
+    Task( Task && r_rhs ) : coroutine( std::exchange( r_rhs.coroutine, nullptr ) ) {}
+    ~Task() { if( coroutine ) coroutine.destroy(); }
+    bool is_done() const { return coroutine.done(); }
+    bool is_failed() const { return is_done() && coroutine.promise().p_exception; }
+
+private:
+    explicit Task( handle coroutine_in ) : coroutine( coroutine_in ) {}
+};
+
+class Source    // Gives the input piece_size bytes at a time, at once or when resumed by run(), as an event loop would
+{
+public:
+    enum Mode { M_READY, M_DEFERRED };
+
+    class Read
+    {
+    private:
+        Source * p_source;
+        char * p_buffer;
+        size_t size;
+
+    public:
+        Read( Source * p_source_in, char * p_buffer_in, size_t size_in )
+            : p_source( p_source_in ), p_buffer( p_buffer_in ), size( size_in )
+        {}
+        bool await_ready() const { return p_source->mode == M_READY; }
+        void await_suspend( std::coroutine_handle<> awaiting ) { p_source->pending = awaiting; ++p_source->n_suspends; }
+        size_t await_resume() { return p_source->copy( p_buffer, size ); }
+    };
+
+private:
+    std::string in;
+    size_t pos;
+    size_t piece_size;
+    Mode mode;
+    size_t fail_at;         // Throws on reading from this position, if not 0
+    std::coroutine_handle<> pending;
+
+public:
+    size_t n_reads;
+    size_t n_suspends;
+
+    Source( const std::string & r_in, size_t piece_size_in, Mode mode_in, size_t fail_at_in = 0 )
+        : in( r_in ), pos( 0 ), piece_size( piece_size_in ), mode( mode_in ), fail_at( fail_at_in ),
+        n_reads( 0 ), n_suspends( 0 )
+    {}
+
+    Read read_some( char * p_buffer, size_t size ) { ++n_reads; return Read( this, p_buffer, size ); }
+
+    void run()
+    {
+        while( pending )
+            std::exchange( pending, nullptr ).resume();
+    }
+
+private:
+    size_t copy( char * p_buffer, size_t size )
+    {
+        if( fail_at > 0 && pos >= fail_at )
+            throw std::runtime_error( "source" );
+        size_t n_bytes = std::min( std::min( size, piece_size ), in.size() - pos );
+        memcpy( p_buffer, in.data() + pos, n_bytes );
+        pos += n_bytes;
+        return n_bytes;
+    }
+};
+
+Task read_async( cljp::AsyncEventGenerator & r_generator, std::string * p_events_out )
+{
+    while( const cljp::Event * p_event = co_await r_generator.next() )
+        *p_events_out += describe( cljp::Parser::PS_OK, *p_event );
+    *p_events_out += describe( r_generator.status() );
+}
+
+Task read_messages_async( cljp::Parser & r_parser, cljp::ReaderFeed & r_reader, Source & r_source,
+                            size_t block_size, std::string * p_events_out )
+{
+    for( ;; )
+    {
+        cljp::AsyncEventGenerator generator = cljp::events_async( r_parser, r_reader, r_source, block_size );
+        size_t n_events = 0;
+        while( const cljp::Event * p_event = co_await generator.next() )
+        {
+            *p_events_out += describe( cljp::Parser::PS_OK, *p_event );
+            ++n_events;
+        }
+        *p_events_out += describe( generator.status() );
+        if( generator.status() != cljp::Parser::PS_END_OF_MESSAGE || n_events == 0 )
+            co_return;
+        r_parser.new_message();
+    }
+}
+
+std::string async_events_of( Source * p_source, size_t block_size = cljp::ReaderFeed::default_block_size )
+{
+    // As events_of() from test-harness.h
+    cljp::ReaderFeed reader;
+    cljp::Parser parser( reader );
+    std::string events;
+    Task task = read_messages_async( parser, reader, *p_source, block_size, &events );
+    p_source->run();
+    if( ! task.is_done() )
+        return "Not done";
+    return events;
+}
+
+bool is_same_async( const char * p_input )
+{
+    std::string input( p_input );
+    std::string expected = events_of( input );
+    const size_t piece_sizes[] = { 1, 2, 3, 16, 1000 };
+    for( size_t i = 0; i < sizeof( piece_sizes ) / sizeof( piece_sizes[0] ); ++i )
+    {
+        Source source_ready( input, piece_sizes[i], Source::M_READY );
+        Source source_deferred( input, piece_sizes[i], Source::M_DEFERRED );
+        if( async_events_of( &source_ready ) != expected || async_events_of( &source_deferred ) != expected )
+            return false;
+    }
+    return true;
+}
+
+}   // End of anonymous namespace
+
+TFEATURE( "events() - Generator of a message's events" )
+{
+    TTEST( generated_events_of( "{\"a\":[1,true,\"x\"],\"b\":{},\"c\":null}" ) ==
+            events_of( "{\"a\":[1,true,\"x\"],\"b\":{},\"c\":null}" ) );
+    TTEST( generated_events_of( "\"scalar\"" ) == events_of( "\"scalar\"" ) );
+    TTEST( generated_events_of( "" ) == events_of( "" ) );
+
+    TDOC( "Errors end the events with their status" );
+    TTEST( generated_events_of( "[1,2}" ) == events_of( "[1,2}" ) );
+    TTEST( generated_events_of( "{\"a\" 1}" ) == events_of( "{\"a\" 1}" ) );
+
+    TDOC( "next()" );
+    {
+    std::string input( "[1] [\"two\"]" );
+    cljp::ReaderString reader( input );
+    cljp::Parser parser( reader );
+    cljp::EventGenerator generator = cljp::events( parser );
+    TTEST( ! generator.is_done() );
+    const cljp::Event * p_event = generator.next();
+    TTEST( p_event != 0 && p_event->type == cljp::Event::T_ARRAY_START );
+    p_event = generator.next();
+    TTEST( p_event != 0 && p_event->value == "1" );
+    p_event = generator.next();
+    TTEST( p_event != 0 && p_event->type == cljp::Event::T_ARRAY_END );
+    TTEST( generator.next() == 0 );
+    TTEST( generator.is_done() );
+    TTEST( generator.status() == cljp::Parser::PS_END_OF_MESSAGE );
+    TTEST( generator.next() == 0 );     // Still done
+
+    TDOC( "The next message" );
+    parser.new_message();
+    cljp::EventGenerator moved = cljp::events( parser );
+    cljp::EventGenerator next_message( std::move( moved ) );
+    next_message.next();
+    p_event = next_message.next();
+    TTEST( p_event != 0 && p_event->value == "two" );
+    }
+
+    TDOC( "Parser reading a ReaderMemory" );
+    {
+    std::string input( "[1,2,3]" );
+    cljp::ReaderString reader( input );
+    cljp::BasicParser< cljp::ReaderMemory > parser( reader );
+    size_t n_events = 0;
+    for( const cljp::Event & r_event : cljp::events( parser ) )
+        n_events += (r_event.type != cljp::Event::T_UNKNOWN);
+    TTEST( n_events == 5 );
+    }
+}
+
+TFEATURE( "events_async() - Generator of a message's events from an asynchronous source" )
+{
+    TTEST( is_same_async( "{\"a\":[1,true,\"x\"],\"b\":{},\"c\":null,\"d\":-1.5e3}" ) );
+    TTEST( is_same_async( " [ \"\xc3\xa9\\u00e9\" , 12 ] " ) );
+    TTEST( is_same_async( "\"scalar\"" ) );
+    TTEST( is_same_async( "123" ) );
+    TTEST( is_same_async( "" ) );
+    TTEST( is_same_async( "[1,2}" ) );
+    TTEST( is_same_async( "[1,2" ) );
+
+    TDOC( "Only suspends when the input fed so far is used up" );
+    {
+    std::string input = "[1,2,3,4,5,6,7,8,9,10]";
+    Source source( input, 1000, Source::M_DEFERRED );
+    TTEST( async_events_of( &source ) == events_of( input ) );
+    TTEST( source.n_suspends == 2 );        // The input, and then the end of the input when looking for another message
+    TTEST( source.n_reads == 2 );
+    }
+    {
+    std::string input = "[1,2,3,4,5,6,7,8,9,10]";
+    Source source( input, 5, Source::M_DEFERRED );
+    TTEST( async_events_of( &source ) == events_of( input ) );
+    TTEST( source.n_suspends == 6 );
+    }
+    {
+    Source source( "123", 1000, Source::M_DEFERRED );
+    TTEST( async_events_of( &source ) == events_of( "123" ) );
+    TTEST( source.n_suspends == 2 );        // The number could continue, until the end of the input
+    }
+
+    TDOC( "Reads are no bigger than the block size" );
+    {
+    std::string input = "[1,2,3,4,5,6,7,8,9,10]";
+    Source source( input, 1000, Source::M_READY );
+    TTEST( async_events_of( &source, 4 ) == events_of( input ) );
+    TTEST( source.n_reads == 7 );
+    }
+
+    TDOC( "Messages after the first" );
+    {
+    Source source( "[1] [\"two\"]", 1000, Source::M_DEFERRED );
+    cljp::ReaderFeed reader;
+    cljp::Parser parser( reader );
+    std::string events;
+    {
+    cljp::AsyncEventGenerator generator = cljp::events_async( parser, reader, source );
+    Task task = read_async( generator, &events );
+    source.run();
+    TTEST( task.is_done() );
+    TTEST( events == "0:7:=;0:2:=1;0:8:=;1." );
+    TTEST( generator.is_done() );
+    TTEST( generator.status() == cljp::Parser::PS_END_OF_MESSAGE );
+    }
+    parser.new_message();
+    events.clear();
+    cljp::AsyncEventGenerator generator = cljp::events_async( parser, reader, source );
+    Task task = read_async( generator, &events );
+    source.run();
+    TTEST( task.is_done() );
+    TTEST( events == "0:7:=;0:1:=two;0:8:=;1." );
+    TTEST( source.n_suspends == 1 );        // Each message ends at its ], and the second was already in the reader
+    }
+
+    TDOC( "Exceptions thrown by the source" );
+    {
+    Source source( "[1,2,3,4,5,6,7,8,9,10]", 4, Source::M_DEFERRED, 8 );
+    cljp::ReaderFeed reader;
+    cljp::Parser parser( reader );
+    cljp::AsyncEventGenerator generator = cljp::events_async( parser, reader, source );
+    std::string events;
+    Task task = read_async( generator, &events );
+    source.run();
+    TTEST( task.is_failed() );
+    TTEST( events == "0:7:=;0:2:=1;0:2:=2;0:2:=3;" );
+    }
+
+    TDOC( "Destroying a generator that is waiting for input" );
+    {
+    Source source( "[1,2,3]", 2, Source::M_DEFERRED );
+    cljp::ReaderFeed reader;
+    cljp::Parser parser( reader );
+    cljp::AsyncEventGenerator generator = cljp::events_async( parser, reader, source );
+    std::string events;
+    Task task = read_async( generator, &events );
+    TTEST( ! task.is_done() );
+    TTEST( ! generator.is_done() );
+    TTEST( source.n_suspends == 1 );
+    }       // Not resumed by the source
+}
@@ -0,0 +1,194 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull.h"   // Put file under test first to verify dependencies
+
+#include "clunit.h"
+
+#include "test-harness.h"
+
+#include <cstdio>
+
+TFEATURE( "class StringView" )
+{
+    cljp::StringView empty;
+    TTEST( empty.empty() );
+    TTEST( empty.size() == 0 );
+    TTEST( empty == "" );
+    TTEST( empty != "a" );
+
+    const char * p_text = "abcdef";
+    cljp::StringView view( p_text + 1, 3 );
+    TTEST( ! view.empty() );
+    TTEST( view.size() == 3 );
+    TTEST( view.data() == p_text + 1 );
+    TTEST( view.end() - view.begin() == 3 );
+    TTEST( view[0] == 'b' );
+    TTEST( view[2] == 'd' );
+    TTEST( view == "bcd" );
+    TTEST( view != "bc" );
+    TTEST( view != "bcde" );
+    TTEST( view != "xcd" );
+    TTEST( view == std::string( "bcd" ) );
+    TTEST( view != std::string( "bcde" ) );
+    TTEST( view == cljp::StringView( "bcd", 3 ) );
+    TTEST( view.to_string() == "bcd" );
+    TTEST( cljp::StringView( p_text, p_text + 2 ) == "ab" );
+
+    std::string with_nul( "a\0b", 3 );
+    TTEST( cljp::StringView( with_nul ) != "a" );
+    TTEST( cljp::StringView( with_nul ) == with_nul );
+}
+
+namespace {
+
+bool is_view_of( const cljp::StringView & r_view, const std::string & r_input )
+{
+    return r_view.data() >= r_input.data() && r_view.end() <= r_input.data() + r_input.size();
+}
+
+}   // End of anonymous namespace
+
+TFEATURE( "Parser::get( EventView * )" )
+{
+    std::string json( "{ \"name\": \"value\", \"escaped\\\\name\": \"escaped\\nvalue\", "
+                        "\"number\": -1.5e3, \"bool\": true, \"empty\": \"\" }" );
+
+    {
+    cljp::ReaderString reader( json );
+    cljp::Parser parser( reader );
+    cljp::EventView event;
+
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is_object_start() );
+    TTEST( event.name.empty() && event.value.empty() );
+
+    TDOC( "Strings without escapes are views of the input" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is( "name", cljp::Event::T_STRING ) );
+    TTEST( event.value == "value" );
+    TTEST( is_view_of( event.name, json ) );
+    TTEST( is_view_of( event.value, json ) );
+
+    TDOC( "Strings with escapes are unescaped into the parser" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.name == "escaped\\name" );
+    TTEST( event.value == "escaped\nvalue" );
+    TTEST( ! is_view_of( event.name, json ) );
+    TTEST( ! is_view_of( event.value, json ) );
+
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is( "number" ) );
+    TTEST( event.is_number() );
+    TTEST( event.value == "-1.5e3" );
+    TTEST( is_view_of( event.name, json ) );
+
+    TTEST( ! event.is_int() );
+    TTEST( event.float_value == -1500.0 );
+
+    cljp::Event copy;
+    event.to_event( &copy );
+    TTEST( copy.name == "number" );
+    TTEST( copy.flags == event.flags );
+    TTEST( copy.to_float() == -1500.0 );
+
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is( "bool" ) );
+    TTEST( event.is_true() );
+    TTEST( ! event.is_false() );
+
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is( "empty", cljp::Event::T_STRING ) );
+    TTEST( event.value.empty() );
+
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is_object_end() );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_END_OF_MESSAGE );
+    }
+
+    TDOC( "Events and views can be mixed" );
+    {
+    cljp::ReaderString reader( json );
+    cljp::Parser parser( reader );
+    cljp::Event event;
+    cljp::EventView event_view;
+
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( parser.get( &event_view ) == cljp::Parser::PS_OK );
+    TTEST( event_view.is( "name" ) );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.name == "escaped\\name" );
+    TTEST( parser.skip() == cljp::Parser::PS_OK );
+    TTEST( parser.get( &event_view ) == cljp::Parser::PS_END_OF_MESSAGE );
+    }
+
+    TDOC( "Strings are not views of input that may not remain valid" );
+    {
+    const char * p_file_name = "test-event-view.json";
+    FILE * h_fout = fopen( p_file_name, "wb" );
+    fputs( json.c_str(), h_fout );
+    fclose( h_fout );
+
+    cljp::ReaderFile reader( p_file_name, 8 );
+    TTEST( ! reader.has_stable_blocks() );
+    cljp::Parser parser( reader );
+    cljp::EventView event;
+
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is( "name" ) );
+    TTEST( event.value == "value" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.value == "escaped\nvalue" );
+    }
+    remove( "test-event-view.json" );
+
+    {
+    std::string utf16le;
+    for( size_t i = 0; i < json.size(); ++i )
+    {
+        utf16le += json[i];
+        utf16le += '\0';
+    }
+    cljp::ReaderString reader( utf16le );
+    TTEST( reader.has_stable_blocks() );
+    cljp::Parser parser( reader );
+    cljp::EventView event;
+
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is( "name" ) );
+    TTEST( event.value == "value" );
+    TTEST( ! is_view_of( event.value, utf16le ) );
+    }
+}
@@ -35,6 +35,8 @@
 
 #include "cl-json-pull/cl-json-pull.h"
 
+#include <climits>
+
 TFEATURE( "struct Event" )
 {
     cljp::Event event;
@@ -271,6 +273,94 @@ TFEATURE( "Event to_float, to_int" )
     }
 }
 
+TFEATURE( "Event to_int64, to_uint64" )
+{
+    {
+    TDOC( "Event to_int64, to_uint64 of events not set by the parser" );
+    cljp::Event event;
+    event.type = cljp::Event::T_NUMBER;
+
+    event.value = "0";
+    TTEST( event.to_int64() == 0 );
+    TTEST( event.to_uint64() == 0 );
+
+    event.value = "-0";
+    TTEST( event.to_int64() == 0 );
+    TTEST( event.to_uint64() == 0 );
+
+    event.value = "9007199254740993";       // 2^53 + 1, which a double can't represent
+    TTEST( event.to_int64() == INT64_C( 9007199254740993 ) );
+    TTEST( event.to_uint64() == UINT64_C( 9007199254740993 ) );
+
+    event.value = "-9007199254740993";
+    TTEST( event.to_int64() == -INT64_C( 9007199254740993 ) );
+    TTEST( event.to_uint64() == 0 );
+
+    event.value = "9223372036854775807";
+    TTEST( event.to_int64() == INT64_C( 9223372036854775807 ) );
+
+    event.value = "9223372036854775808";
+    TTEST( event.to_int64() == INT64_C( 9223372036854775807 ) );
+    TTEST( event.to_uint64() == UINT64_C( 9223372036854775808 ) );
+
+    event.value = "-9223372036854775808";
+    TTEST( event.to_int64() == -INT64_C( 9223372036854775807 ) - 1 );
+
+    event.value = "-9223372036854775809";
+    TTEST( event.to_int64() == -INT64_C( 9223372036854775807 ) - 1 );
+
+    event.value = "18446744073709551615";
+    TTEST( event.to_int64() == INT64_C( 9223372036854775807 ) );
+    TTEST( event.to_uint64() == UINT64_C( 18446744073709551615 ) );
+
+    event.value = "18446744073709551616";
+    TTEST( event.to_uint64() == UINT64_C( 18446744073709551615 ) );
+
+    event.value = "-12.9";
+    TTEST( event.to_int64() == -12 );
+    TTEST( event.to_uint64() == 0 );
+
+    event.value = "12.9";
+    TTEST( event.to_int64() == 12 );
+    TTEST( event.to_uint64() == 12 );
+
+    event.value = "1e19";
+    TTEST( event.to_int64() == INT64_C( 9223372036854775807 ) );
+    TTEST( event.to_uint64() == UINT64_C( 10000000000000000000 ) );
+
+    event.value = "1e400";
+    TTEST( event.to_uint64() == UINT64_C( 18446744073709551615 ) );
+    }
+
+    {
+    TDOC( "Event to_int, to_long clamp values out of range" );
+    cljp::Event event;
+    event.type = cljp::Event::T_NUMBER;
+
+    event.value = "99999999999";
+    TTEST( event.to_int() == INT_MAX );
+
+    event.value = "-99999999999";
+    TTEST( event.to_int() == INT_MIN );
+
+    event.value = "99999999999999999999";
+    TTEST( event.to_long() == LONG_MAX );
+    }
+
+    {
+    TDOC( "Event to_int64, to_uint64 for non-numbers" );
+    cljp::Event event;
+    event.type = cljp::Event::T_BOOLEAN;
+
+    event.value = "true";
+    TTEST( event.to_int64() == 1 );
+    TTEST( event.to_uint64() == 1 );
+
+    event.value = "false";
+    TTEST( event.to_int64() == 0 );
+    }
+}
+
 TFEATURE( "Event to_string, to_wstring" )
 {
     {
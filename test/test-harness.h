@@ -33,8 +33,59 @@
 
 #include "cl-json-pull/cl-json-pull.h"
 
+#include <cstdio>
 #include <string>
 
+class UseUTF8Validator
+{
+    // Selects a UTF-8 validator (and so instruction set) for the lifetime
+    // of the object
+private:
+    cljp::ReadUTF8Base::UTF8Validators original;
+
+public:
+    UseUTF8Validator( cljp::ReadUTF8Base::UTF8Validators validator )
+        : original( cljp::ReadUTF8Base::utf8_validator() )
+    {
+        cljp::ReadUTF8Base::use_utf8_validator( validator );
+    }
+    ~UseUTF8Validator() { cljp::ReadUTF8Base::use_utf8_validator( original ); }
+};
+
+class ReaderGetOnly : public cljp::Reader
+{
+    // Only implements do_get(), as a user defined Reader that predates the
+    // block interface would, so it offers its input a byte at a time
+
+private:
+    std::string in;
+    size_t pos;
+
+public:
+    ReaderGetOnly( const std::string & r_in ) : in( r_in ), pos( 0 ) {}
+
+private:
+    virtual int do_get()
+    {
+        if( pos < in.size() )
+            return static_cast< unsigned char >( in[pos++] );
+        return EOM;
+    }
+    virtual void do_rewind() { pos = 0; }
+};
+
+template< typename Tparser >
+class IndexedParser : private cljp::StructuralIndex, public Tparser
+{
+    // A parser that uses a StructuralIndex of its input.  The index is a
+    // base class so that it is built before the parser is constructed.
+
+public:
+    IndexedParser( cljp::ReaderMemory & r_reader_in )
+        : cljp::StructuralIndex( r_reader_in ), Tparser( r_reader_in, *this )
+    {}
+};
+
 struct Harness
 {
     std::string json;
@@ -49,3 +100,75 @@ struct Harness
         parser( reader )
     {}
 };
+
+inline std::string describe( cljp::Parser::Status status, const cljp::Event & r_event )
+{
+    char c_prefix[32];
+    sprintf( c_prefix, "%d:%d:", static_cast< int >( status ), static_cast< int >( r_event.type ) );
+    return c_prefix + r_event.name + "=" + r_event.value + ";";
+}
+
+inline std::string describe( cljp::Parser::Status status )
+{
+    char c_status[16];
+    sprintf( c_status, "%d.", static_cast< int >( status ) );
+    return c_status;
+}
+
+inline std::string events_of( const std::string & r_input, size_t feed_size = 0, const char * p_path = 0 )
+{
+    // The events of each message in the input, each followed by the status
+    // that ended the message, until a message has no events or there is an
+    // error.  The input is read whole if feed_size is 0, or otherwise fed
+    // to a ReaderFeed feed_size bytes at a time.  Objects and arrays named
+    // "skip" are skipped after their first event.
+    cljp::ReaderString reader_string( r_input );
+    cljp::ReaderFeed reader_feed( 7 );          // Small blocks, so chunks are reused
+    cljp::Parser parser( feed_size ? static_cast< cljp::Reader & >( reader_feed ) : reader_string );
+    cljp::Projection projection;
+    if( p_path )
+    {
+        projection.add( p_path );
+        parser.use_projection( &projection );
+    }
+    cljp::Event event;
+    std::string events;
+    size_t n_fed = 0;
+    bool is_skipping = false;
+
+    for( ;; )
+    {
+        size_t n_events = 0;
+        cljp::Parser::Status status;
+        while( (status = is_skipping ? parser.skip() : parser.get( &event )) != cljp::Parser::PS_END_OF_MESSAGE )
+        {
+            if( status == cljp::Parser::PS_NEED_MORE_INPUT )
+            {
+                if( n_fed < r_input.size() )
+                {
+                    reader_feed.feed( r_input.substr( n_fed, feed_size ) );
+                    n_fed += feed_size;
+                }
+                else
+                    reader_feed.finish();
+                continue;
+            }
+            if( is_skipping )
+            {
+                events += "skipped;";
+                is_skipping = false;
+                if( status == cljp::Parser::PS_OK )
+                    continue;
+            }
+            if( status != cljp::Parser::PS_OK )
+                return events + describe( status );
+            events += describe( status, event );
+            ++n_events;
+            is_skipping = event.name == "skip" && (event.is_object_start() || event.is_array_start());
+        }
+        events += describe( status );
+        if( n_events == 0 )
+            return events;
+        parser.new_message();
+    }
+}
@@ -0,0 +1,194 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull.h"   // Put file under test first to verify dependencies
+
+#include "clunit.h"
+
+#include "test-harness.h"
+
+#include <cstdio>
+#include <string>
+
+namespace {
+
+template< typename Tevent, typename Tparser >
+std::string keys_text( Tparser & r_parser )
+{
+    // The key of each event returned, space separated, followed by the
+    // status if it is an error
+
+    std::string text;
+    Tevent event;
+    typename Tparser::Status status;
+    while( (status = r_parser.get( &event )) == Tparser::PS_OK )
+    {
+        char c_key[16];
+        sprintf( c_key, text.empty() ? "%d" : " %d", event.key );
+        text += c_key;
+    }
+    if( status != Tparser::PS_END_OF_MESSAGE )
+    {
+        char c_status[32];
+        sprintf( c_status, " !%d", static_cast< int >( status ) );
+        text += c_status;
+    }
+    return text;
+}
+
+void key_set_test(
+        int test_line,
+        const char * p_input,
+        const cljp::KeySet & r_keys,
+        const cljp::Projection * p_projection,
+        const char * p_expected )
+{
+    char c_doc[256];
+    sprintf( c_doc, "Line: %d, input: %s", test_line, p_input );
+    TDOC( c_doc );
+
+    std::string json( p_input );
+
+    {
+    cljp::ReaderString reader( json );
+    cljp::Parser parser( reader );
+    parser.use_keys( &r_keys );
+    parser.use_projection( p_projection );
+    TTEST( keys_text< cljp::Event >( parser ) == p_expected );
+    }
+
+    {
+    cljp::ReaderString reader( json );
+    cljp::Parser parser( reader );
+    parser.use_keys( &r_keys );
+    parser.use_projection( p_projection );
+    TTEST( keys_text< cljp::EventView >( parser ) == p_expected );
+    }
+
+    {
+    cljp::ReaderString reader( json );
+    IndexedParser< cljp::BasicParser< cljp::ReaderMemory > > parser( reader );
+    parser.use_keys( &r_keys );
+    parser.use_projection( p_projection );
+    TTEST( keys_text< cljp::Event >( parser ) == p_expected );
+    }
+}
+
+}   // End of anonymous namespace
+
+TFEATURE( "KeySet::add()" )
+{
+    cljp::KeySet keys;
+    TTEST( keys.size() == 0 );
+
+    TTEST( keys.add( "id" ) == 1 );
+    TTEST( keys.add( "name" ) == 2 );
+    TTEST( keys.add( "" ) == 3 );
+    TTEST( keys.add( "name" ) == 2 );
+    TTEST( keys.size() == 3 );
+    TTEST( keys.name( 2 ) == "name" );
+
+    keys.clear();
+    TTEST( keys.size() == 0 );
+    TTEST( keys.add( "name" ) == 1 );
+}
+
+TFEATURE( "KeySet::find()" )
+{
+    cljp::KeySet keys;
+    TTEST( keys.find( "id" ) == cljp::KeySet::K_UNKNOWN );
+    TTEST( keys.find( "" ) == cljp::KeySet::K_UNKNOWN );
+
+    keys.add( "id" );
+    keys.add( "name" );
+    TTEST( keys.find( "id" ) == 1 );
+    TTEST( keys.find( "name" ) == 2 );
+    TTEST( keys.find( "nam" ) == cljp::KeySet::K_UNKNOWN );
+    TTEST( keys.find( "names" ) == cljp::KeySet::K_UNKNOWN );
+    TTEST( keys.find( "" ) == cljp::KeySet::K_UNKNOWN );
+    TTEST( keys.find( "a\0b", 3 ) == cljp::KeySet::K_UNKNOWN );
+
+    TDOC( "Adding a name after finding rebuilds the table" );
+    keys.add( "" );
+    TTEST( keys.find( "" ) == 3 );
+    TTEST( keys.find( "id" ) == 1 );
+}
+
+TFEATURE( "KeySet::find() - many keys" )
+{
+    cljp::KeySet keys;
+    for( int i = 0; i < 1000; ++i )
+    {
+        char c_name[32];
+        sprintf( c_name, "key_%d", i );
+        keys.add( c_name );
+    }
+    keys.compile();
+
+    int n_found = 0;
+    int n_unknown = 0;
+    for( int i = 0; i < 2000; ++i )
+    {
+        char c_name[32];
+        sprintf( c_name, "key_%d", i );
+        if( keys.find( c_name ) == i + 1 )
+            ++n_found;
+        else if( keys.find( c_name ) == cljp::KeySet::K_UNKNOWN )
+            ++n_unknown;
+    }
+    TTEST( n_found == 1000 );
+    TTEST( n_unknown == 1000 );
+}
+
+TFEATURE( "Parser with a KeySet" )
+{
+    cljp::KeySet keys;
+    keys.add( "id" );
+    keys.add( "name" );
+    keys.add( "a/b" );
+
+    key_set_test( __LINE__, "{\"id\":1,\"name\":\"x\",\"other\":2}", keys, 0, "0 1 2 0 0" );
+    key_set_test( __LINE__, "{\"name\":{\"id\":[{\"id\":1}]}}", keys, 0, "0 2 1 0 1 0 0 0 0" );
+    key_set_test( __LINE__, "[\"id\",\"name\"]", keys, 0, "0 0 0 0" );
+    key_set_test( __LINE__, "{\"a\\/b\":1,\"a\\u002Fb\":2,\"i\\u0064\":3}", keys, 0, "0 3 3 1 0" );
+    key_set_test( __LINE__, "{\"id\":1,\"id\"}", keys, 0, "0 1 !4" );
+
+    TDOC( "No keys" );
+    cljp::KeySet no_keys;
+    key_set_test( __LINE__, "{\"id\":1}", no_keys, 0, "0 0 0" );
+
+    TDOC( "With a Projection" );
+    cljp::Projection projection;
+    projection.add( "/*/name" );
+    key_set_test( __LINE__, "[{\"id\":1,\"name\":\"x\"},{\"name\":\"y\"}]", keys, &projection, "0 0 2 0 0 2 0 0" );
+}
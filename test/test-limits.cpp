@@ -0,0 +1,289 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull.h"   // Put file under test first to verify dependencies
+
+#include "clunit.h"
+
+#include "test-harness.h"
+
+#include <string>
+
+namespace {
+
+cljp::Parser::Status last_status( cljp::Parser & parser )
+{
+    cljp::Event event;
+    cljp::Parser::Status status;
+    while( (status = parser.get( &event )) == cljp::Parser::PS_OK )
+    {}
+    return status;
+}
+
+cljp::Parser::Status limited_parse_status( const std::string & r_json, const cljp::Parser::Limits & r_limits )
+{
+    cljp::ReaderString reader( r_json );
+    cljp::Parser parser( reader );
+    parser.set_limits( r_limits );
+    return last_status( parser );
+}
+
+class ReaderCounting : public cljp::Reader   // Records how much of the input has been read
+{
+private:
+    const std::string & r_in;
+    size_t pos;
+
+public:
+    ReaderCounting( const std::string & r_in_in ) : r_in( r_in_in ), pos( 0 ) {}
+    size_t n_read() const { return pos; }
+
+private:
+    virtual int do_get()
+    {
+        if( pos < r_in.size() )
+            return static_cast< unsigned char >( r_in[pos++] );
+        return EOM;
+    }
+    virtual void do_rewind() { pos = 0; }
+};
+
+}   // End of anonymous namespace
+
+TFEATURE( "Parser::Limits" )
+{
+    cljp::Parser::Limits limits;
+    TTEST( limits.max_depth == 0 );
+    TTEST( limits.max_string_size == 0 );
+    TTEST( limits.max_number_size == 0 );
+    TTEST( limits.max_message_size == 0 );
+
+    Harness h( "[]" );
+    limits.max_depth = 3;
+    h.parser.set_limits( limits );
+    TTEST( h.parser.limits().max_depth == 3 );
+}
+
+TFEATURE( "Parser::Limits max_depth" )
+{
+    cljp::Parser::Limits limits;
+    limits.max_depth = 3;
+
+    TTEST( limited_parse_status( "[[[1]]]", limits ) == cljp::Parser::PS_END_OF_MESSAGE );
+    TTEST( limited_parse_status( "{\"a\":[{}]}", limits ) == cljp::Parser::PS_END_OF_MESSAGE );
+    TTEST( limited_parse_status( "[[[[1]]]]", limits ) == cljp::Parser::PS_MAX_DEPTH_EXCEEDED );
+    TTEST( limited_parse_status( "{\"a\":[{\"b\":{}}]}", limits ) == cljp::Parser::PS_MAX_DEPTH_EXCEEDED );
+    TTEST( limited_parse_status( "[[[1]],[[[2]]]]", limits ) == cljp::Parser::PS_MAX_DEPTH_EXCEEDED );
+
+    {
+    TDOC( "The error is reported in place of the start event that is too deep" );
+    Harness h( "[[[[1]]]]" );
+    h.parser.set_limits( limits );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_MAX_DEPTH_EXCEEDED );
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_UNABLE_TO_CONTINUE_DUE_TO_ERRORS );
+    }
+
+    {
+    TDOC( "skip() is limited in the same way" );
+    Harness h( "[[[1]],[[[2]]]]" );
+    h.parser.set_limits( limits );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.parser.skip() == cljp::Parser::PS_OK );
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.parser.skip() == cljp::Parser::PS_MAX_DEPTH_EXCEEDED );
+    }
+}
+
+TFEATURE( "Parser::Limits max_string_size" )
+{
+    cljp::Parser::Limits limits;
+    limits.max_string_size = 5;
+
+    TTEST( limited_parse_status( "[\"abcde\"]", limits ) == cljp::Parser::PS_END_OF_MESSAGE );
+    TTEST( limited_parse_status( "[\"abcdef\"]", limits ) == cljp::Parser::PS_MAX_STRING_SIZE_EXCEEDED );
+    TTEST( limited_parse_status( "{\"abcde\":1}", limits ) == cljp::Parser::PS_END_OF_MESSAGE );
+    TTEST( limited_parse_status( "{\"abcdef\":1}", limits ) == cljp::Parser::PS_MAX_STRING_SIZE_EXCEEDED );
+
+    TDOC( "Size is measured after unescaping" );
+    TTEST( limited_parse_status( "[\"ab\\ncd\"]", limits ) == cljp::Parser::PS_END_OF_MESSAGE );
+    TTEST( limited_parse_status( "[\"ab\\u00e9d\"]", limits ) == cljp::Parser::PS_END_OF_MESSAGE );     // e-acute is 2 bytes
+    TTEST( limited_parse_status( "[\"ab\\u00e9de\"]", limits ) == cljp::Parser::PS_MAX_STRING_SIZE_EXCEEDED );
+
+    {
+    TDOC( "EventView names and values are limited in the same way" );
+    std::string json( "[\"abcde\", \"abcdef\"]" );
+    cljp::ReaderString reader( json );
+    cljp::Parser parser( reader );
+    parser.set_limits( limits );
+    cljp::EventView event;
+
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.value == "abcde" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_MAX_STRING_SIZE_EXCEEDED );
+    }
+
+    {
+    TDOC( "Reading stops as soon as the limit is exceeded" );
+    std::string json( "[\"" + std::string( 100000, 'x' ) + "\"]" );
+    ReaderCounting reader( json );
+    cljp::Parser parser( reader );
+    parser.set_limits( limits );
+
+    TTEST( last_status( parser ) == cljp::Parser::PS_MAX_STRING_SIZE_EXCEEDED );
+    TTEST( reader.n_read() < 100 );
+    }
+}
+
+TFEATURE( "Parser::Limits max_number_size" )
+{
+    cljp::Parser::Limits limits;
+    limits.max_number_size = 3;
+
+    TTEST( limited_parse_status( "[123]", limits ) == cljp::Parser::PS_END_OF_MESSAGE );
+    TTEST( limited_parse_status( "[1e5, -12]", limits ) == cljp::Parser::PS_END_OF_MESSAGE );
+    TTEST( limited_parse_status( "[1234]", limits ) == cljp::Parser::PS_MAX_NUMBER_SIZE_EXCEEDED );
+    TTEST( limited_parse_status( "[-1.5]", limits ) == cljp::Parser::PS_MAX_NUMBER_SIZE_EXCEEDED );
+    TTEST( limited_parse_status( "[1.55]", limits ) == cljp::Parser::PS_MAX_NUMBER_SIZE_EXCEEDED );
+    TTEST( limited_parse_status( "[1e+55]", limits ) == cljp::Parser::PS_MAX_NUMBER_SIZE_EXCEEDED );
+
+    TDOC( "true, false and null are limited in the same way as numbers" );
+    limits.max_number_size = 5;
+    TTEST( limited_parse_status( "[true, false, null]", limits ) == cljp::Parser::PS_END_OF_MESSAGE );
+    TTEST( limited_parse_status( "[falsey]", limits ) == cljp::Parser::PS_BAD_FORMAT_FALSE );
+
+    {
+    TDOC( "Reading stops as soon as the limit is exceeded" );
+    std::string json( "[1" + std::string( 100000, '0' ) + "]" );
+    ReaderCounting reader( json );
+    cljp::Parser parser( reader );
+    parser.set_limits( limits );
+
+    TTEST( last_status( parser ) == cljp::Parser::PS_MAX_NUMBER_SIZE_EXCEEDED );
+    TTEST( reader.n_read() < 100 );
+    }
+
+    {
+    std::string json( "[t" + std::string( 100000, 'x' ) + "]" );
+    ReaderCounting reader( json );
+    cljp::Parser parser( reader );
+    parser.set_limits( limits );
+
+    TTEST( last_status( parser ) == cljp::Parser::PS_BAD_FORMAT_TRUE );
+    TTEST( reader.n_read() < 100 );
+    }
+}
+
+TFEATURE( "Parser::Limits max_message_size" )
+{
+    cljp::Parser::Limits limits;
+    limits.max_message_size = 7;
+
+    TTEST( limited_parse_status( "[1,2,3]", limits ) == cljp::Parser::PS_END_OF_MESSAGE );
+    TTEST( limited_parse_status( "[1,2,34]", limits ) == cljp::Parser::PS_MAX_MESSAGE_SIZE_EXCEEDED );
+    TTEST( limited_parse_status( "[\"abcdefgh\"]", limits ) == cljp::Parser::PS_MAX_MESSAGE_SIZE_EXCEEDED );
+    TTEST( limited_parse_status( "           [1]", limits ) == cljp::Parser::PS_MAX_MESSAGE_SIZE_EXCEEDED );
+
+    {
+    TDOC( "The size is counted for each message" );
+    Harness h( "[1,2,3][4,5,6] [7,8]" );
+    h.parser.set_limits( limits );
+
+    TTEST( last_status( h.parser ) == cljp::Parser::PS_END_OF_MESSAGE );
+    h.parser.new_message();
+    TTEST( last_status( h.parser ) == cljp::Parser::PS_END_OF_MESSAGE );
+    h.parser.new_message();
+    TTEST( last_status( h.parser ) == cljp::Parser::PS_END_OF_MESSAGE );
+    }
+
+    {
+    Harness h( "[1,2,3][4,5,6,7]" );
+    h.parser.set_limits( limits );
+
+    TTEST( last_status( h.parser ) == cljp::Parser::PS_END_OF_MESSAGE );
+    h.parser.new_message();
+    TTEST( last_status( h.parser ) == cljp::Parser::PS_MAX_MESSAGE_SIZE_EXCEEDED );
+    }
+
+    {
+    TDOC( "Reading stops at the limit" );
+    std::string json( "[" + std::string( 100000, ' ' ) + "]" );
+    ReaderCounting reader( json );
+    cljp::Parser parser( reader );
+    parser.set_limits( limits );
+
+    TTEST( last_status( parser ) == cljp::Parser::PS_MAX_MESSAGE_SIZE_EXCEEDED );
+    TTEST( reader.n_read() == 7 + 1 );  // One more to find that there is more input
+    }
+
+    {
+    TDOC( "skip() stops at the limit" );
+    Harness h( "[[1,2,3,4,5,6]]" );
+    h.parser.set_limits( limits );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.parser.skip() == cljp::Parser::PS_MAX_MESSAGE_SIZE_EXCEEDED );
+    }
+
+    {
+    TDOC( "With a StructuralIndex" );
+    std::string json( "[\"abcde\",   \"abcdefghij\"]" );
+    cljp::ReaderString reader( json );
+    IndexedParser< cljp::Parser > parser( reader );
+    limits.max_message_size = 12;
+    limits.max_string_size = 0;
+    parser.set_limits( limits );
+
+    cljp::EventView event;
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.value == "abcde" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_MAX_MESSAGE_SIZE_EXCEEDED );
+    }
+
+    {
+    TDOC( "With UTF-16 input" );
+    std::string json( "[\0\"\0a\0b\0c\0d\0e\0f\0\"\0]\0", 20 );
+    limits.max_message_size = 20;
+    TTEST( limited_parse_status( json, limits ) == cljp::Parser::PS_END_OF_MESSAGE );
+    limits.max_message_size = 19;
+    TTEST( limited_parse_status( json, limits ) == cljp::Parser::PS_MAX_MESSAGE_SIZE_EXCEEDED );
+    }
+}
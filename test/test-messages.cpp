@@ -45,25 +45,62 @@ struct ExpectedEvent
     std::string value;
 };
 
-void test_message_sequence( const char * message, ExpectedEvent events[] )
+template< typename Tparser >
+void test_message_sequence_with_parser( const char * message, ExpectedEvent events[] )
 {
-    Harness h( message );
+    std::string json( message );
+    cljp::ReaderString reader( json );
+    Tparser parser( reader );
+    cljp::Event event;
 
     for( size_t i=0; ; ++i )
     {
-        cljp::Parser::Status status = h.parser.get( &h.event );
+        cljp::Parser::Status status = parser.get( &event );
 
         TCRITICALTEST( status == events[i].status );
 
         if( status == cljp::Parser::PS_END_OF_MESSAGE )
             return;
 
-        TCRITICALTEST( h.event.type == events[i].type );
-        TCRITICALTEST( h.event.name == events[i].name );
-        TCRITICALTEST( h.event.value == events[i].value );
+        TCRITICALTEST( event.type == events[i].type );
+        TCRITICALTEST( event.name == events[i].name );
+        TCRITICALTEST( event.value == events[i].value );
     }
 }
 
+template< typename Tparser >
+void test_message_sequence_with_event_view( const char * message, ExpectedEvent events[] )
+{
+    std::string json( message );
+    cljp::ReaderString reader( json );
+    Tparser parser( reader );
+    cljp::EventView event;
+
+    for( size_t i=0; ; ++i )
+    {
+        cljp::Parser::Status status = parser.get( &event );
+
+        TCRITICALTEST( status == events[i].status );
+
+        if( status == cljp::Parser::PS_END_OF_MESSAGE )
+            return;
+
+        TCRITICALTEST( event.type == events[i].type );
+        TCRITICALTEST( event.name == events[i].name );
+        TCRITICALTEST( event.value == events[i].value );
+    }
+}
+
+void test_message_sequence( const char * message, ExpectedEvent events[] )
+{
+    TCALL( test_message_sequence_with_parser< cljp::Parser >( message, events ) );
+    TCALL( test_message_sequence_with_parser< cljp::BasicParser< cljp::ReaderMemory > >( message, events ) );
+    TCALL( test_message_sequence_with_parser< IndexedParser< cljp::Parser > >( message, events ) );
+    TCALL( test_message_sequence_with_parser< IndexedParser< cljp::BasicParser< cljp::ReaderMemory > > >( message, events ) );
+    TCALL( test_message_sequence_with_event_view< cljp::Parser >( message, events ) );
+    TCALL( test_message_sequence_with_event_view< IndexedParser< cljp::BasicParser< cljp::ReaderMemory > > >( message, events ) );
+}
+
 TFEATURE( "Reading whole messages" )
 {
     {
@@ -374,13 +411,17 @@ TFEATURE( "Reading multiple messages in single stream" )
     }
 }
 
-void test_invalid_message( const char * message, cljp::Parser::Status expected_final_status )
+template< typename Tparser >
+void test_invalid_message_with_parser( const char * message, cljp::Parser::Status expected_final_status )
 {
-    Harness h( message );
+    std::string json( message );
+    cljp::ReaderString reader( json );
+    Tparser parser( reader );
+    cljp::Event event;
 
     for(;;)
     {
-        cljp::Parser::Status status = h.parser.get( &h.event );
+        cljp::Parser::Status status = parser.get( &event );
 
         TCRITICALTEST( status != cljp::Parser::PS_END_OF_MESSAGE );
 
@@ -389,13 +430,21 @@ void test_invalid_message( const char * message, cljp::Parser::Status expected_f
             TTEST( status == expected_final_status );
 
             // Further attempts to read will get PS_UNABLE_TO_CONTINUE_DUE_TO_ERRORS
-            TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_UNABLE_TO_CONTINUE_DUE_TO_ERRORS );
+            TTEST( parser.get( &event ) == cljp::Parser::PS_UNABLE_TO_CONTINUE_DUE_TO_ERRORS );
 
             return;
         }
     }
 }
 
+void test_invalid_message( const char * message, cljp::Parser::Status expected_final_status )
+{
+    TCALL( test_invalid_message_with_parser< cljp::Parser >( message, expected_final_status ) );
+    TCALL( test_invalid_message_with_parser< cljp::BasicParser< cljp::ReaderMemory > >( message, expected_final_status ) );
+    TCALL( test_invalid_message_with_parser< IndexedParser< cljp::Parser > >( message, expected_final_status ) );
+    TCALL( test_invalid_message_with_parser< IndexedParser< cljp::BasicParser< cljp::ReaderMemory > > >( message, expected_final_status ) );
+}
+
 TFEATURE( "Parser: illegally formed messages" )
 {
     // Note that truncated messages are tested elsewhere
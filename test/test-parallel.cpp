@@ -0,0 +1,389 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull-parallel.h"  // Put file under test first to verify dependencies
+
+#include "clunit.h"
+
+#include <atomic>
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::string records( int n_records )
+{
+    // Includes blank lines, CRLF line ends and no line feed at the end
+    std::string ndjson( "\n" );
+    char c_record[64];
+    for( int i = 0; i < n_records; ++i )
+    {
+        sprintf( c_record, i % 7 ? "{\"n\":%d,\"s\":\"a\\nb\"}\n" : "  {\"n\" : %d}\r\n\n", i );
+        ndjson += c_record;
+    }
+    ndjson += "{\"n\":-1}";
+    return ndjson;
+}
+
+int record_n( cljp::RecordParser & r_parser )
+{
+    // The value of n, or -100 if the record isn't a valid message
+    cljp::Event event;
+    int n = -100;
+    cljp::Parser::Status status;
+    while( (status = r_parser.get( &event )) == cljp::Parser::PS_OK )
+        if( event.is( "n" ) )
+            n = event.to_int();
+    return status == cljp::Parser::PS_END_OF_MESSAGE ? n : -100;
+}
+
+cljp::ParallelOptions options( size_t n_threads, size_t chunk_size )
+{
+    cljp::ParallelOptions parallel_options;
+    parallel_options.n_threads = n_threads;
+    parallel_options.chunk_size = chunk_size;
+    return parallel_options;
+}
+
+std::string elements( int n_elements )
+{
+    // Strings with commas, brackets, quotes and backslashes, and nested
+    // arrays and objects
+    static const char * const p_elements[] = {
+            "%d",
+            "\"a,b %d\"",
+            "\"[{,\\\"],\\\\\"",
+            "{\"k\":[%d,2,{\"x\":\"]\"}],\"y\":\"\\\\\"}",
+            "[\"\\\\\\\\\\\",\", [], {}, [[%d]]]",
+            "true",
+            "null",
+            " \"\\u0041,%d\" " };
+    std::string array( " \xef\xbb\xbf[" );
+    array.erase( 0, 1 );
+    char c_element[128];
+    for( int i = 0; i < n_elements; ++i )
+    {
+        sprintf( c_element, p_elements[i % (sizeof( p_elements ) / sizeof( p_elements[0] ))], i );
+        if( i != 0 )
+            array += i % 3 ? "," : " ,\r\n";
+        array += c_element;
+    }
+    array += "]\n";
+    return array;
+}
+
+cljp::ParserBase::Status read_events( cljp::RecordParser & r_parser, std::string * p_events_out )
+{
+    cljp::Event event;
+    cljp::ParserBase::Status status;
+    char c_type[16];
+    while( (status = r_parser.get( &event )) == cljp::ParserBase::PS_OK )
+    {
+        sprintf( c_type, "%d:", static_cast< int >( event.type ) );
+        *p_events_out += c_type + event.name + "=" + event.value + ";";
+    }
+    return status;
+}
+
+std::vector< std::string > sequential_elements( const std::string & r_array )
+{
+    // The events of each element when the whole array is read by one parser
+    std::vector< std::string > events;
+    cljp::ReaderString reader( r_array );
+    cljp::RecordParser parser( reader );    // Reads reader's memory directly
+    cljp::Event event;
+    char c_type[16];
+    int depth = 0;
+    while( parser.get( &event ) == cljp::ParserBase::PS_OK )
+    {
+        if( event.is_array_end() || event.is_object_end() )
+            --depth;
+        if( depth >= 1 )
+        {
+            if( depth == 1 && ! event.is_array_end() && ! event.is_object_end() )
+                events.push_back( std::string() );
+            sprintf( c_type, "%d:", static_cast< int >( event.type ) );
+            events.back() += c_type + event.name + "=" + event.value + ";";
+        }
+        if( event.is_array_start() || event.is_object_start() )
+            ++depth;
+    }
+    return events;
+}
+
+cljp::ParserBase::Status elements_status( const char * p_array, std::vector< std::string > * p_events_out = 0 )
+{
+    std::string array( p_array );
+    std::vector< std::string > events;
+    cljp::ParserBase::Status status = cljp::parse_elements_ordered< std::string >( array.data(), array.data() + array.size(),
+            []( cljp::RecordParser & r_parser, size_t ) {
+                std::string element_events;
+                read_events( r_parser, &element_events );
+                return element_events;
+            },
+            [&]( std::string & r_events, size_t ) { events.push_back( r_events ); },
+            options( 2, 2 ) );
+    if( p_events_out )
+        p_events_out->swap( events );
+    return status;
+}
+
+}   // End of anonymous namespace
+
+TFEATURE( "parse_records_unordered()" )
+{
+    std::string ndjson = records( 1000 );
+    const size_t chunk_sizes[] = { 1, 7, 64, 1000000 };
+
+    for( size_t i = 0; i < sizeof( chunk_sizes ) / sizeof( chunk_sizes[0] ); ++i )
+    {
+        std::atomic< long > n_records( 0 );
+        std::atomic< long > sum( 0 );
+        cljp::parse_records_unordered( ndjson.data(), ndjson.data() + ndjson.size(),
+                [&]( cljp::RecordParser & r_parser, size_t ) {
+                    ++n_records;
+                    sum += record_n( r_parser );
+                },
+                options( 4, chunk_sizes[i] ) );
+        TTEST( n_records == 1001 );
+        TTEST( sum == 999 * 1000 / 2 - 1 );
+    }
+
+    TDOC( "Empty input" );
+    std::string empty;
+    std::atomic< long > n_records( 0 );
+    cljp::ReaderString reader( empty );
+    cljp::parse_records_unordered( reader, [&]( cljp::RecordParser &, size_t ) { ++n_records; } );
+    TTEST( n_records == 0 );
+}
+
+TFEATURE( "parse_records_ordered()" )
+{
+    std::string ndjson = records( 1000 );
+    const size_t chunk_sizes[] = { 1, 7, 64, 1000000 };
+
+    for( size_t i = 0; i < sizeof( chunk_sizes ) / sizeof( chunk_sizes[0] ); ++i )
+    {
+        std::vector< int > ns;
+        std::vector< size_t > offsets;
+        cljp::ReaderString reader( ndjson );
+        cljp::parse_records_ordered< int >( reader,
+                []( cljp::RecordParser & r_parser, size_t ) { return record_n( r_parser ); },
+                [&]( int n, size_t offset ) { ns.push_back( n ); offsets.push_back( offset ); },
+                options( 3, chunk_sizes[i] ) );
+
+        bool is_in_order = ns.size() == 1001 && ns.back() == -1;
+        for( size_t j = 0; j + 1 < ns.size() && is_in_order; ++j )
+            is_in_order = ns[j] == static_cast< int >( j ) && offsets[j] < offsets[j + 1] &&
+                            ndjson.compare( offsets[j], 2, j % 7 ? "{\"" : "  " ) == 0;
+        TTEST( is_in_order );
+    }
+
+    TDOC( "Invalid records" );
+    std::string invalid( "{\"n\":1}\n{\"n\":\n[2]\n" );
+    std::vector< int > ns;
+    cljp::parse_records_ordered< int >( invalid.data(), invalid.data() + invalid.size(),
+            []( cljp::RecordParser & r_parser, size_t ) { return record_n( r_parser ); },
+            [&]( int n, size_t ) { ns.push_back( n ); } );
+    TTEST( ns.size() == 3 && ns[0] == 1 && ns[1] == -100 && ns[2] == -100 );
+}
+
+TFEATURE( "parse_elements_unordered()" )
+{
+    std::string array = elements( 1000 );
+    std::vector< std::string > expected = sequential_elements( array );
+    TTEST( expected.size() == 1000 );
+    const size_t chunk_sizes[] = { 1, 7, 64, 1000000 };
+
+    for( size_t i = 0; i < sizeof( chunk_sizes ) / sizeof( chunk_sizes[0] ); ++i )
+    {
+        std::vector< std::string > events( 1000 );
+        std::atomic< long > n_elements( 0 );
+        std::atomic< long > n_errors( 0 );
+        cljp::ParserBase::Status status = cljp::parse_elements_unordered( array.data(), array.data() + array.size(),
+                [&]( cljp::RecordParser & r_parser, size_t index ) {
+                    ++n_elements;
+                    if( index >= events.size() ||
+                            read_events( r_parser, &events[index] ) != cljp::ParserBase::PS_END_OF_MESSAGE )
+                        ++n_errors;
+                },
+                options( 4, chunk_sizes[i] ) );
+        TTEST( status == cljp::ParserBase::PS_OK );
+        TTEST( n_elements == 1000 );
+        TTEST( n_errors == 0 );
+        TTEST( events == expected );
+    }
+
+    TDOC( "Empty array" );
+    std::string empty( " [ \n ] " );
+    std::atomic< long > n_elements( 0 );
+    cljp::ReaderString reader( empty );
+    TTEST( cljp::parse_elements_unordered( reader, [&]( cljp::RecordParser &, size_t ) { ++n_elements; } ) ==
+                cljp::ParserBase::PS_OK );
+    TTEST( n_elements == 0 );
+}
+
+TFEATURE( "parse_elements_ordered()" )
+{
+    std::string array = elements( 1000 );
+    std::vector< std::string > expected = sequential_elements( array );
+    const size_t chunk_sizes[] = { 1, 7, 64, 1000000 };
+
+    for( size_t i = 0; i < sizeof( chunk_sizes ) / sizeof( chunk_sizes[0] ); ++i )
+    {
+        std::vector< std::string > events;
+        std::vector< size_t > indexes;
+        cljp::ReaderString reader( array );
+        cljp::ParserBase::Status status = cljp::parse_elements_ordered< std::string >( reader,
+                []( cljp::RecordParser & r_parser, size_t ) {
+                    std::string element_events;
+                    read_events( r_parser, &element_events );
+                    return element_events;
+                },
+                [&]( std::string & r_events, size_t index ) { events.push_back( r_events ); indexes.push_back( index ); },
+                options( 3, chunk_sizes[i] ) );
+        TTEST( status == cljp::ParserBase::PS_OK );
+        TTEST( events == expected );
+
+        bool is_in_order = indexes.size() == 1000;
+        for( size_t j = 0; j < indexes.size() && is_in_order; ++j )
+            is_in_order = indexes[j] == j;
+        TTEST( is_in_order );
+    }
+
+    TDOC( "Single elements" );
+    std::vector< std::string > events;
+    TTEST( elements_status( "[1]", &events ) == cljp::ParserBase::PS_OK );
+    TTEST( events == sequential_elements( "[1]" ) );
+    TTEST( elements_status( "[\"\\\\\"]", &events ) == cljp::ParserBase::PS_OK );
+    TTEST( events == sequential_elements( "[\"\\\\\"]" ) && events[0].find( "=\\;" ) != std::string::npos );
+    TTEST( elements_status( "[[]]", &events ) == cljp::ParserBase::PS_OK );
+    TTEST( events == sequential_elements( "[[]]" ) && events.size() == 1 );
+}
+
+TFEATURE( "parse_elements_...() - errors" )
+{
+    TTEST( elements_status( "" ) != cljp::ParserBase::PS_OK );
+    TTEST( elements_status( "[" ) != cljp::ParserBase::PS_OK );
+    TTEST( elements_status( "[1,,2]" ) != cljp::ParserBase::PS_OK );
+    TTEST( elements_status( "[1,2,]" ) != cljp::ParserBase::PS_OK );
+    TTEST( elements_status( "[,]" ) != cljp::ParserBase::PS_OK );
+    TTEST( elements_status( "[1]]" ) != cljp::ParserBase::PS_OK );
+    TTEST( elements_status( "[[1]" ) != cljp::ParserBase::PS_OK );
+    TTEST( elements_status( "[\"a]" ) != cljp::ParserBase::PS_OK );
+    TTEST( elements_status( "[{\"a\":1]}]" ) != cljp::ParserBase::PS_OK );
+
+    TDOC( "More than one value in an element" );
+    TTEST( elements_status( "[1 2]" ) == cljp::ParserBase::PS_EXPECTED_COMMA_OR_END_OF_ARRAY );
+    TTEST( elements_status( "[{\"a\":1} {\"b\":2}]" ) == cljp::ParserBase::PS_EXPECTED_COMMA_OR_END_OF_ARRAY );
+    TTEST( elements_status( "[3,[1] \"x\",4]" ) == cljp::ParserBase::PS_EXPECTED_COMMA_OR_END_OF_ARRAY );
+    TTEST( elements_status( "[1, 2 ,3 ]" ) == cljp::ParserBase::PS_OK );
+    TTEST( elements_status( "[tru]" ) == cljp::ParserBase::PS_BAD_FORMAT_TRUE );
+
+    {
+    TDOC( "Found when func doesn't read its whole element" );
+    std::string array( "[[1,2],{\"a\":3} 4]" );
+    cljp::ParserBase::Status status = cljp::parse_elements_unordered( array.data(), array.data() + array.size(),
+            []( cljp::RecordParser & r_parser, size_t ) {
+                cljp::Event event;
+                r_parser.get( &event );
+            },
+            options( 2, 2 ) );
+    TTEST( status == cljp::ParserBase::PS_EXPECTED_COMMA_OR_END_OF_ARRAY );
+    }
+
+    TDOC( "Not a single array" );
+    TTEST( elements_status( "{}" ) == cljp::ParserBase::PS_NOT_A_SINGLE_ARRAY );
+    TTEST( elements_status( "1" ) == cljp::ParserBase::PS_NOT_A_SINGLE_ARRAY );
+    TTEST( elements_status( "[1] [2]" ) == cljp::ParserBase::PS_NOT_A_SINGLE_ARRAY );
+    TTEST( elements_status( "[1] 2" ) == cljp::ParserBase::PS_NOT_A_SINGLE_ARRAY );
+}
+
+TFEATURE( "Parallel parsing - exceptions" )
+{
+    std::string ndjson = records( 1000 );
+
+    bool is_thrown = false;
+    try
+    {
+        cljp::parse_records_unordered( ndjson.data(), ndjson.data() + ndjson.size(),
+                []( cljp::RecordParser & r_parser, size_t ) {
+                    if( record_n( r_parser ) == 500 )
+                        throw std::runtime_error( "map" );
+                },
+                options( 4, 64 ) );
+    }
+    catch( std::runtime_error & )
+    {
+        is_thrown = true;
+    }
+    TTEST( is_thrown );
+
+    is_thrown = false;
+    try
+    {
+        cljp::parse_records_ordered< int >( ndjson.data(), ndjson.data() + ndjson.size(),
+                []( cljp::RecordParser & r_parser, size_t ) {
+                    int n = record_n( r_parser );
+                    if( n == 500 )
+                        throw std::runtime_error( "map" );
+                    return n;
+                },
+                []( int, size_t ) {},
+                options( 4, 64 ) );
+    }
+    catch( std::runtime_error & )
+    {
+        is_thrown = true;
+    }
+    TTEST( is_thrown );
+
+    is_thrown = false;
+    try
+    {
+        cljp::parse_records_ordered< int >( ndjson.data(), ndjson.data() + ndjson.size(),
+                []( cljp::RecordParser & r_parser, size_t ) { return record_n( r_parser ); },
+                []( int n, size_t ) {
+                    if( n == 10 )
+                        throw std::runtime_error( "consume" );
+                },
+                options( 4, 64 ) );
+    }
+    catch( std::runtime_error & )
+    {
+        is_thrown = true;
+    }
+    TTEST( is_thrown );
+}
@@ -363,6 +363,144 @@ TFEATURE( "Parser Reading number values" )
     number_fail_test( __LINE__, "1e+ " );
 }
 
+TFEATURE( "Parser Reading number values records integer details" )
+{
+    {
+    Harness h( "[ 9007199254740993, -9223372036854775808, 18446744073709551615, "
+                "18446744073709551616, 1.5, 1e3, 0 ]" );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.flags == cljp::Event::F_PARSED );
+    TTEST( h.event.int_magnitude == UINT64_C( 9007199254740993 ) );
+    TTEST( h.event.to_int64() == INT64_C( 9007199254740993 ) );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.flags == (cljp::Event::F_PARSED | cljp::Event::F_MINUS) );
+    TTEST( h.event.to_int64() == -INT64_C( 9223372036854775807 ) - 1 );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.int_magnitude == UINT64_C( 18446744073709551615 ) );
+    TTEST( h.event.to_uint64() == UINT64_C( 18446744073709551615 ) );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( (h.event.flags & cljp::Event::F_INT_OVERFLOW) != 0 );
+    TTEST( h.event.to_uint64() == UINT64_C( 18446744073709551615 ) );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.flags == (cljp::Event::F_PARSED | cljp::Event::F_FRAC) );
+    TTEST( h.event.to_int64() == 1 );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.flags == (cljp::Event::F_PARSED | cljp::Event::F_EXP) );
+    TTEST( h.event.to_int64() == 1000 );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.flags == cljp::Event::F_PARSED );
+    TTEST( h.event.to_int64() == 0 );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.is_array_end() );
+    TTEST( h.event.flags == 0 );
+    }
+}
+
+TFEATURE( "Parser Reading values records classification flags" )
+{
+    Harness h( "[ true, false, null, 12, -1.5, 2e3, \"true\" ]" );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.flags == (cljp::Event::F_PARSED | cljp::Event::F_TRUE) );
+    TTEST( h.event.is_true() );
+    TTEST( ! h.event.is_false() );
+    TTEST( h.event.to_bool() );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.flags == cljp::Event::F_PARSED );
+    TTEST( ! h.event.is_true() );
+    TTEST( h.event.is_false() );
+    TTEST( ! h.event.to_bool() );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.is_null() );
+    TTEST( ! h.event.is_true() );
+    TTEST( ! h.event.is_false() );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.is_int() );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.flags == (cljp::Event::F_PARSED | cljp::Event::F_MINUS | cljp::Event::F_FRAC) );
+    TTEST( ! h.event.is_int() );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( ! h.event.is_int() );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.is_string() );
+    TTEST( ! h.event.is_true() );
+    TTEST( ! h.event.is_int() );
+}
+
+void float_value_test(
+        int test_line,
+        const char * p_input,
+        double expected_value )
+{
+    char c_doc[256];
+    sprintf( c_doc, "Line: %d, input: %s", test_line, p_input );
+    TDOC( c_doc );
+
+    std::string composed_input( "[" );
+    composed_input.append( p_input );
+
+    Harness h( composed_input );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.float_value == expected_value );
+    TTEST( h.event.to_float() == expected_value );
+}
+
+TFEATURE( "Parser Reading number values records float value" )
+{
+    float_value_test( __LINE__, "0", 0.0 );
+    float_value_test( __LINE__, "-1", -1.0 );
+    float_value_test( __LINE__, "0.1", 0.1 );
+    float_value_test( __LINE__, "-12.12e-12", -12.12e-12 );
+    float_value_test( __LINE__, "0.000123", 0.000123 );
+    float_value_test( __LINE__, "1e23", 1e23 );
+    float_value_test( __LINE__, "9007199254740993", 9007199254740992.0 );    // Ties to even
+    float_value_test( __LINE__, "9007199254740995", 9007199254740996.0 );
+    float_value_test( __LINE__, "1.7976931348623157e308", 1.7976931348623157e308 );
+    float_value_test( __LINE__, "2.2250738585072011e-308", 2.2250738585072011e-308 );  // Subnormal
+    float_value_test( __LINE__, "4.9406564584124654e-324", 4.9406564584124654e-324 );
+    float_value_test( __LINE__, "1e-400", 0.0 );
+
+    TDOC( "More than 19 significant digits" );
+    float_value_test( __LINE__, "123456789012345678901234567890", 123456789012345678901234567890.0 );
+    float_value_test( __LINE__, "0.1000000000000000000000000001", 0.1 );
+    float_value_test( __LINE__, "1.00000000000000011102230246251565404236316680908203125", 1.0 );   // Ties to even
+    float_value_test( __LINE__, "1.00000000000000011102230246251565404236316680908203126", 1.0000000000000002 );
+    float_value_test( __LINE__, "1.00000000000000011102230246251565404236316680908203124", 1.0 );
+
+    {
+    TDOC( "Infinities and negative zero" );
+    Harness h( "[ 1e400, -1e400, -0 ]" );
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.to_float() > 1.7976931348623157e308 );
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.to_float() < -1.7976931348623157e308 );
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.to_float() == 0.0 );
+    TTEST( 1.0 / h.event.to_float() < 0.0 );    // -0.0
+    }
+}
+
 TFEATURE( "Parser Back-to-back numbers" )
 {
     {
@@ -478,6 +616,26 @@ TFEATURE( "Parser Reading string values" )
 
     TDOC( "Parser::get_string() - char outside unescaped = %x20-21 / %x23-5B / %x5D-10FFFF fails" );
     string_fail_test( __LINE__, "Say \x01 Fred", cljp::Parser::PS_BAD_FORMAT_STRING );
+
+    TDOC( "Parser::get_string() - long strings with escapes spread through them" );
+    {
+    std::string input, expected;
+    for( size_t i = 0; i < 2000; ++i )
+    {
+        input += "Unescaped run \xc2\xa3\xe6\x97\xa5 \\n\\\"\\u00e9";
+        expected += "Unescaped run \xc2\xa3\xe6\x97\xa5 \n\"\xc3\xa9";
+    }
+    Harness h( "[\"" + input + "\", \"" + input + "\x1f\"]" );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.type == cljp::Event::T_ARRAY_START );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.type == cljp::Event::T_STRING );
+    TTEST( h.event.value == expected );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_BAD_FORMAT_STRING );
+    }
 }
 
 TFEATURE( "Parser Reading string Unicode escapes" )
@@ -675,6 +833,77 @@ TFEATURE( "Parser Read member" )
     }
 }
 
+namespace {
+
+std::string deeply_nested( size_t depth )
+{
+    // Every third level is an object, so that the parser's record of
+    // contexts has a mix of kinds
+    std::string json;
+    for( size_t i = 0; i < depth; ++i )
+        json += i % 3 == 0 ? "{\"a\":" : "[";
+    json += "1";
+    for( size_t i = depth; i > 0; --i )
+        json += (i - 1) % 3 == 0 ? "}" : ", 2]";
+    return json;
+}
+
+}   // End of anonymous namespace
+
+TFEATURE( "Parser Deep nesting" )
+{
+    const size_t depth = 1000;   // More than CLJP_INLINE_NESTING_DEPTH
+
+    Harness h( deeply_nested( depth ) + deeply_nested( depth ) );
+
+    for( int message = 0; message < 2; ++message )
+    {
+        bool is_sequence_ok = true;
+        for( size_t i = 0; i < depth; ++i )
+            is_sequence_ok &= h.parser.get( &h.event ) == cljp::Parser::PS_OK &&
+                    h.event.type == (i % 3 == 0 ? cljp::Event::T_OBJECT_START : cljp::Event::T_ARRAY_START);
+        is_sequence_ok &= h.parser.get( &h.event ) == cljp::Parser::PS_OK && h.event.value == "1";
+        for( size_t i = depth; i > 0; --i )
+        {
+            if( (i - 1) % 3 == 0 )
+                is_sequence_ok &= h.parser.get( &h.event ) == cljp::Parser::PS_OK &&
+                        h.event.type == cljp::Event::T_OBJECT_END;
+            else
+                is_sequence_ok &= h.parser.get( &h.event ) == cljp::Parser::PS_OK && h.event.value == "2" &&
+                        h.parser.get( &h.event ) == cljp::Parser::PS_OK && h.event.type == cljp::Event::T_ARRAY_END;
+        }
+        TTEST( is_sequence_ok );
+        TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_END_OF_MESSAGE );
+
+        h.parser.new_message();
+    }
+
+    {
+    TDOC( "Mismatched close deep in the nesting" );
+    std::string json = deeply_nested( depth );
+    json[json.find( '}' )] = ']';
+    Harness h( json );
+
+    cljp::Parser::Status status;
+    while( (status = h.parser.get( &h.event )) == cljp::Parser::PS_OK )
+    {}
+    TTEST( status == cljp::Parser::PS_UNEXPECTED_ARRAY_CLOSE );
+    }
+
+    {
+    TDOC( "skip() from deep in the nesting" );
+    Harness h( deeply_nested( depth ) );
+
+    for( size_t i = 0; i < depth - 2; ++i )
+        h.parser.get( &h.event );
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.is_array_start() );
+    TTEST( h.parser.skip() == cljp::Parser::PS_OK );
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.value == "2" );
+    }
+}
+
 TFEATURE( "Parser::skip()" )
 {
     {
@@ -803,3 +1032,109 @@ TFEATURE( "Parser::skip()" )
     TTEST( h.event.name == "Spread" );
     }
 }
+
+template< typename Tparser >
+bool is_skip_as_expected(
+        Tparser & parser,
+        size_t n_gets_before_skip,
+        cljp::Parser::Status expected_status,
+        const char * p_expected_next_value )
+{
+    cljp::Event event;
+    for( size_t i = 0; i < n_gets_before_skip; ++i )
+        if( parser.get( &event ) != cljp::Parser::PS_OK )
+            return false;
+
+    if( parser.skip() != expected_status )
+        return false;
+    if( expected_status != cljp::Parser::PS_OK )
+        return parser.get( &event ) == cljp::Parser::PS_UNABLE_TO_CONTINUE_DUE_TO_ERRORS;
+    if( ! p_expected_next_value )
+        return parser.get( &event ) == cljp::Parser::PS_END_OF_MESSAGE;
+    return parser.get( &event ) == cljp::Parser::PS_OK && event.value == p_expected_next_value;
+}
+
+void skip_test(
+        int test_line,
+        const char * p_input,
+        size_t n_gets_before_skip,
+        cljp::Parser::Status expected_status,
+        const char * p_expected_next_value )
+{
+    // p_expected_next_value is NULL if the message is expected to end
+    // after the skip()
+
+    char c_doc[256];
+    sprintf( c_doc, "Line: %d, input: %s", test_line, p_input );
+    TDOC( c_doc );
+
+    std::string json( p_input );
+
+    {
+    cljp::ReaderString reader( json );
+    cljp::Parser parser( reader );
+    TTEST( is_skip_as_expected( parser, n_gets_before_skip, expected_status, p_expected_next_value ) );
+    }
+
+    {
+    cljp::ReaderString reader( json );
+    IndexedParser< cljp::Parser > parser( reader );
+    TTEST( is_skip_as_expected( parser, n_gets_before_skip, expected_status, p_expected_next_value ) );
+    }
+
+    {
+    ReaderGetOnly reader( json );     // Has no blocks of input, so skip() reads a character at a time
+    cljp::Parser parser( reader );
+    TTEST( is_skip_as_expected( parser, n_gets_before_skip, expected_status, p_expected_next_value ) );
+    }
+}
+
+TFEATURE( "Parser::skip() scanning the input" )
+{
+    skip_test( __LINE__, "[1,2,3]", 1, cljp::Parser::PS_OK, 0 );
+    skip_test( __LINE__, "[[1,2,3],4]", 2, cljp::Parser::PS_OK, "4" );
+    skip_test( __LINE__, "[ [ 1 , 2 , 3 ] , 4 ]", 2, cljp::Parser::PS_OK, "4" );
+    skip_test( __LINE__, "[[],4]", 2, cljp::Parser::PS_OK, "4" );
+    skip_test( __LINE__, "[{},4]", 2, cljp::Parser::PS_OK, "4" );
+    skip_test( __LINE__, "[{\"a\":[{},[]]},4]", 2, cljp::Parser::PS_OK, "4" );
+    skip_test( __LINE__, "[[1,[2,[3]]],4]", 3, cljp::Parser::PS_OK, "4" );
+
+    TDOC( "Brackets and quotes in strings" );
+    skip_test( __LINE__, "[[\"]\"],4]", 2, cljp::Parser::PS_OK, "4" );
+    skip_test( __LINE__, "[{\"}\":\"{[\"},4]", 2, cljp::Parser::PS_OK, "4" );
+    skip_test( __LINE__, "[[\"\\\"]\"],4]", 2, cljp::Parser::PS_OK, "4" );
+    skip_test( __LINE__, "[[\"\\\\\"],4]", 2, cljp::Parser::PS_OK, "4" );
+    skip_test( __LINE__, "[[\"\\\\\",\"]\"],4]", 2, cljp::Parser::PS_OK, "4" );
+    skip_test( __LINE__, "[[\"\\n]\"],4]", 2, cljp::Parser::PS_OK, "4" );
+    skip_test( __LINE__, "[[\"\\u005D]\"],4]", 2, cljp::Parser::PS_OK, "4" );
+    skip_test( __LINE__, "[[\"\xc2\xa3]\"],4]", 2, cljp::Parser::PS_OK, "4" );
+
+    TDOC( "Long runs are scanned many bytes at a time" );
+    for( int i = 0; i < 2; ++i )
+    {
+        UseUTF8Validator use_validator( i == 0 ? cljp::ReadUTF8Base::UV_SCALAR : cljp::ReadUTF8Base::utf8_validator() );
+
+        bool is_all_ok = true;
+        for( size_t n_pad = 0; n_pad < 40; ++n_pad )
+        {
+            std::string pad( n_pad, 'x' );
+            std::string json = "[[\"" + pad + "\\\"]" + pad + "\\\\\",{\"" + pad + "\":[1]}," + pad + "],4]";
+            cljp::ReaderString reader( json );
+            cljp::Parser parser( reader );
+            is_all_ok &= is_skip_as_expected( parser, 2, cljp::Parser::PS_OK, "4" );
+        }
+        TTEST( is_all_ok );
+    }
+
+    TDOC( "Values aren't checked when skipped" );
+    skip_test( __LINE__, "[[fals, 1.2.3, nul],4]", 2, cljp::Parser::PS_OK, "4" );
+    skip_test( __LINE__, "[[\"\\q\"],4]", 2, cljp::Parser::PS_OK, "4" );
+
+    TDOC( "Errors" );
+    skip_test( __LINE__, "[[1,2}", 2, cljp::Parser::PS_UNEXPECTED_OBJECT_CLOSE, 0 );
+    skip_test( __LINE__, "[{\"a\":1]", 2, cljp::Parser::PS_UNEXPECTED_ARRAY_CLOSE, 0 );
+    skip_test( __LINE__, "[[[1],2}", 2, cljp::Parser::PS_UNEXPECTED_OBJECT_CLOSE, 0 );
+    skip_test( __LINE__, "[[1,2", 2, cljp::Parser::PS_UNEXPECTED_END_OF_MESSAGE, 0 );
+    skip_test( __LINE__, "[[\"]\\\"]", 2, cljp::Parser::PS_UNEXPECTED_END_OF_MESSAGE, 0 );
+    skip_test( __LINE__, "[[\"\xc0\x80\"],4]", 2, cljp::Parser::PS_UNEXPECTED_END_OF_MESSAGE, 0 );
+}
@@ -0,0 +1,255 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull-prefetch.h"  // Put file under test first to verify dependencies
+
+#include "clunit.h"
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+namespace {
+
+class ReaderSource : public cljp::Reader    // A get() only reader that can be endless or fail part way
+{
+public:
+    enum { endless = -1 };
+
+private:
+    std::string in;
+    size_t pos;
+    long fail_at;
+
+public:
+    ReaderSource( const std::string & r_in, long fail_at_in = 0 ) : in( r_in ), pos( 0 ), fail_at( fail_at_in ) {}
+
+private:
+    virtual int do_get()
+    {
+        if( fail_at > 0 && pos == static_cast< size_t >( fail_at ) )
+            throw std::runtime_error( "source" );
+        if( fail_at == endless )
+            return in[pos++ % in.size()];
+        if( pos < in.size() )
+            return static_cast< unsigned char >( in[pos++] );
+        return EOM;
+    }
+    virtual void do_rewind() { pos = 0; }
+};
+
+std::string letters( size_t size )
+{
+    std::string in;
+    for( size_t i = 0; i < size; ++i )
+        in += static_cast< char >( 'a' + i % 26 );
+    return in;
+}
+
+std::string read_all( cljp::Reader & r_reader )
+{
+    std::string out;
+    const char * p_block = 0;
+    while( size_t n_bytes = r_reader.peek( &p_block ) )
+    {
+        out.append( p_block, n_bytes );
+        r_reader.consume( n_bytes );
+    }
+    return out;
+}
+
+}   // End of anonymous namespace
+
+TFEATURE( "class ReaderPrefetch" )
+{
+    std::string in( "ab\xf2" );
+    ReaderSource source( in );
+    cljp::ReaderPrefetch reader( source );
+
+    TTEST( reader.block_size() == cljp::ReaderPrefetch::default_block_size );
+    TTEST( reader.n_blocks() == cljp::ReaderPrefetch::default_n_blocks );
+
+    TTEST( reader.get() == 'a' );
+    const char * p_block = 0;
+    TTEST( reader.peek( &p_block ) == 2 );
+    TTEST( std::string( p_block, 2 ) == "b\xf2" );
+    TTEST( reader.peek( &p_block ) == 2 );     // peek() doesn't consume anything
+    reader.consume( 1 );
+    TTEST( reader.get() == 0xf2 );
+    TTEST( reader.peek( &p_block ) == 0 );
+    TTEST( reader.get() == cljp::Reader::EOM );
+    TTEST( reader.get() == cljp::Reader::EOM );
+
+    TDOC( "Rewind" );
+    reader.rewind();
+    TTEST( reader.get() == 'a' );
+    reader.rewind();
+    TTEST( read_all( reader ) == in );
+
+    TDOC( "Empty input" );
+    ReaderSource empty_source( "" );
+    cljp::ReaderPrefetch empty_reader( empty_source );
+    TTEST( empty_reader.peek( &p_block ) == 0 );
+    TTEST( empty_reader.get() == cljp::Reader::EOM );
+}
+
+TFEATURE( "class ReaderPrefetch - Block sizes" )
+{
+    ReaderSource empty_source( "" );
+    TTEST( cljp::ReaderPrefetch( empty_source, 0, 0 ).block_size() == 1 );
+
+    std::string in = letters( 3 * cljp::ReaderPrefetch::default_block_size + 17 );
+    const size_t block_sizes[] = { 1, 7, 4096, cljp::ReaderPrefetch::default_block_size };
+    const size_t n_blocks[] = { 1, 2, 4 };
+
+    for( size_t i = 0; i < sizeof( block_sizes ) / sizeof( block_sizes[0] ); ++i )
+        for( size_t j = 0; j < sizeof( n_blocks ) / sizeof( n_blocks[0] ); ++j )
+        {
+            ReaderSource source( in );
+            cljp::ReaderPrefetch reader( source, block_sizes[i], n_blocks[j] );
+            TTEST( reader.n_blocks() == std::max( n_blocks[j], size_t( 2 ) ) );
+
+            std::string out;
+            bool is_block_size_ok = true;
+            const char * p_block = 0;
+            while( size_t n_bytes = reader.peek( &p_block ) )
+            {
+                is_block_size_ok = is_block_size_ok && n_bytes <= block_sizes[i];
+                out.append( p_block, n_bytes );
+                reader.consume( n_bytes );
+            }
+            TTEST( is_block_size_ok );
+            TTEST( out == in );
+        }
+}
+
+TFEATURE( "class ReaderPrefetch - Parsing" )
+{
+    const char * p_test_file_name = "Reader-test-prefetch.json";
+
+    {
+    std::ofstream fout( p_test_file_name );
+    TCRITICALTEST( fout.is_open() );
+
+    fout << "{ \"Field\" : [ 12, \"High\" ], \"Jam\" : true }\n[ \"a\\nb\" ]";
+    }
+
+    cljp::ReaderFile file( p_test_file_name, 5 );
+    TCRITICALTEST( file.is_open() );
+    cljp::ReaderPrefetch reader( file, 3 );
+
+    for( int pass = 0; pass < 2; ++pass )   // Make sure rewind() gives the same result
+    {
+        cljp::Parser parser( reader );
+        cljp::Event event;
+
+        TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+        TTEST( event.type == cljp::Event::T_OBJECT_START );
+        TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+        TTEST( event.type == cljp::Event::T_ARRAY_START );
+        TTEST( event.name == "Field" );
+        TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+        TTEST( event.value == "12" );
+        TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+        TTEST( event.value == "High" );
+        TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+        TTEST( event.type == cljp::Event::T_ARRAY_END );
+        TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+        TTEST( event.name == "Jam" );
+        TTEST( event.is_true() );
+        TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+        TTEST( event.type == cljp::Event::T_OBJECT_END );
+        TTEST( parser.get( &event ) == cljp::Parser::PS_END_OF_MESSAGE );
+
+        parser.new_message();
+        TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+        TTEST( event.type == cljp::Event::T_ARRAY_START );
+        TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+        TTEST( event.value == "a\nb" );
+        TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+        TTEST( event.type == cljp::Event::T_ARRAY_END );
+        TTEST( parser.get( &event ) == cljp::Parser::PS_END_OF_MESSAGE );
+
+        reader.rewind();
+    }
+}
+
+TFEATURE( "class ReaderPrefetch - Stopping early" )
+{
+    {
+    TDOC( "Destroyed part way through an endless source" );
+    ReaderSource source( "[1,2,", ReaderSource::endless );
+    cljp::ReaderPrefetch reader( source, 64, 2 );
+    cljp::Parser parser( reader );
+    cljp::Event event;
+    cljp::Parser::Status status = cljp::Parser::PS_OK;
+    for( int i = 0; i < 100 && status == cljp::Parser::PS_OK; ++i )
+        status = parser.get( &event );
+    TTEST( status == cljp::Parser::PS_OK );
+    }
+
+    {
+    TDOC( "Destroyed before anything is read" );
+    ReaderSource source( "[1,2,", ReaderSource::endless );
+    cljp::ReaderPrefetch reader( source, 64, 2 );
+    }
+
+    {
+    TDOC( "Rewound part way through an endless source" );
+    ReaderSource source( "abc", ReaderSource::endless );
+    cljp::ReaderPrefetch reader( source, 7, 2 );
+    for( int i = 0; i < 1000; ++i )
+        reader.get();
+    reader.rewind();
+    TTEST( reader.get() == 'a' );
+    }
+
+    TDOC( "Exceptions thrown by the source" );
+    std::string in = letters( 1000 );
+    ReaderSource source( in, 500 );
+    cljp::ReaderPrefetch reader( source, 64, 2 );
+    std::string out;
+    bool is_thrown = false;
+    try
+    {
+        for( int c = reader.get(); c != cljp::Reader::EOM; c = reader.get() )
+            out += static_cast< char >( c );
+    }
+    catch( std::runtime_error & )
+    {
+        is_thrown = true;
+    }
+    TTEST( is_thrown );
+    TTEST( out == in.substr( 0, 500 ) );
+}
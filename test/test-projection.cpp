@@ -0,0 +1,320 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull.h"   // Put file under test first to verify dependencies
+
+#include "clunit.h"
+
+#include "test-harness.h"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector< std::string > path( const char * p_s0 = 0, const char * p_s1 = 0, const char * p_s2 = 0 )
+{
+    std::vector< std::string > segments;
+    if( p_s0 )
+        segments.push_back( p_s0 );
+    if( p_s1 )
+        segments.push_back( p_s1 );
+    if( p_s2 )
+        segments.push_back( p_s2 );
+    return segments;
+}
+
+cljp::Projection make_projection( const char * p_paths )
+{
+    // p_paths is space separated, or NULL for no paths
+    cljp::Projection projection;
+    if( ! p_paths )
+        return projection;
+    std::string paths( p_paths );
+    size_t begin = 0;
+    do
+    {
+        size_t end = paths.find( ' ', begin );
+        if( end == std::string::npos )
+            end = paths.size();
+        projection.add( paths.substr( begin, end - begin ) );
+        begin = end + 1;
+    }
+    while( begin <= paths.size() );
+    return projection;
+}
+
+template< typename Tevent, typename Tparser >
+std::string events_text( Tparser & r_parser )
+{
+    // A compact description of the events returned, such as
+    // '{ a:[ 1 "x" ] }', followed by the status if it is an error
+
+    std::string text;
+    Tevent event;
+    typename Tparser::Status status;
+    while( (status = r_parser.get( &event )) == Tparser::PS_OK )
+    {
+        if( ! text.empty() )
+            text += ' ';
+        if( ! event.name.empty() )
+            text += std::string( event.name.data(), event.name.size() ) + ':';
+        if( event.is_object_start() )
+            text += '{';
+        else if( event.is_object_end() )
+            text += '}';
+        else if( event.is_array_start() )
+            text += '[';
+        else if( event.is_array_end() )
+            text += ']';
+        else if( event.is_string() )
+            text += '"' + std::string( event.value.data(), event.value.size() ) + '"';
+        else
+            text += std::string( event.value.data(), event.value.size() );
+    }
+    if( status != Tparser::PS_END_OF_MESSAGE )
+    {
+        char c_status[32];
+        sprintf( c_status, " !%d", static_cast< int >( status ) );
+        text += c_status;
+    }
+    return text;
+}
+
+void projection_test(
+        int test_line,
+        const char * p_input,
+        const char * p_paths,
+        const char * p_expected )
+{
+    char c_doc[256];
+    sprintf( c_doc, "Line: %d, input: %s, paths: %s", test_line, p_input, p_paths ? p_paths : "(none)" );
+    TDOC( c_doc );
+
+    std::string json( p_input );
+    cljp::Projection projection = make_projection( p_paths );
+
+    {
+    cljp::ReaderString reader( json );
+    cljp::Parser parser( reader );
+    parser.use_projection( &projection );
+    TTEST( events_text< cljp::Event >( parser ) == p_expected );
+    }
+
+    {
+    cljp::ReaderString reader( json );
+    cljp::Parser parser( reader );
+    parser.use_projection( &projection );
+    TTEST( events_text< cljp::EventView >( parser ) == p_expected );
+    }
+
+    {
+    cljp::ReaderString reader( json );
+    IndexedParser< cljp::BasicParser< cljp::ReaderMemory > > parser( reader );
+    parser.use_projection( &projection );
+    TTEST( events_text< cljp::Event >( parser ) == p_expected );
+    }
+}
+
+const char * p_order =
+        "{\"user\":{\"id\":7,\"name\":\"Jo\",\"tags\":[\"a\",\"b\"]},"
+        "\"items\":[{\"price\":1.5,\"qty\":2},{\"qty\":1,\"price\":3}],"
+        "\"notes\":\"x\\\"}]\",\"total\":4.5}";
+
+}   // End of anonymous namespace
+
+TFEATURE( "Projection::add()" )
+{
+    cljp::Projection projection;
+    TTEST( projection.size() == 0 );
+
+    TTEST( projection.add( "" ) );
+    TTEST( projection.add( "/user/id" ) );
+    TTEST( projection.add( "/items/*/price" ) );
+    TTEST( projection.add( "/" ) );
+    TTEST( projection.add( "/a~1b/c~0d" ) );
+    TTEST( projection.size() == 5 );
+
+    TDOC( "Invalid paths" );
+    TTEST( ! projection.add( "user" ) );
+    TTEST( ! projection.add( "/a~" ) );
+    TTEST( ! projection.add( "/a~2" ) );
+    TTEST( projection.size() == 5 );
+
+    projection.clear();
+    TTEST( projection.size() == 0 );
+}
+
+TFEATURE( "Projection::match()" )
+{
+    cljp::Projection projection;
+    TTEST( projection.match( path() ) == cljp::Projection::M_NONE );
+
+    projection.add( "/user/id" );
+    projection.add( "/items/*/price" );
+    projection.add( "/a~1b" );
+
+    TTEST( projection.match( path() ) == cljp::Projection::M_ANCESTOR );
+    TTEST( projection.match( path( "user" ) ) == cljp::Projection::M_ANCESTOR );
+    TTEST( projection.match( path( "user", "id" ) ) == cljp::Projection::M_SELECTED );
+    TTEST( projection.match( path( "user", "name" ) ) == cljp::Projection::M_NONE );
+    TTEST( projection.match( path( "items", "3" ) ) == cljp::Projection::M_ANCESTOR );
+    TTEST( projection.match( path( "items", "3", "price" ) ) == cljp::Projection::M_SELECTED );
+    TTEST( projection.match( path( "items", "3", "qty" ) ) == cljp::Projection::M_NONE );
+    TTEST( projection.match( path( "a/b" ) ) == cljp::Projection::M_SELECTED );
+    TTEST( projection.match( path( "a/b", "c" ) ) == cljp::Projection::M_SELECTED );
+    TTEST( projection.match( path( "other" ) ) == cljp::Projection::M_NONE );
+
+    projection.add( "" );
+    TTEST( projection.match( path( "other" ) ) == cljp::Projection::M_SELECTED );
+}
+
+TFEATURE( "Projection::match() - overlapping paths" )
+{
+    cljp::Projection projection;
+    projection.add( "/a/x" );
+    projection.add( "/*/y" );
+    projection.add( "/b/*/z" );
+    projection.add( "/b/2/w" );
+
+    TTEST( projection.match( path( "a" ) ) == cljp::Projection::M_ANCESTOR );
+    TTEST( projection.match( path( "a", "x" ) ) == cljp::Projection::M_SELECTED );
+    TTEST( projection.match( path( "a", "y" ) ) == cljp::Projection::M_SELECTED );
+    TTEST( projection.match( path( "a", "z" ) ) == cljp::Projection::M_NONE );
+    TTEST( projection.match( path( "c", "x" ) ) == cljp::Projection::M_NONE );
+    TTEST( projection.match( path( "c", "y" ) ) == cljp::Projection::M_SELECTED );
+    TTEST( projection.match( path( "b", "y" ) ) == cljp::Projection::M_SELECTED );
+    TTEST( projection.match( path( "b", "2", "z" ) ) == cljp::Projection::M_SELECTED );
+    TTEST( projection.match( path( "b", "2", "w" ) ) == cljp::Projection::M_SELECTED );
+    TTEST( projection.match( path( "b", "3", "w" ) ) == cljp::Projection::M_NONE );
+    TTEST( projection.match( path( "b", "3", "z" ) ) == cljp::Projection::M_SELECTED );
+
+    TDOC( "Adding a path after matching rebuilds the automaton" );
+    projection.add( "/c/x" );
+    TTEST( projection.match( path( "c", "x" ) ) == cljp::Projection::M_SELECTED );
+}
+
+TFEATURE( "Projection::match() - many paths" )
+{
+    cljp::Projection projection;
+    for( int i = 0; i < 1000; ++i )
+    {
+        char c_path[32];
+        sprintf( c_path, "/*/unused_%d", i );
+        projection.add( c_path );
+    }
+    projection.add( "/*/id" );
+    projection.compile();
+
+    TTEST( projection.match( path( "7", "id" ) ) == cljp::Projection::M_SELECTED );
+    TTEST( projection.match( path( "7", "unused_999" ) ) == cljp::Projection::M_SELECTED );
+    TTEST( projection.match( path( "7", "unused_1000" ) ) == cljp::Projection::M_NONE );
+    TTEST( projection.match( path( "7" ) ) == cljp::Projection::M_ANCESTOR );
+}
+
+TFEATURE( "Parser with a Projection" )
+{
+    projection_test( __LINE__, p_order, "/user/id", "{ user:{ id:7 } }" );
+    projection_test( __LINE__, p_order, "/user/id /total", "{ user:{ id:7 } total:4.5 }" );
+    projection_test( __LINE__, p_order, "/items/*/price", "{ items:[ { price:1.5 } { price:3 } ] }" );
+    projection_test( __LINE__, p_order, "/items/1/price", "{ items:[ { price:3 } ] }" );
+    projection_test( __LINE__, p_order, "/items/1", "{ items:[ { qty:1 price:3 } ] }" );
+    projection_test( __LINE__, p_order, "/user/tags/1", "{ user:{ tags:[ \"b\" ] } }" );
+    projection_test( __LINE__, p_order, "/*/id", "{ user:{ id:7 } items:[ ] }" );
+    projection_test( __LINE__, p_order, "/*/*/price", "{ user:{ tags:[ ] } items:[ { price:1.5 } { price:3 } ] }" );
+    projection_test( __LINE__, p_order, "/notes/x /total/0", "{ }" );
+    projection_test( __LINE__, p_order, "/notes", "{ notes:\"x\"}]\" }" );
+
+    TDOC( "Selecting a whole object or array" );
+    projection_test( __LINE__, p_order, "/user", "{ user:{ id:7 name:\"Jo\" tags:[ \"a\" \"b\" ] } }" );
+    projection_test( __LINE__, p_order, "/user /user/id", "{ user:{ id:7 name:\"Jo\" tags:[ \"a\" \"b\" ] } }" );
+    projection_test( __LINE__, "[[1,[2]],[3]]", "/0", "[ [ 1 [ 2 ] ] ]" );
+    projection_test( __LINE__, "[[1,[2]],[3]]", "/0/1 /1/0", "[ [ [ 2 ] ] [ 3 ] ]" );
+    projection_test( __LINE__, "[1,2]", "", "[ 1 2 ]" );
+    projection_test( __LINE__, p_order, "", "{ user:{ id:7 name:\"Jo\" tags:[ \"a\" \"b\" ] } "
+            "items:[ { price:1.5 qty:2 } { qty:1 price:3 } ] notes:\"x\"}]\" total:4.5 }" );
+
+    TDOC( "Nothing selected" );
+    projection_test( __LINE__, p_order, "/missing", "{ }" );
+    projection_test( __LINE__, "[1,2]", "/a", "[ ]" );
+    projection_test( __LINE__, p_order, 0, "" );
+    projection_test( __LINE__, "true", "/a", "" );
+
+    TDOC( "Array indexes mixed with wildcards" );
+    projection_test( __LINE__, "[{\"a\":1,\"b\":2},{\"a\":3,\"b\":4}]", "/*/a /1/b", "[ { a:1 } { a:3 b:4 } ]" );
+
+    TDOC( "Member names with escapes" );
+    projection_test( __LINE__, "{\"a\\u002Fb\":1,\"a/c\":2}", "/a~1b", "{ a/b:1 }" );
+
+    TDOC( "Skipped values aren't checked, but the structure is" );
+    projection_test( __LINE__, "{\"a\":1,\"b\":[tru, 1.2.3]}", "/a", "{ a:1 }" );
+    projection_test( __LINE__, "{\"a\":1,\"b\":[1}}", "/a", "{ a:1 !5" );
+    projection_test( __LINE__, "{\"a\":1,\"b\":[1", "/a", "{ a:1 !3" );
+    projection_test( __LINE__, "{\"a\":tru}", "/a", "{ !12" );
+
+    TDOC( "Skipped values that are missing are errors, as without a projection" );
+    projection_test( __LINE__, "{\"a\":1,\"b\":}", "/a", "{ a:1 !5" );
+    projection_test( __LINE__, "{\"a\":1,\"b\":,\"c\":2}", "/a", "{ a:1 !9" );
+    projection_test( __LINE__, "{\"a\":1,\"b\":]}", "/a", "{ a:1 !6" );
+    projection_test( __LINE__, "[1,,2]", "/0", "[ 1 !9" );
+    projection_test( __LINE__, "{\"a\":1,\"b\"::2}", "/a", "{ a:1 !9" );
+}
+
+TFEATURE( "Parser with a Projection - multiple messages" )
+{
+    Harness h( "{\"a\":1,\"b\":2} {\"b\":3,\"a\":4}" );
+    cljp::Projection projection = make_projection( "/a" );
+    h.parser.use_projection( &projection );
+    TTEST( h.parser.projection() == &projection );
+
+    TTEST( events_text< cljp::Event >( h.parser ) == "{ a:1 }" );
+    h.parser.new_message();
+    TTEST( events_text< cljp::Event >( h.parser ) == "{ a:4 }" );
+}
+
+TFEATURE( "Parser with a Projection - skip()" )
+{
+    Harness h( "{\"a\":[1,2],\"b\":[3],\"c\":5}" );
+    cljp::Projection projection = make_projection( "/a /c" );
+    h.parser.use_projection( &projection );
+
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.is_array_start() );
+    TTEST( h.parser.skip() == cljp::Parser::PS_OK );
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.name == "c" );
+    TTEST( h.parser.get( &h.event ) == cljp::Parser::PS_OK );
+    TTEST( h.event.is_object_end() );
+}
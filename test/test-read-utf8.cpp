@@ -33,8 +33,12 @@
 
 #include "clunit.h"
 
+#include "test-harness.h"
+
 #include "cl-json-pull/cl-json-pull.h"
 
+#include <vector>
+
 #define MK_STR_WITH_ZEROS( x ) std::string( (x), sizeof(x) - 1 )
 
 TFEATURE( "Test the test ByteTestSequence" )
@@ -217,6 +221,262 @@ TFEATURE( "ReadUTF8 - UTF-8 input error cases" )
     TCALL( test_utf8_get_errored( MK_STR_WITH_ZEROS( "\xEF\xBB\xBF""\0" ), 1 ) );   // Invalid UTF-8 char following BOM
 }
 
+TFEATURE( "ReadUTF8 - UTF-8 non-characters" )
+{
+    TCALL( test_utf8_get_errored( MK_STR_WITH_ZEROS( "abc\xef\xbf\xbe" ), 4 ) );    // U+FFFE
+    TCALL( test_utf8_get_errored( MK_STR_WITH_ZEROS( "a\xef\xbf\xbe" ), 2 ) );
+    TCALL( test_utf8_get_errored( MK_STR_WITH_ZEROS( "abc\xef\xbf\xbf" ), 4 ) );    // U+FFFF
+    TCALL( test_utf8_get_errored( MK_STR_WITH_ZEROS( "a\xef\xbf\xbf" ), 2 ) );
+
+    TCALL( test_utf8_get( MK_STR_WITH_ZEROS( "abc\xef\xbe\xbe" "z" ), 7, 'z' ) );    // U+FFBE is OK
+    TCALL( test_utf8_get( MK_STR_WITH_ZEROS( "a\xef\xbe\xbe" "z" ), 5, 'z' ) );
+    TCALL( test_utf8_get( MK_STR_WITH_ZEROS( "abc\xef\xbf\xbd" "z" ), 7, 'z' ) );    // U+FFFD is OK
+}
+
+template< typename Treader >
+std::string read_all_utf8( const std::string & bytes_in )
+{
+    Treader reader( bytes_in );
+    cljp::ReadUTF8 utf8_reader( reader );
+
+    std::string out;
+    int c;
+    while( (c = utf8_reader.get()) != cljp::Reader::EOM )
+        out += static_cast< char >( c );
+    return out;
+}
+
+void test_utf8_bulk( const std::string & bytes_in, const std::string & expected_in )
+{
+    TTEST( read_all_utf8< cljp::ReaderString >( bytes_in ) == expected_in );
+    TTEST( read_all_utf8< ReaderGetOnly >( bytes_in ) == expected_in );
+}
+
+TFEATURE( "ReadUTF8 - UTF-8 input validated in bulk" )
+{
+    std::string text;
+    for( size_t i = 0; i < 3000; ++i )  // Long enough to need several validation chunks
+        text += "ascii \xc2\xa3 \xe6\x97\xa5\xe6\x9c\xac \xf0\x92\x8d\x85 \xed\x9f\xbf \xef\xbf\xbd ";
+
+    TCALL( test_utf8_bulk( text, text ) );
+    TCALL( test_utf8_bulk( "\xEF\xBB\xBF" + text, text ) );
+
+    TDOC( "Input up to an invalid sequence is returned" );
+    TCALL( test_utf8_bulk( text + "\xed\xa0\x80" + text, text ) );    // Surrogate
+    TCALL( test_utf8_bulk( text + "\xc0\x80" + text, text ) );         // Overlong
+    TCALL( test_utf8_bulk( text + "\xef\xbf\xbe" + text, text ) );    // U+FFFE
+    TCALL( test_utf8_bulk( text + std::string( 1, '\0' ) + text, text ) );
+    TCALL( test_utf8_bulk( text + "\xe6\x97", text ) );                // Truncated
+
+    TDOC( "Validated input is available as a span" );
+    {
+    cljp::ReaderString reader( text );
+    cljp::ReadUTF8 utf8_reader( reader );
+
+    TTEST( utf8_reader.get() == 'a' );
+    TTEST( utf8_reader.span_begin() == utf8_reader.span_end() );  // Not validated while learning encoding
+    TTEST( utf8_reader.get() == 's' );
+    TTEST( utf8_reader.mode() == cljp::ReadUTF8::UTF8 );
+    TTEST( utf8_reader.get() == 'c' );
+    TCRITICALTEST( utf8_reader.span_end() - utf8_reader.span_begin() ==
+                    cljp::ReadUTF8::validation_chunk_size - 1 );
+    TTEST( std::string( utf8_reader.span_begin(), 4 ) == "ii \xc2" );
+    utf8_reader.span_advance_to( utf8_reader.span_begin() + 3 );
+    TTEST( utf8_reader.get() == 0xc2 );
+    TTEST( utf8_reader.get() == 0xa3 );
+    }
+}
+
+std::string utf8_validation_test_input( size_t offset, unsigned char c1, unsigned char c2, unsigned char c3, unsigned char c4 )
+{
+    std::string input( 200, 'x' );
+    input[offset] = c1;
+    input[offset+1] = c2;
+    input[offset+2] = c3;
+    input[offset+3] = c4;
+    return input;
+}
+
+void test_utf8_validator( cljp::ReadUTF8Base::UTF8Validators validator )
+{
+    static const unsigned char follow_bytes[] = { 0x00, 0x41, 0x7f, 0x80, 0x8f, 0x90, 0x9f, 0xa0, 0xbe, 0xbf, 0xc0, 0xe0, 0xf0 };
+    static const size_t n_follow_bytes = sizeof( follow_bytes ) / sizeof( follow_bytes[0] );
+    static const size_t offsets[] = { 0, 1, 31, 32, 61, 62, 63, 64, 127, 190 };
+    static const size_t n_offsets = sizeof( offsets ) / sizeof( offsets[0] );
+
+    if( ! cljp::ReadUTF8Base::is_utf8_validator_supported( validator ) )
+    {
+        TTODO( "UTF-8 validator not supported on this CPU" );
+        return;
+    }
+
+    UseUTF8Validator use_validator( validator );
+    TTEST( cljp::ReadUTF8Base::utf8_validator() == validator );
+
+    size_t n_mismatches = 0;
+    for( size_t i_offset = 0; i_offset < n_offsets; ++i_offset )
+        for( int c1 = 0x80; c1 <= 0xff; ++c1 )
+            for( size_t i2 = 0; i2 < n_follow_bytes; ++i2 )
+                for( size_t i3 = 0; i3 < n_follow_bytes; i3 += 3 )
+                    for( size_t i4 = 0; i4 < n_follow_bytes; i4 += 4 )
+                    {
+                        std::string input = utf8_validation_test_input(
+                                        offsets[i_offset], c1, follow_bytes[i2], follow_bytes[i3], follow_bytes[i4] );
+                        std::string expected;
+                        {
+                        UseUTF8Validator use_scalar( cljp::ReadUTF8Base::UV_SCALAR );
+                        expected = read_all_utf8< cljp::ReaderString >( input );
+                        }
+                        if( read_all_utf8< cljp::ReaderString >( input ) != expected )
+                            ++n_mismatches;
+                    }
+    TTEST( n_mismatches == 0 );
+
+    std::string text;
+    for( size_t i = 0; i < 3000; ++i )
+        text += "ascii \xc2\xa3 \xe6\x97\xa5\xe6\x9c\xac \xf0\x92\x8d\x85 \xed\x9f\xbf \xef\xbf\xbd ";
+    TCALL( test_utf8_bulk( text, text ) );
+    TCALL( test_utf8_bulk( text + "\xed\xa0\x80" + text, text ) );
+    TCALL( test_utf8_bulk( text + "\xef\xbf\xbf" + text, text ) );
+    TCALL( test_utf8_bulk( text + std::string( 1, '\0' ) + text, text ) );
+}
+
+TFEATURE( "ReadUTF8 - UTF-8 validator implementations" )
+{
+    TTEST( cljp::ReadUTF8Base::is_utf8_validator_supported( cljp::ReadUTF8Base::UV_SCALAR ) );
+
+    TDOC( "Scalar" );
+    TCALL( test_utf8_validator( cljp::ReadUTF8Base::UV_SCALAR ) );
+    TDOC( "SSE4.2" );
+    TCALL( test_utf8_validator( cljp::ReadUTF8Base::UV_SSE42 ) );
+    TDOC( "AVX2" );
+    TCALL( test_utf8_validator( cljp::ReadUTF8Base::UV_AVX2 ) );
+}
+
+std::string encode_units( cljp::ReadUTF8Base::Modes mode, const std::vector< unsigned long > & r_units )
+{
+    bool is_utf16 = mode == cljp::ReadUTF8Base::UTF16LE || mode == cljp::ReadUTF8Base::UTF16BE;
+    bool is_big_endian = mode == cljp::ReadUTF8Base::UTF16BE || mode == cljp::ReadUTF8Base::UTF32BE;
+    size_t unit_size = is_utf16 ? 2 : 4;
+
+    std::string bytes;
+    for( size_t i = 0; i < r_units.size(); ++i )
+        for( size_t j = 0; j < unit_size; ++j )
+        {
+            size_t shift = 8 * (is_big_endian ? unit_size - 1 - j : j);
+            bytes += static_cast< char >( (r_units[i] >> shift) & 0xff );
+        }
+    return bytes;
+}
+
+void append_code_point( std::vector< unsigned long > * p_units, bool is_utf16, unsigned long code_point )
+{
+    if( is_utf16 && code_point >= 0x10000 )
+    {
+        p_units->push_back( 0xd800 + ((code_point - 0x10000) >> 10) );
+        p_units->push_back( 0xdc00 + ((code_point - 0x10000) & 0x3ff) );
+    }
+    else
+        p_units->push_back( code_point );
+}
+
+void test_transcoding( cljp::ReadUTF8Base::Modes mode )
+{
+    bool is_utf16 = mode == cljp::ReadUTF8Base::UTF16LE || mode == cljp::ReadUTF8Base::UTF16BE;
+
+    std::vector< unsigned long > units;
+    std::string expected;
+    for( size_t i = 0; i < 2000; ++i )
+    {
+        const char * p_ascii = "{\"ascii\": \"JSON structure\"}, ";
+        for( const char * p = p_ascii; *p; ++p )
+            units.push_back( static_cast< unsigned char >( *p ) );
+        expected += p_ascii;
+
+        append_code_point( &units, is_utf16, 0xa3 );
+        append_code_point( &units, is_utf16, 0x65e5 );
+        append_code_point( &units, is_utf16, 0xfffd );
+        append_code_point( &units, is_utf16, 0x12345 );
+        append_code_point( &units, is_utf16, 0x10ffff );
+        expected += "\xc2\xa3\xe6\x97\xa5\xef\xbf\xbd\xf0\x92\x8d\x85\xf4\x8f\xbf\xbf";
+    }
+
+    TCALL( test_utf8_bulk( encode_units( mode, units ), expected ) );
+
+    TDOC( "Input up to an invalid code unit is returned" );
+    std::vector< unsigned long > invalid_units( units );
+    invalid_units.push_back( 0xdc00 );      // Unpaired low surrogate
+    invalid_units.insert( invalid_units.end(), units.begin(), units.end() );
+    TCALL( test_utf8_bulk( encode_units( mode, invalid_units ), expected ) );
+
+    invalid_units = units;
+    invalid_units.push_back( 0xd800 );      // Unpaired high surrogate
+    invalid_units.push_back( 'a' );
+    TCALL( test_utf8_bulk( encode_units( mode, invalid_units ), expected ) );
+
+    invalid_units = units;
+    invalid_units.push_back( 0xd800 );      // Truncated surrogate pair
+    TCALL( test_utf8_bulk( encode_units( mode, invalid_units ), expected ) );
+
+    std::string truncated = encode_units( mode, units ) + encode_units( mode, units ).substr( 0, 1 );
+    TCALL( test_utf8_bulk( truncated, expected ) );
+
+    invalid_units = units;
+    invalid_units.push_back( 0 );           // NUL
+    invalid_units.insert( invalid_units.end(), units.begin(), units.end() );
+    TCALL( test_utf8_bulk( encode_units( mode, invalid_units ), expected ) );
+
+    if( ! is_utf16 )
+    {
+        invalid_units = units;
+        invalid_units.push_back( 0xdfff );  // Surrogates not allowed in UTF-32
+        invalid_units.push_back( 'a' );
+        TCALL( test_utf8_bulk( encode_units( mode, invalid_units ), expected ) );
+
+        invalid_units = units;
+        invalid_units.push_back( 0x110000 );    // Out of range
+        invalid_units.push_back( 'a' );
+        TCALL( test_utf8_bulk( encode_units( mode, invalid_units ), expected ) );
+
+        invalid_units = units;
+        invalid_units.push_back( 0xffffffff );
+        invalid_units.push_back( 'a' );
+        TCALL( test_utf8_bulk( encode_units( mode, invalid_units ), expected ) );
+    }
+}
+
+TFEATURE( "ReadUTF8 - UTF-16 and UTF-32 input transcoded in bulk" )
+{
+    for( int i = 0; i < 2; ++i )
+    {
+        UseUTF8Validator use_validator( i == 0 ? cljp::ReadUTF8Base::UV_SCALAR : cljp::ReadUTF8Base::utf8_validator() );
+
+        TDOC( "UTF-16LE" );
+        TCALL( test_transcoding( cljp::ReadUTF8Base::UTF16LE ) );
+        TDOC( "UTF-16BE" );
+        TCALL( test_transcoding( cljp::ReadUTF8Base::UTF16BE ) );
+        TDOC( "UTF-32LE" );
+        TCALL( test_transcoding( cljp::ReadUTF8Base::UTF32LE ) );
+        TDOC( "UTF-32BE" );
+        TCALL( test_transcoding( cljp::ReadUTF8Base::UTF32BE ) );
+    }
+
+    TDOC( "Transcoded input is available as a span" );
+    {
+    std::vector< unsigned long > units( 100, 'a' );
+    std::string input = encode_units( cljp::ReadUTF8Base::UTF16LE, units );
+    cljp::ReaderString reader( input );
+    cljp::ReadUTF8 utf8_reader( reader );
+
+    TTEST( utf8_reader.get() == 'a' );
+    TTEST( utf8_reader.get() == 'a' );
+    TTEST( utf8_reader.mode() == cljp::ReadUTF8::UTF16LE );
+    TTEST( utf8_reader.get() == 'a' );
+    TCRITICALTEST( utf8_reader.span_end() - utf8_reader.span_begin() == 97 );
+    TTEST( std::string( utf8_reader.span_begin(), utf8_reader.span_end() ) == std::string( 97, 'a' ) );
+    }
+}
+
 TFEATURE( "ReadUTF8 - UTF-16LE input" )
 {
     // xx 00        UTF-16LE
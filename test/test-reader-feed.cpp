@@ -0,0 +1,302 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull.h"   // Put file under test first to verify dependencies
+
+#include "clunit.h"
+
+#include "test-harness.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+
+namespace {
+
+bool is_same_when_fed( const char * p_input, const char * p_path = 0 )
+{
+    std::string input( p_input );
+    std::string expected = events_of( input, 0, p_path );
+    const size_t feed_sizes[] = { 1, 2, 3, 5, 16, 1000 };
+    for( size_t i = 0; i < sizeof( feed_sizes ) / sizeof( feed_sizes[0] ); ++i )
+        if( events_of( input, feed_sizes[i], p_path ) != expected )
+            return false;
+    return true;
+}
+
+}   // End of anonymous namespace
+
+TFEATURE( "class ReaderFeed - Same events as reading whole input" )
+{
+    TTEST( is_same_when_fed( "{\"name\":\"va\\\"l,ue\",\"n\":-12.5e3,\"t\":true,\"f\":false,\"z\":null,"
+                                "\"a\":[1,[],{},\"x\"],\"o\":{\"k\":\"\\u00e9\\ud83d\\ude00\\\\\"}}" ) );
+    TTEST( is_same_when_fed( " \t\r\n[ 1 , \"a\" , { \"b\" : [ ] } ,\"c\"] \n" ) );
+    TTEST( is_same_when_fed( "[\"\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80\",\"\\\\\",\"\\\\\\\"\"]" ) );
+    TTEST( is_same_when_fed( "{\"a\":{\"b\":[{\"c\":\"d\"},\"e\",{}],\"x\":[]},\"f\":\"g\"}" ) );
+    TTEST( is_same_when_fed( "\xef\xbb\xbf[1]" ) );
+    TTEST( is_same_when_fed( "\xef\xbb\xbf\"a\"" ) );
+
+    TDOC( "Several messages" );
+    TTEST( is_same_when_fed( "[1,2,3]\n{\"a\":1}\n\"str\"\n42\ntrue\n-0.5 null {}[]" ) );
+    TTEST( is_same_when_fed( "1" ) );
+    TTEST( is_same_when_fed( "" ) );
+    TTEST( is_same_when_fed( "  " ) );
+
+    TDOC( "Errors" );
+    TTEST( is_same_when_fed( "[1,,2]" ) );
+    TTEST( is_same_when_fed( "{\"a\" 1}" ) );
+    TTEST( is_same_when_fed( "{\"a\":1]" ) );
+    TTEST( is_same_when_fed( "[1 2]" ) );
+    TTEST( is_same_when_fed( "{\"a\":\"b\" \"c\":1}" ) );
+    TTEST( is_same_when_fed( "[\"a\" \"b\"]" ) );
+    TTEST( is_same_when_fed( "{1:2}" ) );
+    TTEST( is_same_when_fed( "{\"a\":1,}" ) );
+    TTEST( is_same_when_fed( "[{]" ) );
+    TTEST( is_same_when_fed( "]" ) );
+    TTEST( is_same_when_fed( "[tru]" ) );
+    TTEST( is_same_when_fed( "[1\"a\"]" ) );
+    TTEST( is_same_when_fed( "[01,2]" ) );
+    TTEST( is_same_when_fed( "[\"\\x\"]" ) );
+    TTEST( is_same_when_fed( "[\"\\u12\"]" ) );
+    TTEST( is_same_when_fed( "[1," ) );
+    TTEST( is_same_when_fed( "{\"a\":" ) );
+    TTEST( is_same_when_fed( "\"abc" ) );
+    TTEST( is_same_when_fed( "[\xc3]" ) );
+
+    TDOC( "\\u escapes the parser reads past the end of the string" );
+    TTEST( is_same_when_fed( "\"\\ud83d\"\"" ) );
+    TTEST( events_of( "\"\\ud83d\"\"", 3 ) == describe( cljp::Parser::PS_BAD_UNICODE_ESCAPE ) );
+    TTEST( is_same_when_fed( "[\"\\ud83d\"\" , 1 ,\"x\"] [2]" ) );
+    TTEST( is_same_when_fed( "{\"\\udbff\"a\":1}" ) );
+    TTEST( is_same_when_fed( "[\"\\ud83d\\ud83d\"]" ) );
+    TTEST( is_same_when_fed( "[\"\\u1\\\"\",\"]\"]" ) );
+    TTEST( is_same_when_fed( "[\"\\u1\\\\\"] 2" ) );
+}
+
+TFEATURE( "class ReaderFeed - Need more input" )
+{
+    cljp::ReaderFeed reader;
+    cljp::Parser parser( reader );
+    cljp::Event event;
+
+    TTEST( parser.get( &event ) == cljp::Parser::PS_NEED_MORE_INPUT );
+    reader.feed( "{\"a\":12" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is_object_start() );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_NEED_MORE_INPUT );  // 12 may continue
+    TTEST( reader.size() == 6 );
+    TTEST( reader.size_offered() == 0 );
+    reader.feed( "3" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_NEED_MORE_INPUT );
+    reader.feed( " " );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.name == "a" && event.value == "123" && event.to_int() == 123 );
+
+    TDOC( "Names and strings split between feeds" );
+    reader.feed( ", \"b" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_NEED_MORE_INPUT );
+    reader.feed( "\" " );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_NEED_MORE_INPUT );
+    reader.feed( " :\"x\\" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_NEED_MORE_INPUT );
+    reader.feed( "\"y\"" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.name == "b" && event.value == "x\"y" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_NEED_MORE_INPUT );
+    reader.feed( "}" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is_object_end() );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_END_OF_MESSAGE );
+
+    TDOC( "Next message" );
+    parser.new_message();
+    TTEST( parser.get( &event ) == cljp::Parser::PS_NEED_MORE_INPUT );
+    reader.feed( "\n[tr" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is_array_start() );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_NEED_MORE_INPUT );
+    reader.feed( "ue]" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is_true() );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is_array_end() );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_END_OF_MESSAGE );
+    TTEST( reader.size() == 0 );
+
+    TDOC( "Finishing" );
+    parser.new_message();
+    reader.feed( "[1" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_NEED_MORE_INPUT );
+    reader.finish();
+    TTEST( reader.is_finished() );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.to_int() == 1 );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_UNEXPECTED_END_OF_MESSAGE );
+
+    TDOC( "Rewind discards the input" );
+    reader.rewind();
+    TTEST( ! reader.is_finished() );
+    TTEST( reader.size() == 0 );
+    cljp::Parser parser_2( reader );
+    reader.feed( "[]" );
+    TTEST( parser_2.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is_array_start() );
+
+    TDOC( "Nothing more is offered after a \\u escape the parser reads past the end of the string" );
+    cljp::ReaderFeed reader_3;
+    cljp::Parser parser_3( reader_3 );
+    reader_3.feed( "[\"\\ud83d\"\",1]" );
+    TTEST( parser_3.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is_array_start() );
+    TTEST( parser_3.get( &event ) == cljp::Parser::PS_NEED_MORE_INPUT );
+    TTEST( reader_3.size_offered() == 0 );
+    reader_3.finish();
+    TTEST( parser_3.get( &event ) == cljp::Parser::PS_BAD_UNICODE_ESCAPE );
+}
+
+TFEATURE( "class ReaderFeed - Skipping values not yet fed" )
+{
+    {
+    cljp::ReaderFeed reader;
+    cljp::Parser parser( reader );
+    cljp::Event event;
+
+    reader.feed( "{\"a\":[1,2" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is_array_start() );
+    TTEST( parser.skip() == cljp::Parser::PS_NEED_MORE_INPUT );
+    reader.feed( ",{\"b\":\"]\"}" );
+    TTEST( parser.skip() == cljp::Parser::PS_NEED_MORE_INPUT );
+    reader.feed( "]}" );
+    TTEST( parser.skip() == cljp::Parser::PS_OK );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is_object_end() );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_END_OF_MESSAGE );
+    }
+
+    {
+    TDOC( "get() finishes the skip" );
+    cljp::ReaderFeed reader;
+    cljp::Parser parser( reader );
+    cljp::Event event;
+
+    reader.feed( "{\"a\":[1,2" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( parser.skip() == cljp::Parser::PS_NEED_MORE_INPUT );
+    reader.feed( "]}" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is_object_end() );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_END_OF_MESSAGE );
+    }
+
+    {
+    TDOC( "Values skipped by a projection" );
+    cljp::ReaderFeed reader;
+    cljp::Parser parser( reader );
+    cljp::Projection projection;
+    projection.add( "/b" );
+    parser.use_projection( &projection );
+    cljp::Event event;
+
+    reader.feed( "{\"a\":[1,2" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is_object_start() );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_NEED_MORE_INPUT );
+    reader.feed( "],\"b\":3}" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.name == "b" && event.to_int() == 3 );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.is_object_end() );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_END_OF_MESSAGE );
+    }
+
+    TDOC( "Same events as reading whole input" );
+    TTEST( is_same_when_fed( "{\"a\":1,\"skip\":[1,{\"x\":\"]}\\\"[\"},[[]]],\"b\":2}" ) );
+    TTEST( is_same_when_fed( "[{\"skip\":{\"s\":\"\\\\\",\"t\":{}},\"c\":true},{\"skip\":[]}]" ) );
+    TTEST( is_same_when_fed( "{\"skip\":[1,2}" ) );
+    TTEST( is_same_when_fed( "{\"skip\":[1,2" ) );
+    TTEST( is_same_when_fed( "{\"a\":[1,{\"x\":\"]}\"},[[]]],\"b\":{\"c\":2,\"d\":\"e\"},\"f\":\"g\"}", "/b/c" ) );
+    TTEST( is_same_when_fed( "[[1,2],{\"a\":[3]},\"x\",4,[5,[6]]]", "/1" ) );
+    TTEST( is_same_when_fed( "[[1,2],{\"a\":[3]},\"x\",4,[5,[6]]] [7] {\"a\":[]}", "/1/a" ) );
+    TTEST( is_same_when_fed( "{\"a\":{\"skip\":[1,[2]],\"b\":[3]},\"c\":[4]}", "/a" ) );
+    TTEST( is_same_when_fed( "{\"a\":[1,2}", "/b" ) );
+
+    TDOC( "Missing values where a projection skips" );
+    TTEST( is_same_when_fed( "{\"a\":,\"k\":1}", "/k" ) );
+    TTEST( is_same_when_fed( "{\"a\":]}", "/k" ) );
+    TTEST( is_same_when_fed( "[1,,2]", "/0" ) );
+    TTEST( is_same_when_fed( "[:\"k\":e\"skip\":]", "/k" ) );
+}
+
+TFEATURE( "class ReaderFeed - EventView" )
+{
+    cljp::ReaderFeed reader( 4 );
+    cljp::Parser parser( reader );
+    cljp::EventView event;
+
+    reader.feed( "{\"long name\":\"long val" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_NEED_MORE_INPUT );
+    reader.feed( "ue\"}" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.name == "long name" && event.value == "long value" );
+}
+
+TFEATURE( "class ReaderFeed - Memory is reused" )
+{
+    cljp::ReaderFeed reader( 64 );
+    cljp::Parser parser( reader );
+    cljp::Event event;
+
+    size_t max_size = 0;
+    long sum = 0;
+    for( int i = 0; i < 10000; ++i )
+    {
+        char c_record[32];
+        sprintf( c_record, "{\"n\":%d}\n", i );
+        reader.feed( c_record );
+        max_size = std::max( max_size, reader.size() );
+
+        cljp::Parser::Status status;
+        while( (status = parser.get( &event )) == cljp::Parser::PS_OK )
+            if( event.is( "n" ) )
+                sum += event.to_int();
+        if( status == cljp::Parser::PS_END_OF_MESSAGE )
+            parser.new_message();
+    }
+    TTEST( sum == 9999L * 10000 / 2 );
+    TTEST( max_size < 64 );
+}
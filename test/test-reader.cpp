@@ -35,6 +35,8 @@
 
 #include "clunit.h"
 
+#include "test-harness.h"
+
 TFEATURE( "class ReaderMemory" )
 {
     {
@@ -58,6 +60,75 @@ TFEATURE( "class ReaderMemory" )
     }
 }
 
+TFEATURE( "class ReaderMemory - Block interface" )
+{
+    {
+    std::string in( "abcde" );
+
+    cljp::ReaderString reader( in );
+
+    const char * p_block = 0;
+    TTEST( reader.peek( &p_block ) == 5 );
+    TTEST( std::string( p_block, 5 ) == "abcde" );
+    TTEST( reader.peek( &p_block ) == 5 );     // peek() doesn't consume anything
+
+    reader.consume( 2 );
+    TTEST( reader.peek( &p_block ) == 3 );
+    TTEST( std::string( p_block, 3 ) == "cde" );
+    TTEST( reader.get() == 'c' );
+
+    reader.consume( 2 );
+    TTEST( reader.peek( &p_block ) == 0 );
+    TTEST( reader.get() == cljp::Reader::EOM );
+
+    reader.rewind();
+    TTEST( reader.peek( &p_block ) == 5 );
+    }
+}
+
+TFEATURE( "class Reader - Block interface for get() only derived classes" )
+{
+    {
+    ReaderGetOnly reader( "ab\xf2" );
+
+    const char * p_block = 0;
+    TTEST( reader.peek( &p_block ) == 1 );
+    TTEST( *p_block == 'a' );
+    TTEST( reader.peek( &p_block ) == 1 );     // peek() doesn't consume anything
+    TTEST( *p_block == 'a' );
+    TTEST( reader.get() == 'a' );              // get() returns a peeked, but unconsumed, byte
+
+    TTEST( reader.peek( &p_block ) == 1 );
+    TTEST( *p_block == 'b' );
+    reader.consume( 1 );
+    TTEST( reader.get() == 0xf2 );
+    TTEST( reader.peek( &p_block ) == 0 );
+    TTEST( reader.get() == cljp::Reader::EOM );
+    }
+
+    {
+    TDOC( "get() only derived Readers can still be used by the Parser" );
+    ReaderGetOnly reader( "{ \"Field\" : [ 12, \"High\" ] }" );
+    cljp::Parser parser( reader );
+    cljp::Event event;
+
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.type == cljp::Event::T_OBJECT_START );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.type == cljp::Event::T_ARRAY_START );
+    TTEST( event.name == "Field" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.value == "12" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.value == "High" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.type == cljp::Event::T_ARRAY_END );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.type == cljp::Event::T_OBJECT_END );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_END_OF_MESSAGE );
+    }
+}
+
 TFEATURE( "class ReaderFile" )
 {
     const char * p_test_file_name = "Reader-test-abc.txt";
@@ -83,6 +154,191 @@ TFEATURE( "class ReaderFile" )
     reader.rewind();
     TTEST( reader.get() == 'a' );
     }
+
+    {
+    TDOC( "ReaderFile - Block interface" );
+    cljp::ReaderFile reader( p_test_file_name );
+
+    TCRITICALTEST( reader.is_open() );
+
+    TTEST( reader.get() == 'a' );
+
+    const char * p_block = 0;
+    TTEST( reader.peek( &p_block ) == 3 );
+    TTEST( std::string( p_block, 3 ) == "bc\xf2" );
+    reader.consume( 1 );
+    TTEST( reader.get() == 'c' );
+    TTEST( reader.peek( &p_block ) == 1 );
+    reader.consume( 1 );
+    TTEST( reader.peek( &p_block ) == 0 );
+    TTEST( reader.get() == cljp::Reader::EOM );
+
+    reader.rewind();
+    TTEST( reader.peek( &p_block ) == 4 );
+    TTEST( *p_block == 'a' );
+    }
+}
+
+void test_reader_file_block_size( size_t block_size )
+{
+    const char * p_test_file_name = "Reader-test-block-size.json";
+
+    {
+    std::ofstream fout( p_test_file_name );
+    TCRITICALTEST( fout.is_open() );
+
+    fout << "{ \"Field\" : [ 12, \"High\" ], \"Jam\" : true }";
+    }
+
+    cljp::ReaderFile reader( p_test_file_name, block_size );
+
+    TCRITICALTEST( reader.is_open() );
+
+    for( int pass = 0; pass < 2; ++pass )   // Make sure rewind() gives the same result
+    {
+        cljp::Parser parser( reader );
+        cljp::Event event;
+
+        TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+        TTEST( event.type == cljp::Event::T_OBJECT_START );
+        TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+        TTEST( event.type == cljp::Event::T_ARRAY_START );
+        TTEST( event.name == "Field" );
+        TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+        TTEST( event.value == "12" );
+        TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+        TTEST( event.value == "High" );
+        TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+        TTEST( event.type == cljp::Event::T_ARRAY_END );
+        TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+        TTEST( event.name == "Jam" );
+        TTEST( event.is_true() );
+        TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+        TTEST( event.type == cljp::Event::T_OBJECT_END );
+        TTEST( parser.get( &event ) == cljp::Parser::PS_END_OF_MESSAGE );
+
+        reader.rewind();
+    }
+}
+
+TFEATURE( "class ReaderFile - Block sizes" )
+{
+    TTEST( cljp::ReaderFile( "Reader-test-abc.txt" ).block_size() == cljp::ReaderFile::default_block_size );
+    TTEST( cljp::ReaderFile( "Reader-test-abc.txt", 0 ).block_size() == 1 );
+
+    TCALL( test_reader_file_block_size( 1 ) );
+    TCALL( test_reader_file_block_size( 2 ) );
+    TCALL( test_reader_file_block_size( 7 ) );
+    TCALL( test_reader_file_block_size( cljp::ReaderFile::default_block_size ) );
+
+    {
+    TDOC( "ReaderFile - Input larger than a block" );
+    const char * p_test_file_name = "Reader-test-large.txt";
+
+    std::string expected;
+    for( size_t i = 0; i < 3 * cljp::ReaderFile::default_block_size + 17; ++i )
+        expected += static_cast< char >( 'a' + i % 26 );
+
+    {
+    std::ofstream fout( p_test_file_name );
+    TCRITICALTEST( fout.is_open() );
+    fout << expected;
+    }
+
+    cljp::ReaderFile reader( p_test_file_name );
+    TCRITICALTEST( reader.is_open() );
+
+    std::string actual;
+    const char * p_block = 0;
+    while( size_t n_bytes = reader.peek( &p_block ) )
+    {
+        TCRITICALTEST( n_bytes <= cljp::ReaderFile::default_block_size );
+        actual.append( p_block, n_bytes );
+        reader.consume( n_bytes );
+    }
+    TTEST( actual == expected );
+
+    TDOC( "ReaderFile - Rewind part way through a block" );
+    reader.rewind();
+    TTEST( reader.get() == 'a' );
+    TTEST( reader.get() == 'b' );
+    reader.rewind();
+    TTEST( reader.get() == 'a' );
+    }
+}
+
+TFEATURE( "class ReaderMmap" )
+{
+    const char * p_test_file_name = "Reader-test-mmap.json";
+
+    {
+    std::ofstream fout( p_test_file_name );
+    TCRITICALTEST( fout.is_open() );
+
+    fout << "[ 12, \"High\" ]";
+    }
+
+    {
+    cljp::ReaderMmap reader( p_test_file_name );
+
+    TCRITICALTEST( reader.is_open() );
+    TTEST( reader.size() == 14 );
+
+    const char * p_block = 0;
+    TTEST( reader.peek( &p_block ) == 14 );    // Whole file is available as a single block
+    TTEST( std::string( p_block, 14 ) == "[ 12, \"High\" ]" );
+    TTEST( reader.get() == '[' );
+    TTEST( reader.get() == ' ' );
+
+    reader.rewind();
+    TTEST( reader.get() == '[' );
+
+    reader.rewind();
+    cljp::Parser parser( reader );
+    cljp::Event event;
+
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.type == cljp::Event::T_ARRAY_START );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.value == "12" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.value == "High" );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_OK );
+    TTEST( event.type == cljp::Event::T_ARRAY_END );
+    TTEST( parser.get( &event ) == cljp::Parser::PS_END_OF_MESSAGE );
+    }
+
+    {
+    TDOC( "ReaderMmap - Empty file" );
+    const char * p_empty_file_name = "Reader-test-mmap-empty.json";
+
+    {
+    std::ofstream fout( p_empty_file_name );
+    TCRITICALTEST( fout.is_open() );
+    }
+
+    cljp::ReaderMmap reader( p_empty_file_name );
+
+    TTEST( reader.is_open() );
+    TTEST( reader.size() == 0 );
+
+    const char * p_block = 0;
+    TTEST( reader.peek( &p_block ) == 0 );
+    TTEST( reader.get() == cljp::Reader::EOM );
+
+    cljp::Parser parser( reader );
+    cljp::Event event;
+
+    TTEST( parser.get( &event ) == cljp::Parser::PS_END_OF_MESSAGE );
+    }
+
+    {
+    TDOC( "ReaderMmap - Non-existent file" );
+    cljp::ReaderMmap reader( "Reader-test-mmap-non-existent.json" );
+
+    TTEST( ! reader.is_open() );
+    TTEST( reader.get() == cljp::Reader::EOM );
+    }
 }
 
 TFEATURE( "class ReadUTF8WithUnget" )
@@ -0,0 +1,225 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull.h"   // Put file under test first to verify dependencies
+
+#include "clunit.h"
+
+#include "test-harness.h"
+
+#include <vector>
+
+namespace {
+
+std::vector< size_t > index_offsets( const std::string & json )
+{
+    cljp::StructuralIndex index( json.data(), json.data() + json.size() );
+    std::vector< size_t > offsets;
+    for( size_t i = 0; i < index.size(); ++i )
+        offsets.push_back( index[i] - json.data() );
+    return offsets;
+}
+
+std::vector< size_t > make_offsets( const size_t * p_begin, const size_t * p_end )
+{
+    return std::vector< size_t >( p_begin, p_end );
+}
+
+void test_index_positions()
+{
+    //                       0000000000111111111122222222
+    //                       0123456789012345678901234567
+    std::string json( "{ \"k\\\"\" : [ 12 , \"v\\\\\" ] }" );
+    const size_t expected[] = { 0, 2, 4, 6, 8, 10, 12, 15, 17, 19, 21, 23, 25 };
+    TTEST( index_offsets( json ) == make_offsets( expected, expected + sizeof( expected ) / sizeof( expected[0] ) ) );
+
+    TDOC( "Control characters in strings are indexed" );
+    std::string json_control( "[\"a\tb\"]" );
+    const size_t expected_control[] = { 0, 1, 3, 5, 6 };
+    TTEST( index_offsets( json_control ) == make_offsets( expected_control, expected_control + 5 ) );
+
+    TDOC( "String state and escapes are carried between 64 byte blocks" );
+    std::string json_long( 62, ' ' );
+    json_long += "\"\\\\\\\"ab\"x";    // Backslash run crosses the block boundary
+    const size_t expected_long[] = { 62, 63, 65, 69 };
+    TTEST( index_offsets( json_long ) == make_offsets( expected_long, expected_long + 4 ) );
+
+    std::string json_in_string( "\"" + std::string( 200, 'a' ) + " b\" c" );
+    const size_t expected_in_string[] = { 0, 203, 205 };
+    TTEST( index_offsets( json_in_string ) == make_offsets( expected_in_string, expected_in_string + 3 ) );
+}
+
+struct ParsedEvent
+{
+    cljp::Parser::Status status;
+    cljp::Event event;
+
+    bool operator == ( const ParsedEvent & r_rhs ) const
+    {
+        return status == r_rhs.status && event.type == r_rhs.event.type &&
+                event.name == r_rhs.event.name && event.value == r_rhs.event.value;
+    }
+};
+
+template< typename Tparser >
+std::vector< ParsedEvent > parse_all( const std::string & json )
+{
+    // Carries on with the next message after the end of each message or an
+    // error, until a message has no events
+    cljp::ReaderString reader( json );
+    Tparser parser( reader );
+    std::vector< ParsedEvent > events;
+    for( bool has_events = true; has_events; parser.new_message() )
+    {
+        has_events = false;
+        for(;;)
+        {
+            ParsedEvent parsed;
+            parsed.status = parser.get( &parsed.event );
+            events.push_back( parsed );
+            if( parsed.status != cljp::Parser::PS_OK )
+                break;
+            has_events = true;
+        }
+    }
+    return events;
+}
+
+bool is_same_as_unindexed( const std::string & json )
+{
+    std::vector< ParsedEvent > expected = parse_all< cljp::Parser >( json );
+    return parse_all< IndexedParser< cljp::Parser > >( json ) == expected &&
+            parse_all< IndexedParser< cljp::BasicParser< cljp::ReaderMemory > > >( json ) == expected;
+}
+
+std::string test_document()
+{
+    std::string json( "{\r\n" );
+    for( size_t i = 0; i < 5; ++i )
+    {
+        json += "    \"member\\\\";
+        json += std::string( i % 5, '\\' ) + std::string( i % 5, '\\' );
+        json += "\" :\t[ 1.5e3,\v-12 , true,\ffalse, null,\n";
+        json += "        \"text \\\"quoted\\\" \\u00e9 \xc2\xa3\xe6\x97\xa5\", { \"a\":{}, \"b\":[] } ],\n";
+    }
+    json += "    \"end\":\"\"\n}\n";
+    return json;
+}
+
+void test_parser_with_index()
+{
+    std::string json = test_document();
+
+    TTEST( is_same_as_unindexed( json ) );
+    TTEST( parse_all< IndexedParser< cljp::Parser > >( json ).size() > 50 );
+
+    TDOC( "Errors are reported as without the index" );
+    const char replacements[] = { 'x', '\x01', '\\', '"', '{', ']', ' ', '\t', '\0' };
+    size_t n_mismatches = 0;
+    for( size_t i = 0; i < json.size(); ++i )
+        for( size_t j = 0; j < sizeof( replacements ); ++j )
+        {
+            std::string corrupted( json );
+            corrupted[i] = replacements[j];
+            if( ! is_same_as_unindexed( corrupted ) )
+                ++n_mismatches;
+        }
+    TTEST( n_mismatches == 0 );
+
+    size_t n_truncated_mismatches = 0;
+    for( size_t i = 0; i < json.size(); ++i )
+        if( ! is_same_as_unindexed( json.substr( 0, i ) ) )
+            ++n_truncated_mismatches;
+    TTEST( n_truncated_mismatches == 0 );
+
+    TDOC( "Errors in a string that leave the parser out of step with the index" );
+    // The lone high surrogate makes the parser take the closing quote as
+    // part of the string, which then runs on to the tab
+    TTEST( is_same_as_unindexed( "{\"\\ud83d\"  \t:null,\"b\":1}" ) );
+    TTEST( is_same_as_unindexed( "[\"\\ud83d\"  \t, \"a b\" ,\"c\\\"\" ]" ) );
+    TTEST( is_same_as_unindexed( "[tru\"  \t\"]  \"x\"" ) );
+}
+
+}   // End of anonymous namespace
+
+TFEATURE( "class StructuralIndex" )
+{
+    cljp::ReadUTF8Base::UTF8Validators validators[] =
+            { cljp::ReadUTF8Base::UV_SCALAR, cljp::ReadUTF8Base::UV_SSE42, cljp::ReadUTF8Base::UV_AVX2 };
+
+    for( size_t i = 0; i < sizeof( validators ) / sizeof( validators[0] ); ++i )
+    {
+        if( ! cljp::ReadUTF8Base::is_utf8_validator_supported( validators[i] ) )
+            continue;
+
+        UseUTF8Validator use_validator( validators[i] );
+
+        TCALL( test_index_positions() );
+    }
+
+    TDOC( "Empty and default constructed indexes" );
+    cljp::StructuralIndex index;
+    TTEST( index.size() == 0 );
+    TTEST( ! index.is_indexed( "" ) );
+    std::string empty;
+    TTEST( index_offsets( empty ).empty() );
+}
+
+TFEATURE( "Parser with StructuralIndex" )
+{
+    cljp::ReadUTF8Base::UTF8Validators validators[] =
+            { cljp::ReadUTF8Base::UV_SCALAR, cljp::ReadUTF8Base::UV_SSE42, cljp::ReadUTF8Base::UV_AVX2 };
+
+    for( size_t i = 0; i < sizeof( validators ) / sizeof( validators[0] ); ++i )
+    {
+        if( ! cljp::ReadUTF8Base::is_utf8_validator_supported( validators[i] ) )
+            continue;
+
+        UseUTF8Validator use_validator( validators[i] );
+
+        TCALL( test_parser_with_index() );
+    }
+
+    TDOC( "Index is not used for input that is not UTF-8" );
+    {
+    std::string utf16le;
+    std::string json = test_document();
+    for( size_t i = 0; i < json.size(); ++i )
+    {
+        utf16le += json[i];
+        utf16le += '\0';
+    }
+    std::vector< ParsedEvent > events = parse_all< IndexedParser< cljp::Parser > >( utf16le );
+    TTEST( events.back().status == cljp::Parser::PS_OK || events.back().status == cljp::Parser::PS_END_OF_MESSAGE );
+    }
+}
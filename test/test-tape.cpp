@@ -0,0 +1,200 @@
+//----------------------------------------------------------------------------
+// Copyright (c) 2026, Codalogic Ltd (http://www.codalogic.com)
+// All rights reserved.
+//
+// The license for this file is based on the BSD-3-Clause license
+// (http://www.opensource.org/licenses/BSD-3-Clause).
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions
+// are met:
+//
+// - Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+// - Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+// - Neither the name Codalogic Ltd nor the names of its contributors may be
+//   used to endorse or promote products derived from this software without
+//   specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//----------------------------------------------------------------------------
+
+#include "cl-json-pull/cl-json-pull.h"   // Put file under test first to verify dependencies
+
+#include "clunit.h"
+
+#include "test-harness.h"
+
+#include <string>
+
+namespace {
+
+const char * p_order =
+        "{\"user\":{\"id\":7,\"name\":\"J\\u00f6\",\"tags\":[\"a\",\"b\"]},"
+        "\"items\":[{\"price\":1.5,\"qty\":2},{},{\"qty\":-1,\"price\":3e2}],"
+        "\"\":[],\"big\":9007199254740993,\"huge\":123456789012345678901234,"
+        "\"paid\":true,\"notes\":null}";
+
+std::string value_text( const cljp::Tape::Value & r_value )
+{
+    cljp::EventView event;
+    r_value.to_event( &event );
+    return event.value.to_string();
+}
+
+}   // End of anonymous namespace
+
+TFEATURE( "Tape::build()" )
+{
+    std::string json( p_order );
+    cljp::ReaderString reader( json );
+    cljp::Parser parser( reader );
+    cljp::Tape tape;
+
+    TTEST( tape.empty() );
+    TTEST( ! tape.root().is_valid() );
+
+    TTEST( tape.build( parser ) == cljp::Parser::PS_OK );
+    TTEST( ! tape.empty() );
+    TTEST( tape.root().is_object() );
+    TTEST( tape.root().name().empty() );
+    TTEST( ! tape.root().next().is_valid() );
+
+    TDOC( "No more messages" );
+    parser.new_message();
+    TTEST( tape.build( parser ) == cljp::Parser::PS_END_OF_MESSAGE );
+    TTEST( tape.empty() );
+
+    TDOC( "Scalar messages" );
+    {
+    std::string json( "\"x\" 12" );
+    cljp::ReaderString reader( json );
+    cljp::Parser parser( reader );
+    TTEST( tape.build( parser ) == cljp::Parser::PS_OK );
+    TTEST( tape.root().type() == cljp::Event::T_STRING );
+    TTEST( value_text( tape.root() ) == "x" );
+    parser.new_message();
+    TTEST( tape.build( parser ) == cljp::Parser::PS_OK );
+    TTEST( tape.size() == 2 );
+    TTEST( value_text( tape.root() ) == "12" );
+    }
+
+    TDOC( "Errors" );
+    {
+    std::string json( "{\"a\":[1,}" );
+    cljp::ReaderString reader( json );
+    cljp::Parser parser( reader );
+    TTEST( tape.build( parser ) == cljp::Parser::PS_UNEXPECTED_OBJECT_CLOSE );
+    }
+
+    TDOC( "With a StructuralIndex" );
+    {
+    std::string json( p_order );
+    cljp::ReaderString reader( json );
+    IndexedParser< cljp::BasicParser< cljp::ReaderMemory > > indexed_parser( reader );
+    TTEST( tape.build( indexed_parser ) == cljp::Parser::PS_OK );
+    TTEST( tape.root().find( "user" ).find( "name" ).type() == cljp::Event::T_STRING );
+    }
+}
+
+TFEATURE( "Tape::Value navigation" )
+{
+    std::string json( p_order );
+    cljp::ReaderString reader( json );
+    cljp::Parser parser( reader );
+    cljp::Tape tape;
+    TTEST( tape.build( parser ) == cljp::Parser::PS_OK );
+
+    cljp::Tape::Value root = tape.root();
+    TTEST( root.size() == 7 );
+    TTEST( root.first().name() == "user" );
+    TTEST( root.first().next().name() == "items" );
+    TTEST( root.at( 2 ).name() == "" );
+    TTEST( root.at( 2 ).is_array() );
+    TTEST( root.at( 2 ).size() == 0 );
+    TTEST( ! root.at( 2 ).first().is_valid() );
+    TTEST( ! root.at( 7 ).is_valid() );
+    TTEST( root.find( "notes" ).type() == cljp::Event::T_NULL );
+    TTEST( ! root.find( "missing" ).is_valid() );
+    TTEST( ! root.find( "missing" ).find( "x" ).is_valid() );
+    TTEST( root.find( "user" ) == root.first() );
+    TTEST( root.find( "user" ) != root.at( 1 ) );
+
+    cljp::Tape::Value user = root.find( "user" );
+    TTEST( user.is_object() );
+    TTEST( value_text( user.find( "name" ) ) == "J\xc3\xb6" );
+    TTEST( user.find( "tags" ).size() == 2 );
+    TTEST( value_text( user.find( "tags" ).at( 1 ) ) == "b" );
+    TTEST( user.find( "tags" ).at( 1 ).name().empty() );
+    TTEST( ! user.find( "tags" ).find( "a" ).is_valid() );
+
+    cljp::Tape::Value items = root.find( "items" );
+    TTEST( items.size() == 3 );
+    TTEST( items.at( 1 ).is_object() );
+    TTEST( items.at( 1 ).size() == 0 );
+    TTEST( value_text( items.at( 2 ).find( "price" ) ) == "3e2" );
+    TTEST( ! items.at( 2 ).find( "price" ).next().is_valid() );
+    TTEST( ! items.at( 0 ).first().first().is_valid() );
+}
+
+TFEATURE( "Tape::Value::to_event()" )
+{
+    std::string json( p_order );
+    cljp::ReaderString reader( json );
+    cljp::Parser parser( reader );
+    cljp::Tape tape;
+    TTEST( tape.build( parser ) == cljp::Parser::PS_OK );
+    cljp::Tape::Value root = tape.root();
+
+    cljp::EventView event;
+    root.find( "user" ).find( "id" ).to_event( &event );
+    TTEST( event.is_number() );
+    TTEST( event.name == "id" );
+    TTEST( event.value == "7" );
+    TTEST( event.is_int() );
+    TTEST( event.to_int64() == 7 );
+    TTEST( event.to_float() == 7.0 );
+
+    root.find( "items" ).at( 2 ).find( "qty" ).to_event( &event );
+    TTEST( event.to_int64() == -1 );
+    TTEST( event.to_float() == -1.0 );
+
+    root.find( "items" ).at( 0 ).find( "price" ).to_event( &event );
+    TTEST( ! event.is_int() );
+    TTEST( event.to_float() == 1.5 );
+    TTEST( event.to_int64() == 1 );
+
+    root.find( "big" ).to_event( &event );
+    TTEST( event.to_uint64() == 9007199254740993ull );
+    TTEST( event.to_float() == 9007199254740992.0 );
+
+    root.find( "huge" ).to_event( &event );
+    TTEST( event.to_uint64() == 18446744073709551615ull );
+    TTEST( event.to_float() == 123456789012345678901234.0 );
+
+    root.find( "paid" ).to_event( &event );
+    TTEST( event.is_true() );
+    TTEST( event.value == "true" );
+
+    root.find( "notes" ).to_event( &event );
+    TTEST( event.is_null() );
+    TTEST( event.name == "notes" );
+
+    root.to_event( &event );
+    TTEST( event.is_object_start() );
+
+    cljp::Tape::Value().to_event( &event );
+    TTEST( event.is_unknown() );
+}